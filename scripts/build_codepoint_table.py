@@ -0,0 +1,316 @@
+#!/usr/bin/env python3
+"""Generate console codepoint tables from scripts/console_codepoints.txt.
+
+Writes the two-level BMP page table used on device (source/title_text_table.c),
+the equivalent Python table used by clean_title_name()
+(scripts/console_codepoint_table.py), and a dump of the Python table's class for
+every BMP code point (tests/codepoint_classes.h) that tests/test_title_text_table.c
+compares the compiled C table against. Use --check to verify the checked-in files
+are current and the Python table agrees with the rules for every BMP code point.
+"""
+
+import argparse
+import os
+import re
+import sys
+from typing import Dict, List, Tuple
+
+CLASS_KEEP = 0
+CLASS_DROP = 1
+CLASS_REPLACE = 2
+BMP_PAGES = 256
+PAGE_SIZE = 256
+
+RULE_RE = re.compile(
+    r'^(?P<first>[0-9A-Fa-f]{4})(?:\.\.(?P<last>[0-9A-Fa-f]{4}))?\s+'
+    r'(?P<action>drop|keep|"(?:[^"\\]|\\.)*")\s*$'
+)
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+RULES_PATH = os.path.join(REPO_ROOT, "scripts", "console_codepoints.txt")
+C_OUTPUT_PATH = os.path.join(REPO_ROOT, "source", "title_text_table.c")
+PY_OUTPUT_PATH = os.path.join(REPO_ROOT, "scripts", "console_codepoint_table.py")
+TEST_OUTPUT_PATH = os.path.join(REPO_ROOT, "tests", "codepoint_classes.h")
+
+
+def parse_rules(path: str) -> List[Tuple[int, int, str]]:
+    """Return (first, last, action) tuples; action is 'drop', 'keep' or replacement text."""
+    rules: List[Tuple[int, int, str]] = []
+    with open(path, encoding="utf-8") as handle:
+        for lineno, raw in enumerate(handle, 1):
+            line = raw.strip()
+            if not line or line.startswith("#"):
+                continue
+            match = RULE_RE.match(line)
+            if match is None:
+                raise ValueError(f"{path}:{lineno}: cannot parse rule: {raw.rstrip()}")
+            first = int(match.group("first"), 16)
+            last = int(match.group("last") or match.group("first"), 16)
+            if last < first:
+                raise ValueError(f"{path}:{lineno}: range end before start")
+            action = match.group("action")
+            if action.startswith('"'):
+                action = action[1:-1].replace('\\"', '"').replace("\\\\", "\\")
+                if not action.isascii():
+                    raise ValueError(f"{path}:{lineno}: replacement must be ASCII")
+            rules.append((first, last, action))
+    return rules
+
+
+def build_classes(rules: List[Tuple[int, int, str]]) -> Tuple[List[int], List[str]]:
+    """Flatten rules into one class byte per BMP code point plus the replacement list."""
+    classes = [CLASS_KEEP] * (BMP_PAGES * PAGE_SIZE)
+    replacements: List[str] = []
+    replacement_index: Dict[str, int] = {}
+
+    for first, last, action in rules:
+        if action == "drop":
+            value = CLASS_DROP
+        elif action == "keep":
+            value = CLASS_KEEP
+        else:
+            if action not in replacement_index:
+                replacement_index[action] = len(replacements)
+                replacements.append(action)
+            value = CLASS_REPLACE + replacement_index[action]
+            if value > 0xFF:
+                raise ValueError("Too many distinct replacements for a u8 class")
+        for cp in range(first, last + 1):
+            classes[cp] = value
+
+    return classes, replacements
+
+
+def build_page_table(classes: List[int]) -> Tuple[List[int], List[bytes]]:
+    """Deduplicate 256-entry pages; page 0 of the block list is always all-keep."""
+    blocks: List[bytes] = [bytes(PAGE_SIZE)]
+    block_index: Dict[bytes, int] = {blocks[0]: 0}
+    page_index: List[int] = []
+
+    for page in range(BMP_PAGES):
+        block = bytes(classes[page * PAGE_SIZE:(page + 1) * PAGE_SIZE])
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        page_index.append(block_index[block])
+
+    return page_index, blocks
+
+
+def c_string(value: str) -> str:
+    return '"' + value.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def generate_c_code(page_index: List[int], blocks: List[bytes], replacements: List[str]) -> str:
+    lines = [
+        "// SPDX-License-Identifier: MIT",
+        "// Copyright (c) 2025 selloa",
+        "",
+        '#include "title_text_table.h"',
+        "",
+        "// Console codepoint classes generated from scripts/console_codepoints.txt",
+        f"// Distinct pages: {len(blocks)}, replacements: {len(replacements)}",
+        "// Regenerate via scripts/build_codepoint_table.py",
+        "",
+        "const u8 title_text_page_index[256] = {",
+    ]
+    for row in range(0, BMP_PAGES, 16):
+        values = ", ".join(f"{v:2d}" for v in page_index[row:row + 16])
+        suffix = "," if row + 16 < BMP_PAGES else ""
+        lines.append(f"    {values}{suffix}")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const u8 title_text_page_classes[{len(blocks)}][256] = {{")
+    for i, block in enumerate(blocks):
+        lines.append("    {")
+        for row in range(0, PAGE_SIZE, 16):
+            values = ", ".join(f"{v:2d}" for v in block[row:row + 16])
+            suffix = "," if row + 16 < PAGE_SIZE else ""
+            lines.append(f"        {values}{suffix}")
+        lines.append("    }" + ("," if i < len(blocks) - 1 else ""))
+    lines.append("};")
+    lines.append("")
+    lines.append("const char *const title_text_replacements[] = {")
+    for i, text in enumerate(replacements):
+        suffix = "," if i < len(replacements) - 1 else ""
+        lines.append(f"    {c_string(text)}{suffix}")
+    lines.append("};")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def generate_python_code(page_index: List[int], blocks: List[bytes], replacements: List[str]) -> str:
+    lines = [
+        '"""Console codepoint classes generated from scripts/console_codepoints.txt.',
+        "",
+        "Regenerate via scripts/build_codepoint_table.py; do not edit by hand.",
+        '"""',
+        "",
+        f"CLASS_KEEP = {CLASS_KEEP}",
+        f"CLASS_DROP = {CLASS_DROP}",
+        f"CLASS_REPLACE = {CLASS_REPLACE}",
+        "",
+        "PAGE_INDEX = bytes([",
+    ]
+    for row in range(0, BMP_PAGES, 16):
+        values = ", ".join(f"{v}" for v in page_index[row:row + 16])
+        lines.append(f"    {values},")
+    lines.append("])")
+    lines.append("")
+    lines.append("PAGE_CLASSES = (")
+    for block in blocks:
+        lines.append("    bytes([")
+        for row in range(0, PAGE_SIZE, 16):
+            values = ", ".join(f"{v}" for v in block[row:row + 16])
+            lines.append(f"        {values},")
+        lines.append("    ]),")
+    lines.append(")")
+    lines.append("")
+    lines.append("REPLACEMENTS = (")
+    for text in replacements:
+        lines.append(f"    {text!r},")
+    lines.append(")")
+    lines.extend(
+        [
+            "",
+            "",
+            "def codepoint_class(cp: int) -> int:",
+            '    """Two-level lookup matching title_text_codepoint_class() in C."""',
+            "    if cp > 0xFFFF:",
+            "        return CLASS_DROP",
+            "    return PAGE_CLASSES[PAGE_INDEX[cp >> 8]][cp & 0xFF]",
+            "",
+        ]
+    )
+    return "\n".join(lines)
+
+
+def load_python_table(py_code: str) -> Dict[str, object]:
+    """Execute generated console_codepoint_table.py source and return its namespace."""
+    namespace: Dict[str, object] = {}
+    exec(compile(py_code, PY_OUTPUT_PATH, "exec"), namespace)
+    return namespace
+
+
+def generate_test_header(py_code: str) -> str:
+    """Runs of equal class over the BMP, as the Python table classifies them."""
+    table = load_python_table(py_code)
+    lookup = table["codepoint_class"]
+    runs: List[Tuple[int, int]] = []
+
+    for cp in range(BMP_PAGES * PAGE_SIZE):
+        value = lookup(cp)
+        if not runs or runs[-1][1] != value:
+            runs.append((cp, value))
+
+    lines = [
+        "// SPDX-License-Identifier: MIT",
+        "// Copyright (c) 2025 selloa",
+        "",
+        "#ifndef TESTS_CODEPOINT_CLASSES_H",
+        "#define TESTS_CODEPOINT_CLASSES_H",
+        "",
+        "// Class of every BMP code point according to scripts/console_codepoint_table.py,",
+        "// as runs starting at `first`. Regenerate via scripts/build_codepoint_table.py.",
+        "",
+        "typedef struct {",
+        "\tunsigned first;",
+        "\tunsigned char value;",
+        "} codepoint_class_run_t;",
+        "",
+        "static const codepoint_class_run_t codepoint_class_runs[] = {",
+    ]
+    for first, value in runs:
+        lines.append(f"\t{{ 0x{first:04X}, {value} }},")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const char *const codepoint_replacements[] = {")
+    for text in table["REPLACEMENTS"]:
+        lines.append(f"\t{c_string(text)},")
+    lines.append("};")
+    lines.append("")
+    lines.append("#endif")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def read_text(path: str) -> str:
+    try:
+        with open(path, encoding="utf-8") as handle:
+            return handle.read()
+    except OSError:
+        return ""
+
+
+def check_outputs(classes: List[int], c_code: str, py_code: str, test_code: str) -> int:
+    """Verify checked-in files are current and the Python table matches every BMP rule.
+
+    The compiled C table is checked against tests/codepoint_classes.h by the host tests.
+    """
+    failures = 0
+
+    if read_text(C_OUTPUT_PATH) != c_code:
+        print(f"Stale: {C_OUTPUT_PATH}")
+        failures += 1
+    if read_text(PY_OUTPUT_PATH) != py_code:
+        print(f"Stale: {PY_OUTPUT_PATH}")
+        failures += 1
+    if read_text(TEST_OUTPUT_PATH) != test_code:
+        print(f"Stale: {TEST_OUTPUT_PATH}")
+        failures += 1
+
+    lookup = load_python_table(read_text(PY_OUTPUT_PATH)).get("codepoint_class")
+    if lookup is None:
+        print("console_codepoint_table.py has no codepoint_class()")
+        return failures + 1
+
+    mismatches = [cp for cp in range(len(classes)) if lookup(cp) != classes[cp]]
+    if mismatches:
+        print(f"{len(mismatches)} BMP code points disagree, first U+{mismatches[0]:04X}")
+        failures += 1
+    if lookup(0x10000) != CLASS_DROP:
+        print("Non-BMP code points must be dropped")
+        failures += 1
+
+    if failures == 0:
+        print("OK: generated files are current and the Python table matches the rules for "
+              f"all {len(classes)} BMP code points (make test checks the C table)")
+    return 1 if failures else 0
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Build console codepoint tables")
+    parser.add_argument("--check", action="store_true", help="Verify outputs instead of writing them")
+    args = parser.parse_args()
+
+    try:
+        rules = parse_rules(RULES_PATH)
+        classes, replacements = build_classes(rules)
+    except (OSError, ValueError) as exc:
+        print(f"Error: {exc}")
+        return 1
+
+    page_index, blocks = build_page_table(classes)
+    c_code = generate_c_code(page_index, blocks, replacements)
+    py_code = generate_python_code(page_index, blocks, replacements)
+    test_code = generate_test_header(py_code)
+
+    if args.check:
+        return check_outputs(classes, c_code, py_code, test_code)
+
+    with open(C_OUTPUT_PATH, "w", encoding="utf-8") as handle:
+        handle.write(c_code)
+    with open(PY_OUTPUT_PATH, "w", encoding="utf-8") as handle:
+        handle.write(py_code)
+    with open(TEST_OUTPUT_PATH, "w", encoding="utf-8") as handle:
+        handle.write(test_code)
+
+    print(f"Wrote {len(blocks)} distinct pages, {len(replacements)} replacements")
+    print(f"  {C_OUTPUT_PATH}")
+    print(f"  {PY_OUTPUT_PATH}")
+    print(f"  {TEST_OUTPUT_PATH}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -7,42 +7,16 @@ This script cleans problematic characters that could cause display issues on 3DS
 import re
 import os
 import shutil
+import sys
 from datetime import datetime
 
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from title_db_common import clean_title_name, escape_c_string  # noqa: E402
+
 def clean_game_title(title):
-    """Clean a game title by replacing problematic characters"""
-    
-    # Replace trademark symbols
-    title = title.replace('™', '(TM)')
-    title = title.replace('®', '(R)')
-    
-    # Replace HTML line breaks with spaces
-    title = title.replace('<br>', ' ')
-    title = title.replace('<BR>', ' ')
-    
-    # Replace ampersands with 'and' for better readability
-    title = title.replace(' & ', ' and ')
-    
-    # Replace smart quotes with regular quotes
-    title = title.replace('"', '"')
-    title = title.replace('"', '"')
-    title = title.replace(''', "'")
-    title = title.replace(''', "'")
-    
-    # Replace em dashes with regular dashes
-    title = title.replace('—', '-')
-    title = title.replace('–', '-')
-    
-    # Replace ellipsis with three dots
-    title = title.replace('…', '...')
-    
-    # Clean up multiple spaces
-    title = re.sub(r'\s+', ' ', title)
-    
-    # Trim whitespace
-    title = title.strip()
-    
-    return title
+    """Clean a game title with the rules build_title_database.py applies (console_codepoints.txt)."""
+    return clean_title_name(title)
 
 def fix_database_file(input_file, output_file):
     """Fix the database file by cleaning all game titles"""
@@ -54,17 +28,15 @@ def fix_database_file(input_file, output_file):
     
     # Find all game title entries and clean them
     # Pattern: {0xXXXXXXXXXXXXXXULL, "Game Title"},
-    pattern = r'(\{0x[0-9A-Fa-f]{16}ULL, ")([^"]+)("(?:,|\}))'
+    pattern = r'(\{0x[0-9A-Fa-f]{16}ULL, ")((?:[^"\\]|\\.)+)("(?:,|\}))'
     
     def replace_title(match):
         title_id_part = match.group(1)
         original_title = match.group(2)
         closing_part = match.group(3)
         
-        cleaned_title = clean_game_title(original_title)
-        
-        # Escape quotes in the cleaned title
-        escaped_title = cleaned_title.replace('"', '\\"')
+        cleaned_title = clean_game_title(original_title.replace('\\"', '"').replace('\\\\', '\\'))
+        escaped_title = escape_c_string(cleaned_title)
         
         return f'{title_id_part}{escaped_title}{closing_part}'
     
@@ -2,24 +2,42 @@
 
 import os
 import re
+import sys
 from typing import Dict, List, Tuple
 
+# The generated table sits next to this file; import it whatever the working directory.
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from console_codepoint_table import (  # noqa: E402
+    CLASS_KEEP,
+    CLASS_REPLACE,
+    REPLACEMENTS,
+    codepoint_class,
+)
+
 UPDATE_NAME_RE = re.compile(r"\bupdate\b", re.IGNORECASE)
 BASE_TITLE_PREFIX = "00040000"
 CTR_TITLE_PREFIX = "0004"
 
 
+def apply_console_codepoint_rules(name: str) -> str:
+    """Per-codepoint drop/replace rules shared with the on-device sanitizer."""
+    out = []
+    for ch in name:
+        cls = codepoint_class(ord(ch))
+        if cls == CLASS_KEEP:
+            out.append(ch)
+        elif cls >= CLASS_REPLACE:
+            out.append(REPLACEMENTS[cls - CLASS_REPLACE])
+    return "".join(out)
+
+
 def clean_title_name(name: str) -> str:
     """Normalize characters that display poorly on the 3DS console."""
-    name = name.replace("™", "(TM)")
-    name = name.replace("®", "(R)")
     name = name.replace("<br>", " ")
     name = name.replace("<BR>", " ")
     name = name.replace(" & ", " and ")
-    name = name.replace("\u201c", '"').replace("\u201d", '"')
-    name = name.replace("\u2018", "'").replace("\u2019", "'")
-    name = name.replace("\u2014", "-").replace("\u2013", "-")
-    name = name.replace("\u2026", "...")
+    name = apply_console_codepoint_rules(name)
     name = re.sub(r"\s+", " ", name)
     return name.strip()
 
@@ -100,15 +118,21 @@ def generate_c_code(titles: List[Tuple[str, str]], source_comment: str) -> str:
         [
             "};",
             "",
+            "// Entries are emitted sorted by title ID.",
             "const char* lookup_game_name(u64 title_id) {",
-            "    u32 database_size = get_database_size();",
+            "    u32 lo = 0;",
+            "    u32 hi = get_database_size();",
             "",
-            "    for (u32 i = 0; i < database_size; i++) {",
-            "        if (title_database[i].title_id == title_id) {",
-            "            return title_database[i].game_name;",
-            "        }",
+            "    while (lo < hi) {",
+            "        u32 mid = lo + (hi - lo) / 2;",
+            "        if (title_database[mid].title_id < title_id)",
+            "            lo = mid + 1;",
+            "        else",
+            "            hi = mid;",
             "    }",
             "",
+            "    if (lo < get_database_size() && title_database[lo].title_id == title_id)",
+            "        return title_database[lo].game_name;",
             "    return NULL;",
             "}",
             "",
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "frame.h"
+
+#include "perf.h"
+#include "ui_grid.h"
+
+#include <string.h>
+
+typedef struct {
+	frame_task_fn fn;
+	void *ctx;
+} frame_task_t;
+
+static frame_task_t g_tasks[FRAME_TASK_MAX];
+static u32 g_taskCount = 0;
+/* Round-robin position, so one long-running task cannot starve the others. */
+static u32 g_nextTask = 0;
+static u64 g_frameStart = 0;
+/* Consecutive calls with no drawing, queued work or held keys. */
+static u32 g_quietFrames = 0;
+
+static frame_stats_t g_stats;
+static frame_stats_t g_window;
+static u64 g_windowStart = 0;
+static u64 g_busyTicks = 0;
+
+static s32 frame_task_find(frame_task_fn fn, void *ctx)
+{
+	u32 i;
+
+	for (i = 0; i < g_taskCount; i++) {
+		if (g_tasks[i].fn == fn && g_tasks[i].ctx == ctx)
+			return (s32)i;
+	}
+
+	return -1;
+}
+
+static void frame_task_remove_at(u32 index)
+{
+	u32 i;
+
+	for (i = index; i + 1 < g_taskCount; i++)
+		g_tasks[i] = g_tasks[i + 1];
+	g_taskCount--;
+
+	if (g_nextTask > index)
+		g_nextTask--;
+	if (g_nextTask >= g_taskCount)
+		g_nextTask = 0;
+}
+
+bool frame_task_add(frame_task_fn fn, void *ctx)
+{
+	if (fn == NULL)
+		return false;
+	if (frame_task_find(fn, ctx) >= 0)
+		return true;
+	if (g_taskCount >= FRAME_TASK_MAX)
+		return false;
+
+	g_tasks[g_taskCount].fn = fn;
+	g_tasks[g_taskCount].ctx = ctx;
+	g_taskCount++;
+	return true;
+}
+
+void frame_task_cancel(frame_task_fn fn, void *ctx)
+{
+	s32 index = frame_task_find(fn, ctx);
+
+	if (index >= 0)
+		frame_task_remove_at((u32)index);
+}
+
+bool frame_task_queued(frame_task_fn fn, void *ctx)
+{
+	return frame_task_find(fn, ctx) >= 0;
+}
+
+/* Run one slice of the next task; returns false once the queue is empty. */
+static bool frame_task_step(void)
+{
+	frame_task_t task;
+
+	if (g_taskCount == 0)
+		return false;
+
+	task = g_tasks[g_nextTask];
+	if (task.fn(task.ctx)) {
+		g_nextTask = (g_nextTask + 1) % g_taskCount;
+	} else {
+		/* The task may have queued or cancelled others; find it again before removing it. */
+		s32 index = frame_task_find(task.fn, task.ctx);
+
+		if (index >= 0)
+			frame_task_remove_at((u32)index);
+	}
+
+	return g_taskCount > 0;
+}
+
+void frame_task_flush(void)
+{
+	while (frame_task_step())
+		;
+}
+
+static void frame_stats_account(bool rendered, u32 vblanks)
+{
+	u64 now = perf_now();
+	u64 elapsed;
+
+	if (rendered) {
+		g_window.rendered++;
+		vblanks--;
+	}
+	g_window.skipped += vblanks;
+
+	elapsed = now - g_windowStart;
+	if (elapsed < perf_ticks_from_us(1000000))
+		return;
+
+	g_window.cpu_permille = (u32)(g_busyTicks * 1000 / elapsed);
+	g_stats = g_window;
+	memset(&g_window, 0, sizeof(g_window));
+	g_busyTicks = 0;
+	g_windowStart = now;
+}
+
+u32 frame_next(void)
+{
+	u64 budget = perf_ticks_from_us(FRAME_TASK_BUDGET_US);
+	bool dirty;
+	bool busy;
+	u32 vblanks = 1;
+	u32 i;
+
+	if (g_frameStart == 0) {
+		g_frameStart = perf_now();
+		g_windowStart = g_frameStart;
+	}
+
+	/* Present whatever was drawn this frame before spending the idle time. */
+	ui_grid_flush();
+	dirty = ui_grid_last_flush()->cells > 0;
+	busy = dirty || g_taskCount > 0;
+
+	while (g_taskCount > 0 && perf_now() - g_frameStart < budget)
+		frame_task_step();
+
+	if (busy || hidKeysHeld() != 0)
+		g_quietFrames = 0;
+	else if (g_quietFrames < FRAME_IDLE_AFTER_FRAMES)
+		g_quietFrames++;
+	if (g_quietFrames >= FRAME_IDLE_AFTER_FRAMES)
+		vblanks = FRAME_IDLE_POLL_VBLANKS;
+
+	/* Everything since the last wake-up counts as busy; the waits below are the idle time. */
+	g_busyTicks += perf_now() - g_frameStart;
+	for (i = 0; i < vblanks; i++)
+		gspWaitForVBlank();
+	if (dirty) {
+		gfxFlushBuffers();
+		gfxSwapBuffers();
+	}
+	hidScanInput();
+	g_frameStart = perf_now();
+	frame_stats_account(dirty, vblanks);
+
+	return hidKeysDown();
+}
+
+const frame_stats_t *frame_stats(void)
+{
+	return &g_stats;
+}
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+/* Queued work may use about a quarter of each 60 Hz frame before the VBlank wait. */
+#define FRAME_TASK_BUDGET_US 4000
+#define FRAME_TASK_MAX 8
+
+/* With nothing drawn, queued or pressed for a second, input is polled every third VBlank. */
+#define FRAME_IDLE_AFTER_FRAMES 60
+#define FRAME_IDLE_POLL_VBLANKS 3
+
+/// Main-loop activity over the last full second.
+typedef struct {
+	u32 rendered;
+	/* VBlanks that passed without a swap because nothing changed. */
+	u32 skipped;
+	/* Main-thread time spent outside VBlank waits, in tenths of a percent. */
+	u32 cpu_permille;
+} frame_stats_t;
+
+/// One slice of deferred main-thread work. Return true while work remains; false retires the task.
+typedef bool (*frame_task_fn)(void *ctx);
+
+/// Queue a task. Adding a fn/ctx pair that is already queued is a no-op (repeated requests
+/// coalesce). Returns false when the queue is full.
+bool frame_task_add(frame_task_fn fn, void *ctx);
+
+/// Drop a queued task without running it.
+void frame_task_cancel(frame_task_fn fn, void *ctx);
+
+bool frame_task_queued(frame_task_fn fn, void *ctx);
+
+/// Run every queued task to completion, ignoring the budget (e.g. before exit).
+void frame_task_flush(void);
+
+/// Finish the current frame: flush the text grid to the console, run queued tasks round-robin until the budget (measured from
+/// the previous VBlank) is spent, then wait for VBlank and scan input. Buffers are swapped only when the flush changed
+/// something; once the loop has been idle for FRAME_IDLE_AFTER_FRAMES it waits FRAME_IDLE_POLL_VBLANKS per call.
+/// Returns hidKeysDown(); hidKeysHeld() is valid afterwards too.
+u32 frame_next(void);
+
+/// Counters for the last completed one-second window (all zero during the first second).
+const frame_stats_t *frame_stats(void);
+
+#endif
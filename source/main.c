@@ -6,11 +6,23 @@
 #include <string.h>
 #include <3ds.h>
 #include <time.h>
+#include "title_banner.h"
+#include "title_browser.h"
 #include "title_database.h"
+#include "title_histogram.h"
+#include "title_icon.h"
+#include "title_index.h"
 #include "title_meta.h"
 #include "title_picker.h"
+#include "title_scan.h"
+#include "title_search.h"
 #include "title_smdh.h"
+#include "title_snapshot.h"
+#include "title_stats.h"
 #include "ui.h"
+#include "ui_grid.h"
+#include "frame.h"
+#include "perf.h"
 #include "settings.h"
 
 #define FILTER_ROW_NATIVE 0
@@ -23,51 +35,191 @@
 #define FILTER_ROW_SYSTEM 7
 #define FILTER_ROW_SD 8
 #define FILTER_ROW_NAND 9
-#define FILTER_ROW_LONG_NAME 10
-#define FILTER_ROW_HOMEBREW 11
-#define FILTER_ROW_DEFAULTS 12
-#define FILTER_ROW_COUNT 13
+#define FILTER_ROW_GAME_CARD 10
+#define FILTER_ROW_LONG_NAME 11
+#define FILTER_ROW_HOMEBREW 12
+#define FILTER_ROW_PERF_LOG 13
+#define FILTER_ROW_INSTANT 14
+#define FILTER_ROW_DEFAULTS 15
+#define FILTER_ROW_COUNT 16
+
+/* Redraw the cold-start scan progress every few frames while the workers run. */
+#define SCAN_PROGRESS_REDRAW_FRAMES 6
+
+/* Held at boot to flip the instant-launch setting for this run. */
+#define INSTANT_LAUNCH_TOGGLE_KEY KEY_R
+/* Holding B during this many frames (about half a second) falls back to the normal UI. */
+#define INSTANT_LAUNCH_CANCEL_FRAMES 30
+#define INDEX_PROGRESS_REDRAW_FRAMES 30
+
+/* Browser D-pad auto-repeat, in frames. */
+#define BROWSER_REPEAT_DELAY 15
+#define BROWSER_REPEAT_INTERVAL 3
+
+#ifndef APP_VERSION
+#define APP_VERSION "0.0.0"
+#endif
 
 static bool g_include_homebrew = false;
 static bool g_include_sd = true;
 static bool g_include_nand = false;
+static bool g_include_game_card = false;
 static bool g_prefer_long_name = false;
+static bool g_log_startup_times = false;
+static bool g_instant_launch = false;
+static bool g_console_ready = false;
 static title_filter_options_t g_filters = { false, false, false, false, false, false, true, true };
-static u32 g_sd_title_count = 0;
-static u32 g_nand_title_count = 0;
 static u32 g_eligible_title_count = 0;
 static u32 g_active_title_count = 0;
-static u64 g_sd_titles[TITLE_SCAN_MAX];
-static u64 g_nand_titles[TITLE_SCAN_MAX];
+static title_scan_t g_sd_scan;
+static title_scan_t g_nand_scan;
+static title_scan_t g_card_scan;
+/* TITLE_SNAPSHOT_MEDIA_BIT per listed media; the others are scanned the first time they are enabled. */
+static u32 g_scanned_media = 0;
+/* Set whenever state stored in the library snapshot changes; saved on exit. */
+static bool g_snapshot_dirty = false;
+static u32 g_snapshot_index_count = 0;
 static title_source_t g_active_titles[TITLE_PICKER_POOL_MAX];
+/* Aggregates over g_active_titles, updated as the list is built; read by the LIBRARY page. */
+static title_stats_t g_library_stats;
+/* Every scanned title by filter traits and media, recounted with the active list; the options
+ * menu sums it to preview pool sizes without rebuilding the pool. */
+static title_histogram_t g_histogram;
+/* Sorted view of the pool for the bottom-screen browser; on-demand names persist across opens. */
+static title_browser_t g_browser;
+/* Name search over g_browser's entries (entry i is sorted position i); built on the first Y per open. */
+static title_search_t g_search;
+static bool g_search_ready = false;
 
 typedef struct {
 	title_pick_t pick;
 	u32 page;
+	title_banner_t banner;
 } picked_view_t;
 
-static u32 build_active_title_list(void)
+/* Laid-out text of each page for the current pick, so L/R only copies a grid. */
+static ui_grid_t g_page_grids[UI_PAGE_COUNT];
+static bool g_page_ready[UI_PAGE_COUNT];
+
+/* Called whenever the pick or anything the pages show (filters, pool, stats) changes. */
+static void invalidate_pages(void)
+{
+	memset(g_page_ready, 0, sizeof(g_page_ready));
+}
+
+static title_scan_t *scan_for_media(FS_MediaType media)
+{
+	switch (media) {
+	case MEDIATYPE_NAND:
+		return &g_nand_scan;
+	case MEDIATYPE_GAME_CARD:
+		return &g_card_scan;
+	default:
+		return &g_sd_scan;
+	}
+}
+
+static bool media_scanned(FS_MediaType media)
+{
+	return (g_scanned_media & TITLE_SNAPSHOT_MEDIA_BIT(media)) != 0;
+}
+
+/* List a media the first time a source needs it (no-op afterwards). */
+static Result scan_media_once(FS_MediaType media)
+{
+	Result res;
+
+	if (media_scanned(media))
+		return 0;
+
+	res = title_scan_media(scan_for_media(media), media);
+	/* Marked even on failure (e.g. no card inserted) so rebuilds don't retry on every toggle. */
+	g_scanned_media |= TITLE_SNAPSHOT_MEDIA_BIT(media);
+	return res;
+}
+
+/* Every path that changes the card setting goes through here: turning it off forgets the card's
+ * list, so it is re-read the next time it is enabled (the card may have been swapped meanwhile). */
+static void set_include_game_card(bool include)
+{
+	g_include_game_card = include;
+	if (!include) {
+		g_scanned_media &= ~TITLE_SNAPSHOT_MEDIA_BIT(MEDIATYPE_GAME_CARD);
+		g_card_scan.count = 0;
+	}
+}
+
+static bool scan_jobs_done(const title_scan_job_t *jobs, u32 jobCount)
 {
 	u32 i;
-	u32 n = 0;
 
-	if (g_include_sd) {
-		for (i = 0; i < g_sd_title_count && n < TITLE_PICKER_POOL_MAX; i++) {
-			g_active_titles[n].titleId = g_sd_titles[i];
-			g_active_titles[n].media = MEDIATYPE_SD;
-			n++;
-		}
+	for (i = 0; i < jobCount; i++) {
+		if (!title_scan_job_done(&jobs[i]))
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Cold start: each enabled media is listed on its own worker while this thread shows progress.
+ * The lists are merged (and deduped) afterwards by build_active_title_list. Returns the SD
+ * result, the only media whose failure is fatal.
+ */
+static Result scan_enabled_media_parallel(void)
+{
+	title_scan_job_t jobs[UI_SOURCE_COUNT];
+	u32 jobCount = 0;
+	u32 frames = 0;
+	Result sdResult = 0;
+	u32 i;
+
+	if (g_include_sd && !media_scanned(MEDIATYPE_SD))
+		title_scan_job_start(&jobs[jobCount++], &g_sd_scan, MEDIATYPE_SD);
+	if (g_include_nand && !media_scanned(MEDIATYPE_NAND))
+		title_scan_job_start(&jobs[jobCount++], &g_nand_scan, MEDIATYPE_NAND);
+	if (g_include_game_card && !media_scanned(MEDIATYPE_GAME_CARD))
+		title_scan_job_start(&jobs[jobCount++], &g_card_scan, MEDIATYPE_GAME_CARD);
+
+	while (!scan_jobs_done(jobs, jobCount)) {
+		/* Instant launch never set up the console; just wait. */
+		if (g_console_ready && frames++ % SCAN_PROGRESS_REDRAW_FRAMES == 0)
+			ui_draw_scan_progress(jobs, jobCount);
+		frame_next();
+	}
+
+	for (i = 0; i < jobCount; i++) {
+		Result res = title_scan_job_finish(&jobs[i]);
+
+		g_scanned_media |= TITLE_SNAPSHOT_MEDIA_BIT(jobs[i].media);
+		if (jobs[i].media == MEDIATYPE_SD)
+			sdResult = res;
 	}
 
-	if (!g_include_nand)
-		return n;
+	return sdResult;
+}
 
-	for (i = 0; i < g_nand_title_count && n < TITLE_PICKER_POOL_MAX; i++) {
+static void scan_enabled_media(void)
+{
+	if (g_include_sd)
+		scan_media_once(MEDIATYPE_SD);
+	if (g_include_nand)
+		scan_media_once(MEDIATYPE_NAND);
+	if (g_include_game_card)
+		scan_media_once(MEDIATYPE_GAME_CARD);
+}
+
+/* Append one media's titles, skipping IDs already listed from an earlier media when dedupe is set. */
+static u32 append_scanned_titles(const title_scan_t *scan, FS_MediaType media, u32 n, bool dedupe)
+{
+	u32 i;
+
+	for (i = 0; i < scan->count && n < TITLE_PICKER_POOL_MAX; i++) {
 		u32 j;
 		bool duplicate = false;
 
-		for (j = 0; j < n; j++) {
-			if (g_active_titles[j].titleId == g_nand_titles[i]) {
+		for (j = 0; dedupe && j < n; j++) {
+			if (g_active_titles[j].titleId == scan->titles[i]) {
 				duplicate = true;
 				break;
 			}
@@ -75,36 +227,200 @@ static u32 build_active_title_list(void)
 		if (duplicate)
 			continue;
 
-		g_active_titles[n].titleId = g_nand_titles[i];
-		g_active_titles[n].media = MEDIATYPE_NAND;
+		g_active_titles[n].titleId = scan->titles[i];
+		g_active_titles[n].media = media;
+		title_stats_add(&g_library_stats, scan->titles[i], media, scan->sizes[i]);
 		n++;
 	}
 
 	return n;
 }
 
-static void rebuild_eligible_pool(title_picker_pool_t *pool)
+static void count_scanned_titles(void)
+{
+	const title_scan_t *scans[TITLE_HISTOGRAM_MEDIA_COUNT];
+
+	scans[MEDIATYPE_NAND] = &g_nand_scan;
+	scans[MEDIATYPE_SD] = &g_sd_scan;
+	scans[MEDIATYPE_GAME_CARD] = &g_card_scan;
+	title_histogram_build(&g_histogram, scans, g_scanned_media);
+}
+
+static u32 build_active_title_list(void)
+{
+	u32 n = 0;
+
+	count_scanned_titles();
+	title_stats_reset(&g_library_stats);
+
+	if (g_include_sd)
+		n = append_scanned_titles(&g_sd_scan, MEDIATYPE_SD, n, false);
+	if (g_include_nand)
+		n = append_scanned_titles(&g_nand_scan, MEDIATYPE_NAND, n, true);
+	if (g_include_game_card)
+		n = append_scanned_titles(&g_card_scan, MEDIATYPE_GAME_CARD, n, true);
+
+	return n;
+}
+
+static void rebuild_eligible_pool_seeded(title_picker_pool_t *pool, const title_index_entry_t *seed,
+	u32 seedCount)
 {
+	scan_enabled_media();
 	g_active_title_count = build_active_title_list();
+	title_index_sync_seeded(g_active_titles, g_active_title_count, seed, seedCount);
 	title_picker_rebuild_pool(pool, g_active_titles, g_active_title_count, &g_filters, g_include_homebrew);
 	g_eligible_title_count = pool->count;
+	g_snapshot_dirty = true;
+	invalidate_pages();
+}
+
+static void rebuild_eligible_pool(title_picker_pool_t *pool)
+{
+	rebuild_eligible_pool_seeded(pool, NULL, 0);
+}
+
+/* Everything the active list and pool depend on; a mismatch invalidates the saved pool. */
+static u32 settings_fingerprint(void)
+{
+	u8 bytes[4 + sizeof(title_filter_options_t)];
+	u32 hash = 0x811C9DC5u;
+	size_t i;
+
+	bytes[0] = g_include_sd;
+	bytes[1] = g_include_nand;
+	bytes[2] = g_include_homebrew;
+	bytes[3] = g_include_game_card;
+	memcpy(bytes + 4, &g_filters, sizeof(g_filters));
+
+	for (i = 0; i < sizeof(bytes); i++) {
+		hash ^= bytes[i];
+		hash *= 0x01000193u;
+	}
+
+	return hash;
+}
+
+static title_snapshot_t make_snapshot(title_picker_pool_t *pool)
+{
+	title_snapshot_t snapshot;
+
+	memset(&snapshot, 0, sizeof(snapshot));
+	snapshot.sd = &g_sd_scan;
+	snapshot.nand = &g_nand_scan;
+	snapshot.active = g_active_titles;
+	snapshot.active_count = &g_active_title_count;
+	snapshot.stats = &g_library_stats;
+	snapshot.pool = pool;
+	/* The game card list is never stored: it may be swapped before the next launch. */
+	snapshot.media_mask = g_scanned_media &
+		(TITLE_SNAPSHOT_MEDIA_BIT(MEDIATYPE_SD) | TITLE_SNAPSHOT_MEDIA_BIT(MEDIATYPE_NAND));
+	snapshot.settings_hash = settings_fingerprint();
+	return snapshot;
+}
+
+/* Warm start: restore the scan and pool from SD when AM still reports the same title counts. */
+static bool load_library_snapshot(title_picker_pool_t *pool)
+{
+	title_snapshot_t snapshot = make_snapshot(pool);
+	title_snapshot_result_t result;
+	u32 sdCount = 0;
+	u32 nandCount = 0;
+
+	if (R_FAILED(AM_GetTitleCount(MEDIATYPE_SD, &sdCount)))
+		return false;
+	if (R_FAILED(AM_GetTitleCount(MEDIATYPE_NAND, &nandCount)))
+		nandCount = 0;
+
+	/* The scan keeps at most TITLE_SCAN_MAX titles per media. */
+	if (sdCount > TITLE_SCAN_MAX)
+		sdCount = TITLE_SCAN_MAX;
+	if (nandCount > TITLE_SCAN_MAX)
+		nandCount = TITLE_SCAN_MAX;
+
+	/* With the card enabled the saved active list cannot be trusted; rebuild it after reading the card. */
+	if (g_include_game_card)
+		snapshot.pool = NULL;
+
+	result = title_snapshot_load(&snapshot, sdCount, nandCount);
+	if (result == TITLE_SNAPSHOT_OK || result == TITLE_SNAPSHOT_LISTS_ONLY) {
+		g_scanned_media = snapshot.media_mask;
+	} else {
+		/* A rejected file may have been partially read into the lists. */
+		g_scanned_media = 0;
+		g_sd_scan.count = 0;
+		g_nand_scan.count = 0;
+	}
+
+	if (result == TITLE_SNAPSHOT_OK) {
+		g_eligible_title_count = pool->count;
+		count_scanned_titles();
+		title_index_sync_seeded(g_active_titles, g_active_title_count, snapshot.entries,
+			snapshot.entry_count);
+		g_snapshot_dirty = false;
+	} else if (result == TITLE_SNAPSHOT_LISTS_ONLY) {
+		rebuild_eligible_pool_seeded(pool, snapshot.entries, snapshot.entry_count);
+	}
+
+	g_snapshot_index_count = title_index_done_count();
+	free(snapshot.entries);
+	return result == TITLE_SNAPSHOT_OK || result == TITLE_SNAPSHOT_LISTS_ONLY;
+}
+
+static void save_library_snapshot(title_picker_pool_t *pool)
+{
+	title_snapshot_t snapshot = make_snapshot(pool);
+
+	/* Called after title_index_stop(): completed entries are stable. */
+	if (!g_snapshot_dirty && title_index_done_count() == g_snapshot_index_count)
+		return;
+
+	snapshot.entries = (title_index_entry_t *)title_index_entries();
+	snapshot.entry_count = title_index_done_count();
+	title_snapshot_save(&snapshot);
+}
+
+/* Returns true when the background rescan found a different library and the pool was rebuilt. */
+static bool apply_library_refresh(title_picker_pool_t *pool)
+{
+	if (title_scan_refresh_poll() != TITLE_SCAN_REFRESH_CHANGED)
+		return false;
+
+	title_scan_refresh_take(&g_sd_scan, &g_nand_scan);
+	rebuild_eligible_pool(pool);
+	return true;
+}
+
+static void fill_ui_source(ui_source_t *sources, FS_MediaType media, bool included)
+{
+	sources[media].title_count = scan_for_media(media)->count;
+	sources[media].included = included;
+	sources[media].scanned = media_scanned(media);
+}
+
+static void fill_ui_sources(ui_source_t *sources)
+{
+	fill_ui_source(sources, MEDIATYPE_SD, g_include_sd);
+	fill_ui_source(sources, MEDIATYPE_NAND, g_include_nand);
+	fill_ui_source(sources, MEDIATYPE_GAME_CARD, g_include_game_card);
 }
 
-static ui_view_t make_ui_view(const picked_view_t *view)
+static ui_view_t make_ui_view(picked_view_t *view)
 {
 	ui_view_t ui;
 
 	memset(&ui, 0, sizeof(ui));
 	ui.pick = &view->pick;
 	ui.page = view->page;
-	ui.sd_title_count = g_sd_title_count;
-	ui.nand_title_count = g_nand_title_count;
+	fill_ui_sources(ui.sources);
 	ui.active_title_count = g_active_title_count;
 	ui.eligible_title_count = g_eligible_title_count;
-	ui.include_sd = g_include_sd;
-	ui.include_nand = g_include_nand;
 	ui.include_homebrew = g_include_homebrew;
 	ui.filters = &g_filters;
+	ui.index_done_count = title_index_done_count();
+	ui.index_total_count = title_index_total_count();
+	ui.am_call_count = title_meta_am_call_count();
+	ui.stats = &g_library_stats;
 	return ui;
 }
 
@@ -116,7 +432,10 @@ static void apply_launcher_settings(const launcher_settings_t *settings)
 	g_include_homebrew = settings->include_unlisted;
 	g_include_sd = settings->include_sd;
 	g_include_nand = settings->include_nand;
+	set_include_game_card(settings->include_game_card);
 	g_prefer_long_name = settings->prefer_long_name;
+	g_log_startup_times = settings->log_startup_times;
+	g_instant_launch = settings->instant_launch;
 	g_filters = settings->filters;
 }
 
@@ -128,7 +447,10 @@ static void read_launcher_settings(launcher_settings_t *settings)
 	settings->include_unlisted = g_include_homebrew;
 	settings->include_sd = g_include_sd;
 	settings->include_nand = g_include_nand;
+	settings->include_game_card = g_include_game_card;
 	settings->prefer_long_name = g_prefer_long_name;
+	settings->log_startup_times = g_log_startup_times;
+	settings->instant_launch = g_instant_launch;
 	settings->filters = g_filters;
 }
 
@@ -153,18 +475,14 @@ static void persist_launcher_settings(void)
 
 static bool run_restore_defaults_confirm(void)
 {
-	consoleClear();
-	printf("\n\x1b[37mRestore defaults?\x1b[0m\n\n");
-	printf("Resets all options and deletes\n");
-	printf("your saved settings file.\n\n");
-	printf("\x1b[37mA\x1b[0m Confirm   \x1b[37mB\x1b[0m Cancel\n");
+	ui_grid_clear();
+	ui_printf("\n\x1b[37mRestore defaults?\x1b[0m\n\n");
+	ui_printf("Resets all options and deletes\n");
+	ui_printf("your saved settings file.\n\n");
+	ui_printf("\x1b[37mA\x1b[0m Confirm   \x1b[37mB\x1b[0m Cancel\n");
 
 	while (aptMainLoop()) {
-		gspWaitForVBlank();
-		gfxSwapBuffers();
-		hidScanInput();
-
-		u32 kDown = hidKeysDown();
+		u32 kDown = frame_next();
 
 		if (kDown & KEY_A)
 			return true;
@@ -175,11 +493,55 @@ static bool run_restore_defaults_confirm(void)
 	return false;
 }
 
-static void print_picked_view(const picked_view_t *view)
+/*
+ * One page per slice. TECHNICAL is skipped: laying it out needs the lazy AM queries and the
+ * banner read, which only happen once that page is actually opened.
+ */
+static bool layout_pages_task(void *ctx)
+{
+	picked_view_t *view = (picked_view_t *)ctx;
+	u32 page;
+
+	for (page = 0; page < UI_PAGE_COUNT; page++) {
+		ui_view_t ui;
+
+		if (page == UI_PAGE_TECHNICAL || g_page_ready[page])
+			continue;
+
+		ui = make_ui_view(view);
+		ui.page = page;
+		ui_layout_main_screen(&ui, &g_page_grids[page]);
+		g_page_ready[page] = true;
+		return true;
+	}
+
+	return false;
+}
+
+static void print_picked_view(picked_view_t *view)
 {
 	ui_view_t ui = make_ui_view(view);
 
-	ui_draw_main_screen(&ui);
+	/* Product code and extdata ID are only shown on TECHNICAL; fetched once per pick. */
+	if (view->page == UI_PAGE_TECHNICAL)
+		title_meta_load_lazy(view->pick.titleId, view->pick.media, &view->pick.meta);
+
+	/* The banner is only read on DETAILS/TECHNICAL; title_banner_load caches per title. */
+	if (view->page == UI_PAGE_DETAILS || view->page == UI_PAGE_TECHNICAL) {
+		title_index_pause();
+		title_banner_load(view->pick.titleId, view->pick.media, &view->banner);
+		title_index_resume();
+		ui.banner = &view->banner;
+	}
+
+	if (!g_page_ready[view->page]) {
+		ui_layout_main_screen(&ui, &g_page_grids[view->page]);
+		g_page_ready[view->page] = true;
+	}
+	ui_present_main_screen(&ui, &g_page_grids[view->page]);
+
+	/* Lay out the remaining pages in idle frame time while this one is read. */
+	frame_task_add(layout_pages_task, view);
 }
 
 static bool filter_row_enabled(u32 row)
@@ -205,10 +567,16 @@ static bool filter_row_enabled(u32 row)
 		return g_include_sd;
 	case FILTER_ROW_NAND:
 		return g_include_nand;
+	case FILTER_ROW_GAME_CARD:
+		return g_include_game_card;
 	case FILTER_ROW_LONG_NAME:
 		return g_prefer_long_name;
 	case FILTER_ROW_HOMEBREW:
 		return g_include_homebrew;
+	case FILTER_ROW_PERF_LOG:
+		return g_log_startup_times;
+	case FILTER_ROW_INSTANT:
+		return g_instant_launch;
 	default:
 		return false;
 	}
@@ -247,12 +615,21 @@ static void toggle_filter_row(u32 row)
 	case FILTER_ROW_NAND:
 		g_include_nand = !g_include_nand;
 		break;
+	case FILTER_ROW_GAME_CARD:
+		set_include_game_card(!g_include_game_card);
+		break;
 	case FILTER_ROW_LONG_NAME:
 		g_prefer_long_name = !g_prefer_long_name;
 		break;
 	case FILTER_ROW_HOMEBREW:
 		g_include_homebrew = !g_include_homebrew;
 		break;
+	case FILTER_ROW_PERF_LOG:
+		g_log_startup_times = !g_log_startup_times;
+		break;
+	case FILTER_ROW_INSTANT:
+		g_instant_launch = !g_instant_launch;
+		break;
 	default:
 		break;
 	}
@@ -281,10 +658,16 @@ static const char *filter_row_label(u32 row)
 		return "SD titles";
 	case FILTER_ROW_NAND:
 		return "NAND titles";
+	case FILTER_ROW_GAME_CARD:
+		return "Game card";
 	case FILTER_ROW_LONG_NAME:
 		return "Long game name";
 	case FILTER_ROW_HOMEBREW:
 		return "Unlisted only";
+	case FILTER_ROW_PERF_LOG:
+		return "Log startup times";
+	case FILTER_ROW_INSTANT:
+		return "Instant launch";
 	case FILTER_ROW_DEFAULTS:
 		return "Restore defaults";
 	default:
@@ -297,52 +680,156 @@ static bool filter_row_is_action(u32 row)
 	return row == FILTER_ROW_DEFAULTS;
 }
 
-static void draw_filter_menu(u32 cursor, const title_picker_pool_t *pool)
+/* The settings the pool depends on, so the menu can preview a toggle without applying it. */
+typedef struct {
+	title_filter_options_t filters;
+	bool include_homebrew;
+	/* TITLE_HISTOGRAM_MEDIA_BIT per included media. */
+	u32 media_mask;
+} pool_settings_t;
+
+static pool_settings_t current_pool_settings(void)
 {
-	ui_draw_filter_menu(cursor, FILTER_ROW_COUNT, pool->count, filter_row_enabled,
-		filter_row_label, filter_row_is_action);
+	pool_settings_t settings;
+
+	settings.filters = g_filters;
+	settings.include_homebrew = g_include_homebrew;
+	settings.media_mask = (g_include_sd ? TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_SD) : 0) |
+		(g_include_nand ? TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_NAND) : 0) |
+		(g_include_game_card ? TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_GAME_CARD) : 0);
+	return settings;
 }
 
-static bool run_filter_menu(title_picker_pool_t *pool)
+/* Flip a row's setting in settings; false for rows that do not change the pool. */
+static bool toggle_pool_setting(pool_settings_t *settings, u32 row)
+{
+	title_filter_options_t *filters = &settings->filters;
+
+	switch (row) {
+	case FILTER_ROW_NATIVE:
+		filters->include_native_apps = !filters->include_native_apps;
+		return true;
+	case FILTER_ROW_VC:
+		filters->include_virtual_console = !filters->include_virtual_console;
+		return true;
+	case FILTER_ROW_DSIWARE:
+		filters->include_dsiware = !filters->include_dsiware;
+		return true;
+	case FILTER_ROW_DEMOS:
+		filters->include_demos = !filters->include_demos;
+		return true;
+	case FILTER_ROW_CONTENT:
+		filters->include_content_packs = !filters->include_content_packs;
+		return true;
+	case FILTER_ROW_DLC:
+		filters->include_dlc = !filters->include_dlc;
+		return true;
+	case FILTER_ROW_PATCHES:
+		filters->include_patches = !filters->include_patches;
+		return true;
+	case FILTER_ROW_SYSTEM:
+		filters->include_system = !filters->include_system;
+		return true;
+	case FILTER_ROW_SD:
+		settings->media_mask ^= TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_SD);
+		return true;
+	case FILTER_ROW_NAND:
+		settings->media_mask ^= TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_NAND);
+		return true;
+	case FILTER_ROW_GAME_CARD:
+		settings->media_mask ^= TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_GAME_CARD);
+		return true;
+	case FILTER_ROW_HOMEBREW:
+		settings->include_homebrew = !settings->include_homebrew;
+		return true;
+	default:
+		return false;
+	}
+}
+
+/* Pool size for settings from the histogram; false when an included media has not been listed yet. */
+static bool preview_pool_count(const pool_settings_t *settings, u32 *outCount)
+{
+	u32 count = title_histogram_count(&g_histogram, &settings->filters, settings->include_homebrew,
+		settings->media_mask);
+
+	*outCount = count < TITLE_PICKER_POOL_MAX ? count : TITLE_PICKER_POOL_MAX;
+	return (settings->media_mask & ~g_histogram.media_mask) == 0;
+}
+
+static bool filter_row_delta(u32 row, s32 *delta)
+{
+	pool_settings_t current = current_pool_settings();
+	pool_settings_t toggled = current;
+	u32 currentCount;
+	u32 toggledCount;
+
+	if (!toggle_pool_setting(&toggled, row))
+		return false;
+
+	if (preview_pool_count(&current, &currentCount) && preview_pool_count(&toggled, &toggledCount))
+		*delta = (s32)toggledCount - (s32)currentCount;
+	else
+		*delta = UI_FILTER_DELTA_UNKNOWN;
+	return true;
+}
+
+static void draw_filter_menu(u32 cursor)
+{
+	pool_settings_t current = current_pool_settings();
+	u32 eligible;
+	bool known = preview_pool_count(&current, &eligible);
+
+	ui_draw_filter_menu(cursor, FILTER_ROW_COUNT, eligible, known, filter_row_enabled,
+		filter_row_label, filter_row_is_action, filter_row_delta);
+}
+
+/* Deferred work queued by the options menu; runs in the idle part of later frames. */
+static bool persist_settings_task(void *ctx)
+{
+	(void)ctx;
+	persist_launcher_settings();
+	return false;
+}
+
+/*
+ * Counts come from the histogram, so toggles are free; callers rebuild the pool once when this
+ * returns true (the menu changed something).
+ */
+static bool run_filter_menu(void)
 {
 	u32 cursor = 0;
 	bool changed = false;
 
-	draw_filter_menu(cursor, pool);
+	draw_filter_menu(cursor);
 
 	while (aptMainLoop()) {
-		gspWaitForVBlank();
-		gfxSwapBuffers();
-		hidScanInput();
-
-		u32 kDown = hidKeysDown();
+		u32 kDown = frame_next();
 
 		if (kDown & (KEY_B | KEY_SELECT)) {
-			if (changed)
+			if (changed && !frame_task_add(persist_settings_task, NULL))
 				persist_launcher_settings();
 			break;
 		}
 
 		if (kDown & KEY_UP) {
 			cursor = (cursor + FILTER_ROW_COUNT - 1) % FILTER_ROW_COUNT;
-			draw_filter_menu(cursor, pool);
+			draw_filter_menu(cursor);
 		} else if (kDown & KEY_DOWN) {
 			cursor = (cursor + 1) % FILTER_ROW_COUNT;
-			draw_filter_menu(cursor, pool);
+			draw_filter_menu(cursor);
 		} else if (kDown & KEY_A) {
 			if (filter_row_is_action(cursor)) {
 				if (run_restore_defaults_confirm()) {
 					apply_default_filter_settings();
 					launcher_settings_delete();
 					changed = true;
-					rebuild_eligible_pool(pool);
 				}
 			} else {
 				toggle_filter_row(cursor);
 				changed = true;
-				rebuild_eligible_pool(pool);
 			}
-			draw_filter_menu(cursor, pool);
+			draw_filter_menu(cursor);
 		}
 	}
 
@@ -352,21 +839,19 @@ static bool run_filter_menu(title_picker_pool_t *pool)
 static bool run_empty_pool_screen(title_picker_pool_t *pool, bool suggest_sources)
 {
 	for (;;) {
-		ui_draw_empty_pool_message(g_sd_title_count, g_nand_title_count, g_include_sd, g_include_nand,
-			suggest_sources);
+		ui_source_t sources[UI_SOURCE_COUNT];
 
-		while (aptMainLoop()) {
-			gspWaitForVBlank();
-			gfxSwapBuffers();
-			hidScanInput();
+		fill_ui_sources(sources);
+		ui_draw_empty_pool_message(sources, suggest_sources);
 
-			u32 kDown = hidKeysDown();
+		while (aptMainLoop()) {
+			u32 kDown = frame_next();
 
 			if (kDown & KEY_START)
 				return false;
 
 			if (kDown & KEY_SELECT) {
-				if (run_filter_menu(pool)) {
+				if (run_filter_menu()) {
 					rebuild_eligible_pool(pool);
 					if (pool->count > 0)
 						return true;
@@ -380,18 +865,55 @@ static bool run_empty_pool_screen(title_picker_pool_t *pool, bool suggest_source
 static void wait_for_start_exit(void)
 {
 	while (aptMainLoop()) {
-		gspWaitForVBlank();
-		gfxSwapBuffers();
-		hidScanInput();
-
-		if (hidKeysDown() & KEY_START)
+		if (frame_next() & KEY_START)
 			break;
 	}
 }
 
-static bool pick_random_title(const title_picker_pool_t *pool, u64 *outTitleId, FS_MediaType *outMedia)
+static bool pick_random_title(const title_picker_pool_t *pool, u64 *outTitleId, FS_MediaType *outMedia,
+	u32 *outActiveIndex)
+{
+	u32 slot;
+
+	if (!title_picker_pick_random(pool, g_active_titles, g_active_title_count, outTitleId, outMedia, &slot))
+		return false;
+
+	*outActiveIndex = pool->indices[slot];
+	return true;
+}
+
+static void apply_scanned_title_info(title_pick_t *pick)
+{
+	const title_scan_t *scan = scan_for_media(pick->media);
+	u32 i;
+
+	for (i = 0; i < scan->count; i++) {
+		if (scan->titles[i] != pick->titleId)
+			continue;
+
+		title_meta_set_title_info(&pick->meta, scan->info_results[i], scan->sizes[i], scan->versions[i]);
+		return;
+	}
+
+	/* Not in the scan (should not happen): fall back to a single lookup. */
+	{
+		u64 size = 0;
+		u16 version = 0;
+		Result res = 0;
+
+		title_meta_fetch_info(pick->media, &pick->titleId, 1, &size, &version, &res);
+		title_meta_set_title_info(&pick->meta, res, size, version);
+	}
+}
+
+static void load_pick(u64 titleId, FS_MediaType media, title_pick_t *pick)
 {
-	return title_picker_pick_random(pool, g_active_titles, g_active_title_count, outTitleId, outMedia, NULL);
+	/* Foreground SMDH read wins; the background indexer waits until it is done. */
+	title_index_pause();
+	title_picker_load_pick(titleId, media, g_include_homebrew, g_prefer_long_name, pick);
+	title_index_resume();
+	invalidate_pages();
+	apply_scanned_title_info(pick);
 }
 
 static bool pick_and_load_random_title(const title_picker_pool_t *pool, picked_view_t *view,
@@ -403,10 +925,20 @@ static bool pick_and_load_random_title(const title_picker_pool_t *pool, picked_v
 		return false;
 
 	for (i = 0; i < pool->count; i++) {
-		if (!pick_random_title(pool, outTitleId, outMedia))
+		u32 activeIndex;
+
+		if (!pick_random_title(pool, outTitleId, outMedia, &activeIndex))
 			return false;
 
-		title_picker_load_pick(*outTitleId, *outMedia, g_include_homebrew, g_prefer_long_name, &view->pick);
+		if (g_include_homebrew) {
+			const title_index_entry_t *entry = title_index_lookup(activeIndex, *outTitleId);
+
+			/* Already known to have no readable SMDH name: skip the reload. */
+			if (entry != NULL && entry->smdh_result != TITLE_SMDH_OK)
+				continue;
+		}
+
+		load_pick(*outTitleId, *outMedia, &view->pick);
 		if (!title_picker_unlisted_needs_reroll(g_include_homebrew, &view->pick))
 			return true;
 	}
@@ -418,22 +950,18 @@ static bool run_unlisted_unnamed_screen(title_picker_pool_t *pool)
 {
 	for (;;) {
 		ui_draw_header();
-		printf("\nNo unlisted titles with readable names.\n\n");
-		printf("Turn off \x1b[90mUnlisted\x1b[0m or install titles with icons.\n\n");
-		printf("\x1b[90mSELECT\x1b[0m Options   \x1b[90mSTART\x1b[0m Exit\n");
+		ui_printf("\nNo unlisted titles with readable names.\n\n");
+		ui_printf("Turn off \x1b[90mUnlisted\x1b[0m or install titles with icons.\n\n");
+		ui_printf("\x1b[90mSELECT\x1b[0m Options   \x1b[90mSTART\x1b[0m Exit\n");
 
 		while (aptMainLoop()) {
-			gspWaitForVBlank();
-			gfxSwapBuffers();
-			hidScanInput();
-
-			u32 kDown = hidKeysDown();
+			u32 kDown = frame_next();
 
 			if (kDown & KEY_START)
 				return false;
 
 			if (kDown & KEY_SELECT) {
-				if (run_filter_menu(pool)) {
+				if (run_filter_menu()) {
 					rebuild_eligible_pool(pool);
 					if (!g_include_homebrew || pool->count == 0)
 						return true;
@@ -444,56 +972,441 @@ static bool run_unlisted_unnamed_screen(title_picker_pool_t *pool)
 	}
 }
 
+/* Sort key: the indexed SMDH name, else the catalog name; unnamed titles are read when shown. */
+static const char *browser_sort_name(u32 activeIndex, u64 titleId)
+{
+	const title_index_entry_t *entry = title_index_lookup(activeIndex, titleId);
+
+	if (entry != NULL && entry->smdh_result == TITLE_SMDH_OK && entry->name[0] != '\0')
+		return entry->name;
+	return lookup_game_name(titleId);
+}
+
+static bool browser_resolve_name(u64 titleId, FS_MediaType media, char *out, size_t outSize)
+{
+	title_smdh_info_t smdh;
+	title_name_source_t source;
+
+	title_index_pause();
+	title_smdh_load(titleId, media, &smdh, NULL);
+	title_index_resume();
+
+	title_picker_resolve_display_name(titleId, &smdh, NULL, g_prefer_long_name, out, outSize, &source);
+	return source != TITLE_NAME_SOURCE_TITLE_ID;
+}
+
+/* Rows of the list: every entry, or once a search index exists, the entries matching its query. */
+static u32 browser_count(void)
+{
+	return g_search_ready ? g_search.result_count : g_browser.count;
+}
+
+static u32 browser_position(u32 row)
+{
+	return g_search_ready ? g_search.results[row] : row;
+}
+
+/* Index every entry under the name known without a read; unnamed ones are added as they are shown. */
+static void browser_build_search(void)
+{
+	u32 i;
+
+	title_search_reset(&g_search);
+	for (i = 0; i < g_browser.count; i++)
+		title_search_add(&g_search, title_browser_known_name(&g_browser, i));
+	g_search_ready = true;
+}
+
+/* Only the visible window is resolved and drawn; returns how long that took, in microseconds. */
+static u32 draw_browser(u32 first, u32 cursor, s32 wheel, u32 lastDrawUs)
+{
+	const char *names[UI_BROWSER_ROWS];
+	u64 start = perf_now();
+	u32 total = browser_count();
+	u32 count = 0;
+
+	while (count < UI_BROWSER_ROWS && first + count < total) {
+		u32 position = browser_position(first + count);
+
+		names[count] = title_browser_name(&g_browser, position, g_active_titles, browser_resolve_name);
+		/* A name just read on demand joins the index (and the results, if it matches). */
+		if (g_search_ready && g_search.text_length[position] == 0 && names[count][0] != '\0')
+			title_search_set_name(&g_search, position, names[count]);
+		count++;
+	}
+
+	ui_draw_browser(names, count, first, cursor, browser_count(), lastDrawUs,
+		g_search_ready && (wheel >= 0 || g_search.query_length > 0) ? g_search.query : NULL, wheel);
+	return perf_us_since(start);
+}
+
+static u32 browser_clamp_first(u32 first, u32 cursor)
+{
+	u32 total = browser_count();
+	u32 maxFirst = total > UI_BROWSER_ROWS ? total - UI_BROWSER_ROWS : 0;
+
+	if (cursor < first)
+		first = cursor;
+	else if (cursor >= first + UI_BROWSER_ROWS)
+		first = cursor - UI_BROWSER_ROWS + 1;
+	return first > maxFirst ? maxFirst : first;
+}
+
+/* After the query changed: the row of the first result at or after the entry that was selected. */
+static u32 browser_cursor_near(u32 position)
+{
+	u32 total = browser_count();
+	u32 row = 0;
+
+	while (row < total && browser_position(row) < position)
+		row++;
+	return row < total ? row : total > 0 ? total - 1 : 0;
+}
+
+/*
+ * Scrollable list of the pool, sorted by name, on the bottom screen. D-pad moves (left/right by a
+ * page), dragging scrolls, tapping a row selects it and tapping it again picks it, as does A.
+ * Y starts a search: left/right turn the letter wheel, A types its letter (or tap one), X deletes,
+ * Y keeps the filtered list and B drops it. Returns true with the chosen title loaded into view.
+ */
+static bool run_browser(const title_picker_pool_t *pool, picked_view_t *view)
+{
+	touchPosition touch;
+	u32 wheelLength = (u32)strlen(UI_BROWSER_WHEEL);
+	u32 cursor = 0;
+	u32 first = 0;
+	u32 drawUs = 0;
+	u32 touchStartX = 0;
+	u32 touchStartY = 0;
+	u32 touchStartFirst = 0;
+	/* Rows the last draw listed; indexing a name while drawing can drop it from the results. */
+	u32 listed = 0;
+	/* Letter wheel position while typing, else -1. */
+	s32 wheel = -1;
+	/* Only touches that start inside the browser count (the one that opened it is ignored). */
+	bool touchActive = false;
+	bool touchMoved = false;
+	bool picked = false;
+	u32 i;
+
+	title_browser_open(&g_browser, pool, g_active_titles, g_active_title_count, browser_sort_name);
+	g_search_ready = false;
+	if (g_browser.count == 0)
+		return false;
+
+	/* Start on the current pick when it is in the pool. */
+	for (i = 0; i < g_browser.count; i++) {
+		if (g_browser.entries[i].titleId == view->pick.titleId) {
+			cursor = i;
+			break;
+		}
+	}
+	first = browser_clamp_first(cursor > UI_BROWSER_ROWS / 2 ? cursor - UI_BROWSER_ROWS / 2 : 0, cursor);
+
+	hidSetRepeatParameters(BROWSER_REPEAT_DELAY, BROWSER_REPEAT_INTERVAL);
+	listed = browser_count();
+	drawUs = draw_browser(first, cursor, wheel, drawUs);
+
+	while (aptMainLoop()) {
+		u32 kDown = frame_next();
+		u32 kRepeat = hidKeysDownRepeat();
+		u32 total = browser_count();
+		u32 oldCursor = cursor;
+		u32 oldFirst = first;
+		s32 oldWheel = wheel;
+		u32 oldPosition = total > 0 ? browser_position(cursor) : 0;
+		bool queryChanged = false;
+
+		if (wheel < 0) {
+			if (kDown & KEY_B)
+				break;
+
+			if ((kDown & KEY_A) && total > 0) {
+				picked = true;
+				break;
+			}
+
+			if (kDown & KEY_Y) {
+				if (!g_search_ready)
+					browser_build_search();
+				wheel = 0;
+			}
+
+			if (kRepeat & KEY_LEFT)
+				cursor = cursor > UI_BROWSER_ROWS ? cursor - UI_BROWSER_ROWS : 0;
+			else if ((kRepeat & KEY_RIGHT) && total > 0)
+				cursor = cursor + UI_BROWSER_ROWS < total ? cursor + UI_BROWSER_ROWS : total - 1;
+		} else {
+			if (kDown & (KEY_B | KEY_Y)) {
+				if (kDown & KEY_B) {
+					title_search_set_query(&g_search, "");
+					queryChanged = true;
+				}
+				wheel = -1;
+			} else if (kDown & KEY_A) {
+				title_search_push(&g_search, UI_BROWSER_WHEEL[wheel]);
+				queryChanged = true;
+			} else if ((kRepeat & KEY_X) && g_search.query_length > 0) {
+				title_search_pop(&g_search);
+				queryChanged = true;
+			}
+
+			if (kRepeat & KEY_LEFT)
+				wheel = wheel > 0 ? wheel - 1 : (s32)wheelLength - 1;
+			else if (kRepeat & KEY_RIGHT)
+				wheel = (u32)wheel + 1 < wheelLength ? wheel + 1 : 0;
+		}
+
+		if ((kRepeat & KEY_UP) && cursor > 0)
+			cursor--;
+		else if ((kRepeat & KEY_DOWN) && cursor + 1 < total)
+			cursor++;
+
+		if (kDown & KEY_TOUCH) {
+			hidTouchRead(&touch);
+			touchStartX = touch.px;
+			touchStartY = touch.py;
+			touchStartFirst = first;
+			touchActive = true;
+			touchMoved = false;
+		} else if (touchActive && (hidKeysHeld() & KEY_TOUCH)) {
+			s32 rows;
+
+			hidTouchRead(&touch);
+			/* Dragging up scrolls down, one row per row height moved. */
+			rows = ((s32)touchStartY - (s32)touch.py) / UI_BROWSER_ROW_PX;
+			if (rows != 0)
+				touchMoved = true;
+			if (touchMoved) {
+				s32 target = (s32)touchStartFirst + rows;
+				u32 maxFirst = total > UI_BROWSER_ROWS ? total - UI_BROWSER_ROWS : 0;
+
+				first = target < 0 ? 0 : (u32)target > maxFirst ? maxFirst : (u32)target;
+				if (cursor < first)
+					cursor = first;
+				else if (cursor >= first + UI_BROWSER_ROWS)
+					cursor = first + UI_BROWSER_ROWS - 1;
+			}
+		} else if (touchActive && (hidKeysUp() & KEY_TOUCH)) {
+			u32 row = touchStartY / UI_BROWSER_ROW_PX;
+			u32 col = touchStartX / UI_BROWSER_ROW_PX;
+
+			touchActive = false;
+			if (!touchMoved && row >= 1 && row <= UI_BROWSER_ROWS && first + row - 1 < total) {
+				if (first + row - 1 == cursor) {
+					picked = true;
+					break;
+				}
+				cursor = first + row - 1;
+			} else if (!touchMoved && wheel >= 0 && row == UI_BROWSER_ROWS + 1 && col < wheelLength) {
+				wheel = (s32)col;
+				title_search_push(&g_search, UI_BROWSER_WHEEL[wheel]);
+				queryChanged = true;
+			}
+		}
+
+		if (queryChanged)
+			cursor = browser_cursor_near(oldPosition);
+		else if (cursor >= browser_count())
+			cursor = browser_count() > 0 ? browser_count() - 1 : 0;
+		if (cursor != oldCursor || queryChanged || browser_count() != listed)
+			first = browser_clamp_first(first, cursor);
+
+		if (cursor != oldCursor || first != oldFirst || wheel != oldWheel || queryChanged ||
+		    browser_count() != listed) {
+			listed = browser_count();
+			drawUs = draw_browser(first, cursor, wheel, drawUs);
+		}
+	}
+
+	if (picked) {
+		const title_browser_entry_t *entry = &g_browser.entries[browser_position(cursor)];
+
+		load_pick(entry->titleId, g_active_titles[entry->active].media, &view->pick);
+	}
+
+	ui_invalidate_pick_image();
+	return picked;
+}
+
+/* Console and bottom screen are set up on first use, so instant launch can skip them. */
+static void init_console(void)
+{
+	if (g_console_ready)
+		return;
+
+	consoleInit(GFX_TOP, NULL);
+	ui_grid_invalidate();
+	title_icon_init_bottom_screen();
+	g_console_ready = true;
+}
+
+static bool instant_launch_requested(void)
+{
+	hidScanInput();
+	return g_instant_launch != ((hidKeysHeld() & INSTANT_LAUNCH_TOGGLE_KEY) != 0);
+}
+
+/*
+ * Pick from the ready pool and chainload it with a single toast and no other drawing.
+ * Returns false (fall back to the normal UI) if nothing could be picked or B was held.
+ */
+static bool run_instant_launch(const title_picker_pool_t *pool)
+{
+	/* Only filled when the toast needs an SMDH name. */
+	picked_view_t view;
+	u64 titleId = 0;
+	FS_MediaType media = MEDIATYPE_SD;
+	const char *name = NULL;
+	u32 frame;
+
+	memset(&view, 0, sizeof(view));
+
+	if (pool->count == 0)
+		return false;
+
+	if (g_include_homebrew) {
+		/* Unlisted picks qualify by their SMDH name, so it is loaded either way. */
+		if (!pick_and_load_random_title(pool, &view, &titleId, &media))
+			return false;
+		name = view.pick.display_name;
+	} else {
+		const title_index_entry_t *entry;
+		u32 activeIndex;
+
+		if (!pick_random_title(pool, &titleId, &media, &activeIndex))
+			return false;
+
+		/* Cheapest name first: the indexed SMDH name, then the catalog, then a real SMDH read. */
+		entry = title_index_lookup(activeIndex, titleId);
+		if (entry != NULL && entry->smdh_result == TITLE_SMDH_OK && entry->name[0] != '\0')
+			name = entry->name;
+		else
+			name = lookup_game_name(titleId);
+
+		if (name == NULL) {
+			load_pick(titleId, media, &view.pick);
+			name = view.pick.display_name;
+		}
+	}
+
+	init_console();
+	ui_draw_header();
+	ui_printf("\nLaunching \x1b[37m%s\x1b[0m...\n\n", name);
+	ui_printf("\x1b[90mHold B for the menu\x1b[0m\n");
+
+	for (frame = 0; frame < INSTANT_LAUNCH_CANCEL_FRAMES && aptMainLoop(); frame++) {
+		frame_next();
+
+		if (hidKeysHeld() & KEY_B)
+			return false;
+	}
+	if (frame < INSTANT_LAUNCH_CANCEL_FRAMES)
+		return false;
+
+	aptSetChainloader(titleId, media);
+	perf_mark("chainload");
+	if (g_log_startup_times)
+		perf_append_csv(APP_VERSION);
+	return true;
+}
+
 int main()
 {
 	Result res = 0;
 	time_t t;
 	bool fsReady = false;
+	bool firstPickMarked = false;
+	bool libraryReady = false;
+	bool instant = false;
+	u32 span;
+
+	perf_init();
 
+	span = perf_begin("gfx");
 	gfxInitDefault();
-	consoleInit(GFX_TOP, NULL);
+	perf_end(span);
 
+	span = perf_begin("am");
 	res = amInit();
+	perf_end(span);
 	if (R_FAILED(res))
 		goto cleanup_error;
 
+	span = perf_begin("fs");
 	res = fsInit();
+	perf_end(span);
 	if (R_FAILED(res))
 		goto cleanup_error;
 	fsReady = true;
 
+	span = perf_begin("cfg");
 	{
 		launcher_settings_t settings;
 
 		if (launcher_settings_load(&settings))
 			apply_launcher_settings(&settings);
 	}
+	perf_end(span);
 
-	u32 readTitlesAmount;
-	title_picker_pool_t pool;
+	instant = instant_launch_requested();
+	if (!instant) {
+		span = perf_begin("console");
+		init_console();
+		perf_end(span);
+	}
 
-	res = AM_GetTitleList(&readTitlesAmount, MEDIATYPE_SD, TITLE_SCAN_MAX, g_sd_titles);
-	if (R_FAILED(res))
-		goto cleanup_error;
-	g_sd_title_count = readTitlesAmount;
+	title_picker_pool_t pool;
+	bool warmStart;
+
+	span = perf_begin("snapshot");
+	warmStart = load_library_snapshot(&pool);
+	perf_end(span);
+
+	/* Only enabled media are listed; the others are scanned the first time they are turned on. */
+	if (!warmStart) {
+		span = perf_begin("scan");
+		res = scan_enabled_media_parallel();
+		perf_end(span);
+		if (R_FAILED(res))
+			goto cleanup_error;
+	}
+	libraryReady = true;
 
-	res = AM_GetTitleList(&readTitlesAmount, MEDIATYPE_NAND, TITLE_SCAN_MAX, g_nand_titles);
-	if (R_FAILED(res))
-		g_nand_title_count = 0;
-	else
-		g_nand_title_count = readTitlesAmount;
+	/* Nothing found on the enabled media: list SD and NAND too so the empty-pool screen can point at them. */
+	if (g_sd_scan.count == 0 && g_nand_scan.count == 0 && g_card_scan.count == 0) {
+		scan_media_once(MEDIATYPE_SD);
+		scan_media_once(MEDIATYPE_NAND);
+	}
 
-	if (g_sd_title_count == 0 && g_nand_title_count == 0) {
+	if (g_sd_scan.count == 0 && g_nand_scan.count == 0 && g_card_scan.count == 0) {
+		init_console();
 		ui_draw_header();
-		printf("\nNo titles found on SD or NAND.\n\n");
-		printf("Install titles and try again.\n\n");
-		printf("\x1b[90mSTART\x1b[0m Exit\n\n");
+		ui_printf("\nNo titles found on SD or NAND.\n\n");
+		ui_printf("Install titles and try again.\n\n");
+		ui_printf("\x1b[90mSTART\x1b[0m Exit\n\n");
 		wait_for_start_exit();
 		goto cleanup_normal;
 	}
 
 	srand((unsigned)time(&t));
-	rebuild_eligible_pool(&pool);
+	if (!warmStart) {
+		span = perf_begin("pool");
+		rebuild_eligible_pool(&pool);
+		perf_end(span);
+	}
+
+	if (instant) {
+		if (run_instant_launch(&pool))
+			goto cleanup_normal;
+		init_console();
+	}
+
+	if (warmStart) {
+		/* The snapshot is used as-is; a background rescan catches installs and deletions. */
+		title_scan_refresh_start(media_scanned(MEDIATYPE_SD) ? &g_sd_scan : NULL,
+			media_scanned(MEDIATYPE_NAND) ? &g_nand_scan : NULL);
+	}
 
 	if (pool.count == 0) {
 		if (!run_empty_pool_screen(&pool, true))
@@ -510,7 +1423,10 @@ randomPicker:
 	FS_MediaType randomMedia = MEDIATYPE_SD;
 	picked_view_t view;
 	memset(&view, 0, sizeof(view));
-	view.page = 0;
+	view.page = UI_PAGE_GAME;
+
+	if (!firstPickMarked)
+		span = perf_begin("pick");
 
 	if (!pick_and_load_random_title(&pool, &view, &randomTitle, &randomMedia)) {
 		if (g_include_homebrew && pool.count > 0) {
@@ -520,25 +1436,48 @@ randomPicker:
 		}
 
 		ui_draw_header();
-		printf("\nFailed to pick a random title.\n\n");
-		printf("\x1b[90mSTART\x1b[0m Exit\n\n");
+		ui_printf("\nFailed to pick a random title.\n\n");
+		ui_printf("\x1b[90mSTART\x1b[0m Exit\n\n");
 		wait_for_start_exit();
 		goto cleanup_normal;
 	}
+
 	print_picked_view(&view);
+	if (!firstPickMarked) {
+		perf_end(span);
+		perf_mark("first pick");
+		firstPickMarked = true;
+		if (g_log_startup_times)
+			perf_append_csv(APP_VERSION);
+	}
 
-	while (aptMainLoop()) {
-		gspWaitForVBlank();
-		gfxSwapBuffers();
-		hidScanInput();
+	u32 indexShown = title_index_done_count();
+	u32 framesSinceIndexDraw = 0;
+	frame_stats_t framesShown = *frame_stats();
 
-		u32 kDown = hidKeysDown();
+	while (aptMainLoop()) {
+		u32 kDown = frame_next();
 
 		if (kDown & KEY_START)
 			break;
 
+		if (apply_library_refresh(&pool))
+			print_picked_view(&view);
+
+		if (view.page == UI_PAGE_TECHNICAL && ++framesSinceIndexDraw >= INDEX_PROGRESS_REDRAW_FRAMES) {
+			framesSinceIndexDraw = 0;
+			if (title_index_done_count() != indexShown ||
+				memcmp(frame_stats(), &framesShown, sizeof(framesShown)) != 0) {
+				indexShown = title_index_done_count();
+				framesShown = *frame_stats();
+				g_page_ready[UI_PAGE_TECHNICAL] = false;
+				print_picked_view(&view);
+			}
+		}
+
 		if (kDown & KEY_A) {
-			printf("Launching %s...\n", view.pick.display_name);
+			ui_printf("Launching %s...\n", view.pick.display_name);
+			ui_grid_flush();
 			aptSetChainloader(randomTitle, view.pick.media);
 			break;
 		}
@@ -547,25 +1486,29 @@ randomPicker:
 			goto randomPicker;
 		}
 
+		if (kDown & (KEY_B | KEY_TOUCH)) {
+			if (run_browser(&pool, &view))
+				randomTitle = view.pick.titleId;
+			print_picked_view(&view);
+		}
+
 		if (kDown & KEY_X) {
 			g_include_homebrew = !g_include_homebrew;
 			rebuild_eligible_pool(&pool);
 			if (pool.count == 0 || !title_picker_is_eligible(randomTitle, &g_filters, g_include_homebrew))
 				goto randomPicker;
-			title_picker_load_pick(randomTitle, view.pick.media, g_include_homebrew, g_prefer_long_name,
-				&view.pick);
+			load_pick(randomTitle, view.pick.media, &view.pick);
 			if (title_picker_unlisted_needs_reroll(g_include_homebrew, &view.pick))
 				goto randomPicker;
 			print_picked_view(&view);
 		}
 
 		if (kDown & KEY_SELECT) {
-			if (run_filter_menu(&pool)) {
+			if (run_filter_menu()) {
 				rebuild_eligible_pool(&pool);
 				if (pool.count == 0 || !title_picker_is_eligible(randomTitle, &g_filters, g_include_homebrew))
 					goto randomPicker;
-				title_picker_load_pick(randomTitle, view.pick.media, g_include_homebrew, g_prefer_long_name,
-					&view.pick);
+				load_pick(randomTitle, view.pick.media, &view.pick);
 				if (title_picker_unlisted_needs_reroll(g_include_homebrew, &view.pick))
 					goto randomPicker;
 			}
@@ -586,12 +1529,20 @@ randomPicker:
 	goto cleanup_normal;
 
 cleanup_error:
+	init_console();
 	ui_draw_header();
-	printf("\nSomething went wrong.\n\n");
-	printf("\x1b[90mSTART\x1b[0m Exit\n\n");
+	ui_printf("\nSomething went wrong.\n\n");
+	ui_printf("\x1b[90mSTART\x1b[0m Exit\n\n");
 	wait_for_start_exit();
 
 cleanup_normal:
+	/* Pending writes (settings) must land before exit or chainload; page layouts are moot. */
+	frame_task_cancel(layout_pages_task, &view);
+	frame_task_flush();
+	title_scan_refresh_stop();
+	title_index_stop();
+	if (libraryReady)
+		save_library_snapshot(&pool);
 	if (fsReady)
 		fsExit();
 	amExit();
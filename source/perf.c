@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "perf.h"
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#ifdef __3DS__
+#define PERF_TICKS_PER_SEC ((u64)SYSCLOCK_ARM11)
+#else
+#define PERF_TICKS_PER_SEC 1000000000ULL
+#endif
+
+static perf_span_t g_spans[PERF_SPAN_MAX];
+static u32 g_spanTotal = 0;
+static u64 g_initTicks = 0;
+
+u64 perf_now(void)
+{
+#ifdef __3DS__
+	return svcGetSystemTick();
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * PERF_TICKS_PER_SEC + (u64)ts.tv_nsec;
+#endif
+}
+
+void perf_init(void)
+{
+	g_spanTotal = 0;
+	g_initTicks = perf_now();
+}
+
+static perf_span_t *perf_push(const char *name, u64 start)
+{
+	perf_span_t *span = &g_spans[g_spanTotal % PERF_SPAN_MAX];
+
+	span->name = name;
+	span->start_ticks = start;
+	span->end_ticks = 0;
+	span->is_mark = false;
+	g_spanTotal++;
+	return span;
+}
+
+u32 perf_begin(const char *name)
+{
+	perf_push(name, perf_now());
+	return g_spanTotal - 1;
+}
+
+void perf_end(u32 span)
+{
+	if (span >= g_spanTotal || g_spanTotal - span > PERF_SPAN_MAX)
+		return;
+
+	g_spans[span % PERF_SPAN_MAX].end_ticks = perf_now();
+}
+
+void perf_mark(const char *name)
+{
+	perf_span_t *span = perf_push(name, g_initTicks);
+
+	span->end_ticks = perf_now();
+	span->is_mark = true;
+}
+
+u32 perf_span_count(void)
+{
+	return g_spanTotal < PERF_SPAN_MAX ? g_spanTotal : PERF_SPAN_MAX;
+}
+
+const perf_span_t *perf_span_at(u32 index)
+{
+	u32 count = perf_span_count();
+
+	if (index >= count)
+		return NULL;
+
+	return &g_spans[(g_spanTotal - count + index) % PERF_SPAN_MAX];
+}
+
+u32 perf_span_us(const perf_span_t *span)
+{
+	if (span == NULL || span->end_ticks < span->start_ticks || span->end_ticks == 0)
+		return 0;
+
+	return (u32)((span->end_ticks - span->start_ticks) * 1000000ULL / PERF_TICKS_PER_SEC);
+}
+
+u64 perf_ticks_from_us(u32 us)
+{
+	return (u64)us * PERF_TICKS_PER_SEC / 1000000ULL;
+}
+
+u32 perf_us_since(u64 start)
+{
+	return (u32)((perf_now() - start) * 1000000ULL / PERF_TICKS_PER_SEC);
+}
+
+bool perf_append_csv(const char *version)
+{
+	struct stat st;
+	bool isNew;
+	time_t now = time(NULL);
+	FILE *file;
+	u32 i;
+
+	mkdir("sdmc:/3ds", 0777);
+	mkdir("sdmc:/3ds/3DS-Random-Game-Launcher", 0777);
+
+	isNew = stat(PERF_CSV_PATH, &st) != 0 || st.st_size == 0;
+	file = fopen(PERF_CSV_PATH, "a");
+	if (file == NULL)
+		return false;
+
+	if (isNew)
+		fprintf(file, "unix_time,version,phase,ms\n");
+
+	for (i = 0; i < perf_span_count(); i++) {
+		const perf_span_t *span = perf_span_at(i);
+		u32 us = perf_span_us(span);
+
+		if (span->end_ticks == 0)
+			continue;
+		fprintf(file, "%lld,%s,%s,%lu.%03lu\n", (long long)now, version, span->name,
+			(unsigned long)(us / 1000), (unsigned long)(us % 1000));
+	}
+
+	return fclose(file) == 0;
+}
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef PERF_H
+#define PERF_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+/* Startup needs about ten spans; older spans are overwritten once the ring is full. */
+#define PERF_SPAN_MAX 16
+#define PERF_CSV_PATH "sdmc:/3ds/3DS-Random-Game-Launcher/perf.csv"
+
+typedef struct {
+	/* String literal; spans never copy names. */
+	const char *name;
+	u64 start_ticks;
+	u64 end_ticks;
+	/* Marks run from perf_init() to the moment they were recorded (e.g. first pick). */
+	bool is_mark;
+} perf_span_t;
+
+/// Record the process start reference. Call first thing in main().
+void perf_init(void);
+
+/// Monotonic tick counter (svcGetSystemTick on device, clock_gettime on a host build).
+u64 perf_now(void);
+
+/// Open a named span; returns a handle for perf_end.
+u32 perf_begin(const char *name);
+
+/// Close a span. Handles whose slot has since been reused are ignored.
+void perf_end(u32 span);
+
+/// Record a mark: a span from perf_init() to now.
+void perf_mark(const char *name);
+
+/// Number of spans held (at most PERF_SPAN_MAX).
+u32 perf_span_count(void);
+
+/// Span by age, 0 = oldest still held. NULL if out of range.
+const perf_span_t *perf_span_at(u32 index);
+
+/// Span duration in microseconds (0 while still open).
+u32 perf_span_us(const perf_span_t *span);
+
+/// Tick count for a duration, in perf_now() units.
+u64 perf_ticks_from_us(u32 us);
+
+/// Microseconds elapsed since a perf_now() reading.
+u32 perf_us_since(u64 start);
+
+/// Append every closed span as `unix_time,version,phase,ms` rows (header on a new file).
+bool perf_append_csv(const char *version);
+
+#endif
@@ -10,7 +10,7 @@
 #include <sys/stat.h>
 
 #define SETTINGS_MAGIC 0x314C4752u /* 'RGL1' little-endian */
-#define SETTINGS_VERSION 1u
+#define SETTINGS_VERSION 3u
 #define SETTINGS_DIR "sdmc:/3ds/3DS-Random-Game-Launcher"
 #define SETTINGS_PATH SETTINGS_DIR "/settings.bin"
 
@@ -30,22 +30,64 @@ typedef struct {
 	u8 include_content_packs;
 	u8 include_native_apps;
 	u8 include_virtual_console;
-	u8 reserved;
+	/* Was a zero reserved byte, so older files read back as "off". */
+	u8 log_startup_times;
+	/* Fields below were appended in later versions; older files end with the checksum earlier. */
+	u8 include_game_card;
+	u8 instant_launch;
 	u32 checksum;
 } __attribute__((packed)) settings_blob_t;
 
-static u32 settings_blob_checksum(const settings_blob_t *blob)
+/* Where each version's fields end and its checksum starts (index = version). */
+static const size_t s_version_fields_end[SETTINGS_VERSION + 1] = {
+	0,
+	offsetof(settings_blob_t, include_game_card),
+	offsetof(settings_blob_t, instant_launch),
+	offsetof(settings_blob_t, checksum),
+};
+
+static u32 settings_checksum_bytes(const settings_blob_t *blob, size_t size)
 {
 	const u8 *bytes = (const u8 *)blob;
 	u32 sum = 0;
 	size_t i;
 
-	for (i = 0; i < offsetof(settings_blob_t, checksum); i++)
+	for (i = 0; i < size; i++)
 		sum = (sum * 131u) + bytes[i];
 
 	return sum;
 }
 
+static u32 settings_blob_checksum(const settings_blob_t *blob)
+{
+	return settings_checksum_bytes(blob, offsetof(settings_blob_t, checksum));
+}
+
+/* Older blobs are a prefix of the current layout plus their checksum; upgrade in place. */
+static bool settings_blob_upgrade(settings_blob_t *blob, size_t readSize)
+{
+	size_t end;
+	u32 checksum;
+
+	if (blob->version == 0 || blob->version >= SETTINGS_VERSION)
+		return false;
+
+	end = s_version_fields_end[blob->version];
+	if (blob->size != end + sizeof(u32) || readSize != blob->size)
+		return false;
+
+	memcpy(&checksum, (const u8 *)blob + end, sizeof(checksum));
+	if (checksum != settings_checksum_bytes(blob, end))
+		return false;
+
+	/* Fields the old version did not have (and its checksum bytes) read back as "off". */
+	memset((u8 *)blob + end, 0, offsetof(settings_blob_t, checksum) - end);
+	blob->version = SETTINGS_VERSION;
+	blob->size = (u16)sizeof(settings_blob_t);
+	blob->checksum = settings_blob_checksum(blob);
+	return true;
+}
+
 static void settings_blob_from_launcher(const launcher_settings_t *settings, settings_blob_t *blob)
 {
 	memset(blob, 0, sizeof(*blob));
@@ -55,6 +97,7 @@ static void settings_blob_from_launcher(const launcher_settings_t *settings, set
 	blob->include_unlisted = settings->include_unlisted ? 1 : 0;
 	blob->include_sd = settings->include_sd ? 1 : 0;
 	blob->include_nand = settings->include_nand ? 1 : 0;
+	blob->include_game_card = settings->include_game_card ? 1 : 0;
 	blob->prefer_long_name = settings->prefer_long_name ? 1 : 0;
 	blob->include_patches = settings->filters.include_patches ? 1 : 0;
 	blob->include_dlc = settings->filters.include_dlc ? 1 : 0;
@@ -64,6 +107,8 @@ static void settings_blob_from_launcher(const launcher_settings_t *settings, set
 	blob->include_content_packs = settings->filters.include_content_packs ? 1 : 0;
 	blob->include_native_apps = settings->filters.include_native_apps ? 1 : 0;
 	blob->include_virtual_console = settings->filters.include_virtual_console ? 1 : 0;
+	blob->log_startup_times = settings->log_startup_times ? 1 : 0;
+	blob->instant_launch = settings->instant_launch ? 1 : 0;
 	blob->checksum = settings_blob_checksum(blob);
 }
 
@@ -81,6 +126,7 @@ static bool settings_blob_to_launcher(const settings_blob_t *blob, launcher_sett
 	settings->include_unlisted = blob->include_unlisted != 0;
 	settings->include_sd = blob->include_sd != 0;
 	settings->include_nand = blob->include_nand != 0;
+	settings->include_game_card = blob->include_game_card != 0;
 	settings->prefer_long_name = blob->prefer_long_name != 0;
 	settings->filters.include_patches = blob->include_patches != 0;
 	settings->filters.include_dlc = blob->include_dlc != 0;
@@ -90,6 +136,8 @@ static bool settings_blob_to_launcher(const settings_blob_t *blob, launcher_sett
 	settings->filters.include_content_packs = blob->include_content_packs != 0;
 	settings->filters.include_native_apps = blob->include_native_apps != 0;
 	settings->filters.include_virtual_console = blob->include_virtual_console != 0;
+	settings->log_startup_times = blob->log_startup_times != 0;
+	settings->instant_launch = blob->instant_launch != 0;
 	return true;
 }
 
@@ -107,7 +155,10 @@ void launcher_settings_apply_defaults(launcher_settings_t *settings)
 	settings->include_unlisted = false;
 	settings->include_sd = true;
 	settings->include_nand = false;
+	settings->include_game_card = false;
 	settings->prefer_long_name = false;
+	settings->log_startup_times = false;
+	settings->instant_launch = false;
 	settings->filters.include_patches = false;
 	settings->filters.include_dlc = false;
 	settings->filters.include_system = false;
@@ -132,6 +183,7 @@ bool launcher_settings_match_defaults(const launcher_settings_t *settings)
 bool launcher_settings_load(launcher_settings_t *settings)
 {
 	settings_blob_t blob;
+	size_t readSize;
 	FILE *file;
 
 	if (settings == NULL)
@@ -141,12 +193,13 @@ bool launcher_settings_load(launcher_settings_t *settings)
 	if (file == NULL)
 		return false;
 
-	if (fread(&blob, sizeof(blob), 1, file) != 1) {
-		fclose(file);
-		return false;
-	}
+	memset(&blob, 0, sizeof(blob));
+	readSize = fread(&blob, 1, sizeof(blob), file);
 	fclose(file);
 
+	if (readSize != sizeof(blob) && !settings_blob_upgrade(&blob, readSize))
+		return false;
+
 	return settings_blob_to_launcher(&blob, settings);
 }
 
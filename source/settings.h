@@ -12,7 +12,11 @@ typedef struct {
 	bool include_unlisted;
 	bool include_sd;
 	bool include_nand;
+	bool include_game_card;
 	bool prefer_long_name;
+	bool log_startup_times;
+	/* Pick and chainload straight from the cached pool; holding R at boot inverts it. */
+	bool instant_launch;
 	title_filter_options_t filters;
 } launcher_settings_t;
 
@@ -0,0 +1,602 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_banner.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "perf.h"
+#include "title_icon.h"
+#include "title_lz11.h"
+#include "title_smdh.h"
+
+/* Decompressed CGFX prefix kept for locating the texture (header, DATA, dictionaries, TXOB). */
+#define BANNER_HEAD_SIZE 0x8000
+#define BANNER_TEXTURE_DICT_SCAN_MAX 64
+#define BANNER_CBMD_MIN_SIZE 0x88
+#define BANNER_CBMD_CWAV_OFFSET 0x84
+#define CGFX_TXOB_IMAGE_FLAGS 0x20000011
+
+enum {
+	PICA_RGBA8 = 0,
+	PICA_RGB8 = 1,
+	PICA_RGBA5551 = 2,
+	PICA_RGB565 = 3,
+	PICA_RGBA4 = 4,
+	PICA_LA8 = 5,
+	PICA_L8 = 7,
+	PICA_ETC1 = 12,
+	PICA_ETC1A4 = 13,
+};
+
+typedef enum {
+	RESOLVE_OK = 0,
+	RESOLVE_NEED_MORE,
+	RESOLVE_FAILED,
+} resolve_status_t;
+
+typedef struct {
+	u8 head[BANNER_HEAD_SIZE];
+	u32 head_len;
+	u32 position;
+	bool resolved;
+	title_banner_result_t error;
+	u32 width;
+	u32 height;
+	u32 format;
+	u32 tex_offset;
+	u32 tex_size;
+	u32 tex_captured;
+	u8 *tex;
+	title_lz11_stream_t lz11;
+} banner_capture_t;
+
+static const s32 s_etc1_modifiers[8][2] = {
+	{ 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 },
+	{ 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 },
+};
+
+static u16 *g_pixels = NULL;
+static title_banner_t g_cached;
+static u64 g_cachedTitleId = 0;
+static bool g_cacheValid = false;
+
+static u32 read_le32(const u8 *p)
+{
+	return (u32)p[0] | ((u32)p[1] << 8) | ((u32)p[2] << 16) | ((u32)p[3] << 24);
+}
+
+/* Bounds-checked read from the CGFX prefix; false means the prefix is still too short. */
+static bool head_u32(const banner_capture_t *cap, u32 offset, u32 *out)
+{
+	if (offset > cap->head_len || cap->head_len - offset < 4)
+		return false;
+	*out = read_le32(cap->head + offset);
+	return true;
+}
+
+/* CGFX offsets are relative to the field that stores them. */
+static bool head_rel(const banner_capture_t *cap, u32 field, u32 *out)
+{
+	u32 rel;
+
+	if (!head_u32(cap, field, &rel))
+		return false;
+	*out = field + rel;
+	return true;
+}
+
+static bool head_magic(const banner_capture_t *cap, u32 offset, const char *magic)
+{
+	return offset <= cap->head_len && cap->head_len - offset >= 4 &&
+		memcmp(cap->head + offset, magic, 4) == 0;
+}
+
+static u32 texture_bits_per_pixel(u32 format)
+{
+	switch (format) {
+	case PICA_RGBA8:
+		return 32;
+	case PICA_RGB8:
+		return 24;
+	case PICA_RGBA5551:
+	case PICA_RGB565:
+	case PICA_RGBA4:
+	case PICA_LA8:
+		return 16;
+	case PICA_L8:
+	case PICA_ETC1A4:
+		return 8;
+	case PICA_ETC1:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+static resolve_status_t fail_resolve(banner_capture_t *cap, title_banner_result_t error)
+{
+	cap->error = error;
+	return RESOLVE_FAILED;
+}
+
+static resolve_status_t resolve_txob(banner_capture_t *cap, u32 txob)
+{
+	u32 image;
+	u32 bpp;
+
+	if (!head_u32(cap, txob + 0x18, &cap->height) || !head_u32(cap, txob + 0x1C, &cap->width) ||
+	    !head_u32(cap, txob + 0x34, &cap->format) || !head_rel(cap, txob + 0x38, &image) ||
+	    !head_u32(cap, image + 0x08, &cap->tex_size) || !head_rel(cap, image + 0x0C, &cap->tex_offset))
+		return RESOLVE_NEED_MORE;
+
+	if (cap->width == 0 || cap->height == 0 || (cap->width & 7) != 0 || (cap->height & 7) != 0 ||
+	    cap->width > TITLE_BANNER_TEXTURE_DIM_MAX || cap->height > TITLE_BANNER_TEXTURE_DIM_MAX)
+		return fail_resolve(cap, TITLE_BANNER_ERR_FORMAT);
+
+	bpp = texture_bits_per_pixel(cap->format);
+	if (bpp == 0)
+		return fail_resolve(cap, TITLE_BANNER_ERR_UNSUPPORTED);
+
+	/* Only the base mip level is used. */
+	if (cap->tex_size < cap->width * cap->height * bpp / 8)
+		return fail_resolve(cap, TITLE_BANNER_ERR_FORMAT);
+	cap->tex_size = cap->width * cap->height * bpp / 8;
+	if (cap->tex_size > TITLE_BANNER_TEXTURE_DATA_MAX)
+		return fail_resolve(cap, TITLE_BANNER_ERR_UNSUPPORTED);
+
+	cap->tex = (u8 *)malloc(cap->tex_size);
+	if (cap->tex == NULL)
+		return fail_resolve(cap, TITLE_BANNER_ERR_MEMORY);
+
+	return RESOLVE_OK;
+}
+
+/* Walk CGFX header -> DATA -> texture DICT -> first image TXOB. */
+static resolve_status_t resolve_texture(banner_capture_t *cap)
+{
+	u32 headerSize;
+	u32 textureCount;
+	u32 dict;
+	u32 dictCount;
+	u32 i;
+
+	if (cap->head_len < 8)
+		return RESOLVE_NEED_MORE;
+	if (!head_magic(cap, 0, "CGFX"))
+		return fail_resolve(cap, TITLE_BANNER_ERR_FORMAT);
+
+	headerSize = (u32)cap->head[6] | ((u32)cap->head[7] << 8);
+	if (!head_u32(cap, headerSize + 0x10, &textureCount) || !head_rel(cap, headerSize + 0x14, &dict))
+		return RESOLVE_NEED_MORE;
+	if (!head_magic(cap, headerSize, "DATA"))
+		return fail_resolve(cap, TITLE_BANNER_ERR_FORMAT);
+	if (textureCount == 0)
+		return fail_resolve(cap, TITLE_BANNER_ERR_NO_TEXTURE);
+
+	if (!head_u32(cap, dict + 0x08, &dictCount))
+		return RESOLVE_NEED_MORE;
+	if (!head_magic(cap, dict, "DICT"))
+		return fail_resolve(cap, TITLE_BANNER_ERR_FORMAT);
+	if (dictCount > BANNER_TEXTURE_DICT_SCAN_MAX)
+		dictCount = BANNER_TEXTURE_DICT_SCAN_MAX;
+
+	for (i = 0; i < dictCount; i++) {
+		u32 txob;
+		u32 flags;
+
+		if (!head_rel(cap, dict + 0x1C + i * 0x10 + 0x0C, &txob) || !head_u32(cap, txob, &flags))
+			return RESOLVE_NEED_MORE;
+		if (flags != CGFX_TXOB_IMAGE_FLAGS)
+			continue;
+		if (!head_magic(cap, txob + 4, "TXOB"))
+			return head_u32(cap, txob + 4, &flags) ? fail_resolve(cap, TITLE_BANNER_ERR_FORMAT) :
+				RESOLVE_NEED_MORE;
+		return resolve_txob(cap, txob);
+	}
+
+	return fail_resolve(cap, TITLE_BANNER_ERR_NO_TEXTURE);
+}
+
+/* Copy the part of [start, start + size) that overlaps the texture; data arrives in order. */
+static void capture_texture_bytes(banner_capture_t *cap, const u8 *data, u32 start, u32 size)
+{
+	u32 want = cap->tex_offset + cap->tex_captured;
+	u32 end = start + size;
+	u32 take;
+
+	if (want < start || want >= end)
+		return;
+
+	take = end - want;
+	if (take > cap->tex_size - cap->tex_captured)
+		take = cap->tex_size - cap->tex_captured;
+
+	memcpy(cap->tex + cap->tex_captured, data + (want - start), take);
+	cap->tex_captured += take;
+}
+
+static bool capture_sink(void *ctx, const u8 *data, size_t size)
+{
+	banner_capture_t *cap = (banner_capture_t *)ctx;
+	u32 start = cap->position;
+
+	cap->position += (u32)size;
+
+	if (!cap->resolved) {
+		u32 room = BANNER_HEAD_SIZE - cap->head_len;
+		resolve_status_t status;
+
+		if (room > size)
+			room = (u32)size;
+		memcpy(cap->head + cap->head_len, data, room);
+		cap->head_len += room;
+
+		status = resolve_texture(cap);
+		if (status == RESOLVE_FAILED)
+			return false;
+		if (status == RESOLVE_NEED_MORE) {
+			if (cap->head_len < BANNER_HEAD_SIZE)
+				return true;
+			cap->error = TITLE_BANNER_ERR_FORMAT;
+			return false;
+		}
+
+		cap->resolved = true;
+		capture_texture_bytes(cap, cap->head, 0, cap->head_len);
+	}
+
+	capture_texture_bytes(cap, data, start, (u32)size);
+
+	/* Stop decompressing as soon as the texture is complete (the rest is geometry and animation). */
+	return cap->tex_captured < cap->tex_size;
+}
+
+static u16 pack_rgb565(u32 r, u32 g, u32 b, u32 a)
+{
+	/* Banners are composited over black, so alpha only darkens. */
+	if (a < 255) {
+		r = (r * a + 127) / 255;
+		g = (g * a + 127) / 255;
+		b = (b * a + 127) / 255;
+	}
+
+	return (u16)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+static u16 convert_texel(const u8 *p, u32 format)
+{
+	u32 v;
+	u32 l;
+
+	switch (format) {
+	case PICA_RGBA8:
+		return pack_rgb565(p[3], p[2], p[1], p[0]);
+	case PICA_RGB8:
+		return pack_rgb565(p[2], p[1], p[0], 255);
+	case PICA_RGBA5551:
+		v = (u32)p[0] | ((u32)p[1] << 8);
+		if ((v & 1) == 0)
+			return 0;
+		return (u16)((v & 0xFFC0) | ((v >> 1) & 0x1F));
+	case PICA_RGB565:
+		return (u16)((u32)p[0] | ((u32)p[1] << 8));
+	case PICA_RGBA4:
+		v = (u32)p[0] | ((u32)p[1] << 8);
+		return pack_rgb565(((v >> 12) & 0xF) * 17, ((v >> 8) & 0xF) * 17, ((v >> 4) & 0xF) * 17,
+			(v & 0xF) * 17);
+	case PICA_LA8:
+		return pack_rgb565(p[1], p[1], p[1], p[0]);
+	case PICA_L8:
+	default:
+		l = p[0];
+		return pack_rgb565(l, l, l, 255);
+	}
+}
+
+/* Textures are stored bottom row first; out is top row first. */
+static u16 *output_pixel(u16 *out, u32 width, u32 height, u32 x, u32 y)
+{
+	return out + (height - 1 - y) * width + x;
+}
+
+static void convert_tiled(const u8 *tex, u32 width, u32 height, u32 format, u16 *out)
+{
+	u32 bytes = texture_bits_per_pixel(format) / 8;
+	u32 tx;
+	u32 ty;
+	u32 i;
+
+	for (ty = 0; ty < height; ty += 8) {
+		for (tx = 0; tx < width; tx += 8) {
+			/* Same Morton walk as SMDH icons, one horizontal pixel pair at a time. */
+			for (i = 0; i < 32; i++) {
+				u32 x = tx + (title_icon_tile_pairs[i] & 7);
+				u32 y = ty + (title_icon_tile_pairs[i] >> 3);
+
+				*output_pixel(out, width, height, x, y) = convert_texel(tex, format);
+				*output_pixel(out, width, height, x + 1, y) = convert_texel(tex + bytes, format);
+				tex += 2 * bytes;
+			}
+		}
+	}
+}
+
+static u64 read_le64(const u8 *p)
+{
+	return (u64)read_le32(p) | ((u64)read_le32(p + 4) << 32);
+}
+
+static u32 clamp_channel(s32 value)
+{
+	if (value < 0)
+		return 0;
+	if (value > 255)
+		return 255;
+	return (u32)value;
+}
+
+static s32 sign_extend3(u32 value)
+{
+	return (value & 4) ? (s32)value - 8 : (s32)value;
+}
+
+static void decode_etc1_block(u64 block, u64 alpha, bool hasAlpha, u16 *out, u32 width, u32 height,
+	u32 bx, u32 by)
+{
+	bool flip = ((block >> 32) & 1) != 0;
+	bool differential = ((block >> 33) & 1) != 0;
+	u32 x;
+	u32 y;
+
+	for (y = 0; y < 4; y++) {
+		for (x = 0; x < 4; x++) {
+			u32 texel = x * 4 + y;
+			u32 half = flip ? y : x;
+			u32 table = half < 2 ? (u32)(block >> 37) & 7 : (u32)(block >> 34) & 7;
+			s32 modifier = s_etc1_modifiers[table][(block >> texel) & 1];
+			s32 r;
+			s32 g;
+			s32 b;
+			u32 a = 255;
+
+			if (differential) {
+				r = (s32)((block >> 59) & 0x1F);
+				g = (s32)((block >> 51) & 0x1F);
+				b = (s32)((block >> 43) & 0x1F);
+				if (half >= 2) {
+					r += sign_extend3((u32)(block >> 56) & 7);
+					g += sign_extend3((u32)(block >> 48) & 7);
+					b += sign_extend3((u32)(block >> 40) & 7);
+				}
+				r = (r << 3) | (r >> 2);
+				g = (g << 3) | (g >> 2);
+				b = (b << 3) | (b >> 2);
+			} else {
+				u32 shift = half < 2 ? 4 : 0;
+
+				r = (s32)((block >> (56 + shift)) & 0xF) * 17;
+				g = (s32)((block >> (48 + shift)) & 0xF) * 17;
+				b = (s32)((block >> (40 + shift)) & 0xF) * 17;
+			}
+
+			if ((block >> (texel + 16)) & 1)
+				modifier = -modifier;
+			if (hasAlpha)
+				a = (u32)((alpha >> (texel * 4)) & 0xF) * 17;
+
+			*output_pixel(out, width, height, bx + x, by + y) = pack_rgb565(
+				clamp_channel(r + modifier), clamp_channel(g + modifier), clamp_channel(b + modifier), a);
+		}
+	}
+}
+
+static void convert_etc1(const u8 *tex, u32 width, u32 height, bool hasAlpha, u16 *out)
+{
+	static const u8 blockOrigins[4][2] = { { 0, 0 }, { 4, 0 }, { 0, 4 }, { 4, 4 } };
+	u32 tx;
+	u32 ty;
+	u32 i;
+
+	for (ty = 0; ty < height; ty += 8) {
+		for (tx = 0; tx < width; tx += 8) {
+			for (i = 0; i < 4; i++) {
+				u64 alpha = 0;
+
+				if (hasAlpha) {
+					alpha = read_le64(tex);
+					tex += 8;
+				}
+				decode_etc1_block(read_le64(tex), alpha, hasAlpha, out, width, height,
+					tx + blockOrigins[i][0], ty + blockOrigins[i][1]);
+				tex += 8;
+			}
+		}
+	}
+}
+
+static title_banner_result_t convert_texture(const banner_capture_t *cap, title_banner_t *banner)
+{
+	u16 *pixels = (u16 *)malloc(cap->width * cap->height * sizeof(u16));
+
+	if (pixels == NULL)
+		return TITLE_BANNER_ERR_MEMORY;
+
+	if (cap->format == PICA_ETC1 || cap->format == PICA_ETC1A4)
+		convert_etc1(cap->tex, cap->width, cap->height, cap->format == PICA_ETC1A4, pixels);
+	else
+		convert_tiled(cap->tex, cap->width, cap->height, cap->format, pixels);
+
+	free(g_pixels);
+	g_pixels = pixels;
+	banner->pixels = pixels;
+	return TITLE_BANNER_OK;
+}
+
+title_banner_result_t title_banner_parse(const u8 *cbmd, size_t size, title_banner_t *banner)
+{
+	banner_capture_t *cap;
+	title_lz11_status_t status = TITLE_LZ11_DONE;
+	u32 cgfxOffset;
+	u32 cgfxEnd;
+	u64 start;
+
+	if (banner == NULL)
+		return TITLE_BANNER_ERR_FORMAT;
+
+	memset(banner, 0, sizeof(*banner));
+	g_cacheValid = false;
+	banner->result = TITLE_BANNER_ERR_FORMAT;
+
+	if (cbmd == NULL || size < BANNER_CBMD_MIN_SIZE || size > TITLE_BANNER_FILE_MAX ||
+	    memcmp(cbmd, "CBMD", 4) != 0)
+		return banner->result;
+
+	cgfxOffset = read_le32(cbmd + TITLE_BANNER_CBMD_COMMON_OFFSET);
+	cgfxEnd = read_le32(cbmd + BANNER_CBMD_CWAV_OFFSET);
+	if (cgfxEnd <= cgfxOffset || cgfxEnd > size)
+		cgfxEnd = (u32)size;
+	if (cgfxOffset >= cgfxEnd)
+		return banner->result;
+	banner->compressed_size = cgfxEnd - cgfxOffset;
+
+	cap = (banner_capture_t *)calloc(1, sizeof(*cap));
+	if (cap == NULL) {
+		banner->result = TITLE_BANNER_ERR_MEMORY;
+		return banner->result;
+	}
+	cap->error = TITLE_BANNER_OK;
+
+	start = perf_now();
+	if (cbmd[cgfxOffset] == 0x11) {
+		title_lz11_init(&cap->lz11, capture_sink, cap);
+		status = title_lz11_feed(&cap->lz11, cbmd + cgfxOffset, banner->compressed_size);
+		banner->decompressed_size = title_lz11_output_size(&cap->lz11);
+	} else {
+		/* Some tools store the common CGFX uncompressed. */
+		capture_sink(cap, cbmd + cgfxOffset, banner->compressed_size);
+		banner->decompressed_size = banner->compressed_size;
+	}
+	banner->decoded_size = cap->position;
+
+	if (cap->error != TITLE_BANNER_OK)
+		banner->result = cap->error;
+	else if (status == TITLE_LZ11_ERR_HEADER || status == TITLE_LZ11_ERR_DATA)
+		banner->result = TITLE_BANNER_ERR_FORMAT;
+	else if (!cap->resolved)
+		banner->result = TITLE_BANNER_ERR_NO_TEXTURE;
+	else if (cap->tex_captured < cap->tex_size)
+		banner->result = TITLE_BANNER_ERR_FORMAT;
+	else
+		banner->result = convert_texture(cap, banner);
+	banner->decode_us = perf_us_since(start);
+
+	if (cap->resolved) {
+		banner->width = cap->width;
+		banner->height = cap->height;
+		banner->texture_format = cap->format;
+	}
+
+	free(cap->tex);
+	free(cap);
+	return banner->result;
+}
+
+static title_banner_result_t read_banner_file(u64 titleId, FS_MediaType media, title_banner_t *banner)
+{
+	Handle handle;
+	FS_Archive archive;
+	u64 fileSize = 0;
+	u32 bytesRead = 0;
+	u8 *data;
+	Result res;
+
+	res = title_exefs_open(titleId, media, "banner", &handle, &archive);
+	if (R_FAILED(res)) {
+		banner->fs_result = res;
+		return TITLE_BANNER_ERR_OPEN;
+	}
+
+	res = FSFILE_GetSize(handle, &fileSize);
+	if (R_FAILED(res) || fileSize < BANNER_CBMD_MIN_SIZE || fileSize > TITLE_BANNER_FILE_MAX) {
+		title_exefs_close(handle, archive);
+		banner->fs_result = res;
+		return R_FAILED(res) ? TITLE_BANNER_ERR_READ : TITLE_BANNER_ERR_FORMAT;
+	}
+
+	data = (u8 *)malloc((size_t)fileSize);
+	if (data == NULL) {
+		title_exefs_close(handle, archive);
+		return TITLE_BANNER_ERR_MEMORY;
+	}
+
+	/* Like the icon, ExeFS files behind FSPXI must be read in a single request. */
+	res = FSFILE_Read(handle, &bytesRead, 0, data, (u32)fileSize);
+	title_exefs_close(handle, archive);
+	if (R_FAILED(res) || bytesRead != (u32)fileSize) {
+		free(data);
+		banner->fs_result = res;
+		return TITLE_BANNER_ERR_READ;
+	}
+
+	title_banner_parse(data, (size_t)fileSize, banner);
+	free(data);
+	return banner->result;
+}
+
+title_banner_result_t title_banner_load(u64 titleId, FS_MediaType media, title_banner_t *banner)
+{
+	if (banner == NULL)
+		return TITLE_BANNER_ERR_FORMAT;
+
+	if (g_cacheValid && g_cachedTitleId == titleId) {
+		*banner = g_cached;
+		return banner->result;
+	}
+
+	memset(banner, 0, sizeof(*banner));
+	banner->result = read_banner_file(titleId, media, banner);
+
+	g_cached = *banner;
+	g_cachedTitleId = titleId;
+	g_cacheValid = true;
+	return banner->result;
+}
+
+const char *title_banner_format_name(u32 format)
+{
+	switch (format) {
+	case PICA_RGBA8:
+		return "RGBA8";
+	case PICA_RGB8:
+		return "RGB8";
+	case PICA_RGBA5551:
+		return "RGBA5551";
+	case PICA_RGB565:
+		return "RGB565";
+	case PICA_RGBA4:
+		return "RGBA4";
+	case PICA_LA8:
+		return "LA8";
+	case PICA_L8:
+		return "L8";
+	case PICA_ETC1:
+		return "ETC1";
+	case PICA_ETC1A4:
+		return "ETC1A4";
+	default:
+		return "unknown";
+	}
+}
+
+float title_banner_decode_rate(const title_banner_t *banner)
+{
+	float seconds;
+
+	if (banner == NULL || banner->decode_us == 0)
+		return 0.0f;
+
+	seconds = (float)banner->decode_us / 1000000.0f;
+	return (float)banner->decoded_size / (1024.0f * 1024.0f) / seconds;
+}
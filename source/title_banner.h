@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_BANNER_H
+#define TITLE_BANNER_H
+
+#include <3ds.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* CBMD: "CBMD" magic, then the offset of the common (LZ11-compressed) CGFX model at 0x08. */
+#define TITLE_BANNER_CBMD_COMMON_OFFSET 0x08
+#define TITLE_BANNER_FILE_MAX (4 * 1024 * 1024)
+#define TITLE_BANNER_TEXTURE_DIM_MAX 1024
+#define TITLE_BANNER_TEXTURE_DATA_MAX (512 * 1024)
+
+typedef enum {
+	TITLE_BANNER_OK = 0,
+	TITLE_BANNER_ERR_OPEN,
+	TITLE_BANNER_ERR_READ,
+	TITLE_BANNER_ERR_FORMAT,
+	TITLE_BANNER_ERR_NO_TEXTURE,
+	TITLE_BANNER_ERR_UNSUPPORTED,
+	TITLE_BANNER_ERR_MEMORY,
+} title_banner_result_t;
+
+typedef struct {
+	title_banner_result_t result;
+	Result fs_result;
+	u32 width;
+	u32 height;
+	u32 texture_format;
+	u32 compressed_size;
+	/* CGFX size from the LZ11 header, and how much of it was decoded before the texture was complete. */
+	u32 decompressed_size;
+	u32 decoded_size;
+	u32 decode_us;
+	/* Row-major RGB565, top row first. Owned by the banner module; valid until the next load. */
+	const u16 *pixels;
+} title_banner_t;
+
+/// Read a title's ExeFS banner and extract the first CGFX image texture as RGB565.
+/// The last result is cached per title ID, so repeated calls for the same pick are free.
+title_banner_result_t title_banner_load(u64 titleId, FS_MediaType media, title_banner_t *banner);
+
+/// Parse an in-memory CBMD (no FS access). Decompression is streamed through a fixed
+/// window; only the texture bytes are kept. Pixels stay valid until the next parse/load.
+title_banner_result_t title_banner_parse(const u8 *cbmd, size_t size, title_banner_t *banner);
+
+/// PICA texture format name ("RGBA8", "ETC1", ...).
+const char *title_banner_format_name(u32 format);
+
+/// Decode throughput in MB/s (decoded CGFX bytes per second of decode time), 0 if unknown.
+float title_banner_decode_rate(const title_banner_t *banner);
+
+#endif
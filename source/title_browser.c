@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_browser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static int compare_entries(const void *a, const void *b)
+{
+	const title_browser_entry_t *ea = (const title_browser_entry_t *)a;
+	const title_browser_entry_t *eb = (const title_browser_entry_t *)b;
+	int order;
+
+	if (ea->name != NULL && eb->name != NULL) {
+		order = strcasecmp(ea->name, eb->name);
+		if (order != 0)
+			return order;
+	} else if (ea->name != NULL || eb->name != NULL) {
+		return ea->name != NULL ? -1 : 1;
+	}
+
+	if (ea->titleId != eb->titleId)
+		return ea->titleId < eb->titleId ? -1 : 1;
+	return 0;
+}
+
+void title_browser_open(title_browser_t *browser, const title_picker_pool_t *pool,
+	const title_source_t *titles, u32 titleCount, title_browser_key_fn key)
+{
+	u32 i;
+
+	if (browser == NULL)
+		return;
+
+	browser->count = 0;
+	if (pool == NULL || titles == NULL)
+		return;
+
+	for (i = 0; i < pool->count; i++) {
+		u32 active = pool->indices[i];
+		title_browser_entry_t *entry;
+
+		if (active >= titleCount)
+			continue;
+
+		entry = &browser->entries[browser->count++];
+		entry->titleId = titles[active].titleId;
+		entry->active = active;
+		entry->name = key != NULL ? key(active, entry->titleId) : NULL;
+		if (entry->name != NULL && entry->name[0] == '\0')
+			entry->name = NULL;
+	}
+
+	qsort(browser->entries, browser->count, sizeof(browser->entries[0]), compare_entries);
+}
+
+static const char *cached_name(const title_browser_t *browser, u64 titleId)
+{
+	u32 i;
+
+	for (i = 0; i < browser->name_count; i++) {
+		if (browser->names[i].titleId == titleId)
+			return browser->names[i].name;
+	}
+
+	return NULL;
+}
+
+const char *title_browser_known_name(const title_browser_t *browser, u32 position)
+{
+	const title_browser_entry_t *entry;
+
+	if (browser == NULL || position >= browser->count)
+		return NULL;
+
+	entry = &browser->entries[position];
+	return entry->name != NULL ? entry->name : cached_name(browser, entry->titleId);
+}
+
+const char *title_browser_name(title_browser_t *browser, u32 position, const title_source_t *titles,
+	title_browser_resolve_fn resolve)
+{
+	title_browser_entry_t *entry;
+	title_browser_name_t *slot;
+	const char *name;
+
+	if (browser == NULL || position >= browser->count)
+		return "";
+
+	name = title_browser_known_name(browser, position);
+	if (name != NULL)
+		return name;
+
+	entry = &browser->entries[position];
+
+	slot = &browser->names[browser->next_name];
+	browser->next_name = (browser->next_name + 1) % TITLE_BROWSER_NAME_CACHE;
+	if (browser->name_count < TITLE_BROWSER_NAME_CACHE)
+		browser->name_count++;
+
+	slot->titleId = entry->titleId;
+	browser->resolve_count++;
+	if (resolve == NULL || titles == NULL ||
+	    !resolve(entry->titleId, titles[entry->active].media, slot->name, sizeof(slot->name)))
+		snprintf(slot->name, sizeof(slot->name), "%016llx", entry->titleId);
+	return slot->name;
+}
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_BROWSER_H
+#define TITLE_BROWSER_H
+
+#include <3ds.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "title_picker.h"
+
+#define TITLE_BROWSER_NAME_MAX 128
+/* Names read on demand (titles neither indexed nor in the catalog); a ring, oldest replaced. */
+#define TITLE_BROWSER_NAME_CACHE 64
+
+/// Cheap sort name for a title (index or catalog). NULL if only an SMDH read would tell.
+typedef const char *(*title_browser_key_fn)(u32 activeIndex, u64 titleId);
+
+/// Read a name on demand (e.g. from the SMDH). Return false if the title has none.
+typedef bool (*title_browser_resolve_fn)(u64 titleId, FS_MediaType media, char *out, size_t outSize);
+
+typedef struct {
+	u64 titleId;
+	/* Index into the active title list. */
+	u32 active;
+	/* Sort name; NULL sorts after every named title, by title ID. */
+	const char *name;
+} title_browser_entry_t;
+
+typedef struct {
+	u64 titleId;
+	char name[TITLE_BROWSER_NAME_MAX];
+} title_browser_name_t;
+
+typedef struct {
+	title_browser_entry_t entries[TITLE_PICKER_POOL_MAX];
+	u32 count;
+	/* Ring of the last TITLE_BROWSER_NAME_CACHE names read, kept across opens; the oldest is
+	 * overwritten (and read again when next shown) once the ring is full. */
+	title_browser_name_t names[TITLE_BROWSER_NAME_CACHE];
+	u32 name_count;
+	u32 next_name;
+	/* On-demand reads since start-up. */
+	u32 resolve_count;
+} title_browser_t;
+
+/// List the pool sorted by name (case-insensitive). Costs one key lookup per title and a sort;
+/// titles without a cheap name are not read here.
+void title_browser_open(title_browser_t *browser, const title_picker_pool_t *pool,
+	const title_source_t *titles, u32 titleCount, title_browser_key_fn key);
+
+/// Name of the entry at a sorted position if it is known without a read (sort name or cached), else NULL.
+const char *title_browser_known_name(const title_browser_t *browser, u32 position);
+
+/// Display name of the entry at a sorted position, resolving (and caching) it on first use.
+/// Never NULL: titles without any name show their title ID.
+const char *title_browser_name(title_browser_t *browser, u32 position, const title_source_t *titles,
+	title_browser_resolve_fn resolve);
+
+#endif
@@ -10,7 +10,7 @@
 
 static const title_entry_t title_database[] = {
     {0x000400000002FF00ULL, "BigBlueMenu"},
-    {0x0004000000030000ULL, "New Hikari mythical Parthena mirror(新･光神話 パルテナの鏡)"},
+    {0x0004000000030000ULL, "New Hikari mythical Parthena mirror(新-光神話 パルテナの鏡)"},
     {0x0004000000030100ULL, "Kid Icarus(TM): Uprising"},
     {0x0004000000030200ULL, "Kid Icarus(TM): Uprising"},
     {0x0004000000030300ULL, "Steel diver(スティールダイバー)"},
@@ -24,11 +24,11 @@ static const title_entry_t title_database[] = {
     {0x0004000000030C00ULL, "Golden Retriever and New Friends"},
     {0x0004000000030D00ULL, "nintendogs(TM) + cats: Golden Retriever"},
     {0x0004000000030F00ULL, "Nintendogs + Cats Shiva Inu and New Friends(nintendogs + cats 시바 이누 and NEW친구들)"},
-    {0x0004000000031000ULL, "Nintendogs + CATS French Bull and NEW Friends(nintendogs + cats フレンチ･ブル and Newフレンズ)"},
+    {0x0004000000031000ULL, "Nintendogs + CATS French Bull and NEW Friends(nintendogs + cats フレンチ-ブル and Newフレンズ)"},
     {0x0004000000031100ULL, "French Bulldog and New Friends"},
     {0x0004000000031200ULL, "nintendogs(TM) + cats: French Bulldog"},
     {0x0004000000031400ULL, "Nintendogs + Cats French Fire and New Friends(nintendogs + cats 프렌치 불 and NEW친구들)"},
-    {0x0004000000031500ULL, "Nintendogs + Cats Toy Poodle and NEW Friends(nintendogs + cats トイ･プードル and Newフレンズ)"},
+    {0x0004000000031500ULL, "Nintendogs + Cats Toy Poodle and NEW Friends(nintendogs + cats トイ-プードル and Newフレンズ)"},
     {0x0004000000031600ULL, "Toy Poodle and New Friends"},
     {0x0004000000031700ULL, "nintendogs(TM) + cats: Toy Poodle"},
     {0x0004000000031900ULL, "nintendogs + cats poodle and new friends(nintendogs + cats 푸들 and NEW친구들)"},
@@ -67,12 +67,12 @@ static const title_entry_t title_database[] = {
     {0x0004000000034200ULL, "Virs Shooter XX(ウイルスシューターXX)"},
     {0x0004000000034300ULL, "Cubic Ninja(Cubic Ninja)"},
     {0x0004000000034400ULL, "TOM Clancy's Sprinter Cell 3D(Tom Clancy's スプリンターセル 3D)"},
-    {0x0004000000034500ULL, "Rabitz Time Travel(ラビッツ タイム・トラベル)"},
+    {0x0004000000034500ULL, "Rabitz Time Travel(ラビッツ タイム-トラベル)"},
     {0x0004000000034600ULL, "Ghost Recon Shadow War(ゴーストリコン シャドーウォー)"},
     {0x0004000000034700ULL, "Itsunomani terebi"},
     {0x0004000000034800ULL, "Doctor Rotalk and Oblivion Knights(ドクターロートレックと 忘却の騎士団)"},
     {0x0004000000034900ULL, "Professional Baseball Spirits 2011(プロ野球スピリッツ2011)"},
-    {0x0004000000034A00ULL, "BLAZBLUE CONTINUUM SHIFT Ⅱ(BLAZBLUE CONTINUUM SHIFT Ⅱ)"},
+    {0x0004000000034A00ULL, "BLAZBLUE CONTINUUM SHIFT II(BLAZBLUE CONTINUUM SHIFT II)"},
     {0x0004000000034B00ULL, "Combat of Giants - Dinosaurs 3D"},
     {0x0004000000034C00ULL, "Asphalt(TM) 3D"},
     {0x0004000000034D00ULL, "SAMURAI WARRIORS(R): Chronicles"},
@@ -116,7 +116,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000037B00ULL, "James Noirs Hollywood Crimes 3D"},
     {0x0004000000037C00ULL, "PES 2011 3D"},
     {0x0004000000037D00ULL, "Pro Evolution Soccer 2011 3D"},
-    {0x0004000000037F00ULL, "The Sims 3(ザ・シムズ3)"},
+    {0x0004000000037F00ULL, "The Sims 3(ザ-シムズ3)"},
     {0x0004000000038100ULL, "Pilotwings Resort"},
     {0x0004000000038200ULL, "Pilotwings Resort"},
     {0x0004000000038300ULL, "LEGO Star Wars III - The Clone Wars"},
@@ -199,7 +199,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000043900ULL, "Cartoon Network Punch Time Explosion"},
     {0x0004000000043A00ULL, "Captain America - Super Soldier"},
     {0x0004000000043B00ULL, "Thor(TM): God of Thunder"},
-    {0x0004000000043E00ULL, "Resident Evil The Mercenaries 3D(バイオハザード ザ･マーセナリーズ 3D)"},
+    {0x0004000000043E00ULL, "Resident Evil The Mercenaries 3D(バイオハザード ザ-マーセナリーズ 3D)"},
     {0x0004000000043F00ULL, "Fishing 3D(フィッシング3D)"},
     {0x0004000000044000ULL, "Marvel Super Hero Squad - The Infinity Gauntlet"},
     {0x0004000000044200ULL, "Angler's Club: Ultimate Bass Fishing(TM) 3D"},
@@ -341,13 +341,13 @@ static const title_entry_t title_database[] = {
     {0x000400000004FA00ULL, "Pac-Man(パックマン)"},
     {0x000400000004FB00ULL, "PAC-MAN(R)"},
     {0x000400000004FC00ULL, "PAC-MAN(TM)"},
-    {0x000400000004FD00ULL, "Takahashi Master's Adventure Island II(高橋名人の冒険島Ⅱ)"},
+    {0x000400000004FD00ULL, "Takahashi Master's Adventure Island II(高橋名人の冒険島II)"},
     {0x000400000004FE00ULL, "Adventure Island"},
     {0x000400000004FF00ULL, "ADVENTURE ISLAND"},
     {0x0004000000050000ULL, "Super Donkey Kong GB(スーパードンキーコングGB)"},
     {0x0004000000050100ULL, "Donkey Kong Land(TM)"},
     {0x0004000000050200ULL, "Donkey Kong(TM) Land"},
-    {0x0004000000050300ULL, "Metroid II Return of Samus(メトロイドⅡ RETURN OF SAMUS)"},
+    {0x0004000000050300ULL, "Metroid II Return of Samus(メトロイドII RETURN OF SAMUS)"},
     {0x0004000000050400ULL, "Metroid(TM) II - Return of Samus(TM)"},
     {0x0004000000050500ULL, "Metroid(TM) II - Return of Samus"},
     {0x0004000000050600ULL, "Doctor Mario(ドクターマリオ)"},
@@ -391,7 +391,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000053100ULL, "VectorRacing(VectorRacing)"},
     {0x0004000000053200ULL, "In between between the sound of the mystery hall(謎惑館 音の間に間に)"},
     {0x0004000000053500ULL, "Mario and Sonic London Olympics (TM)(마리오와 소닉 런던 올림픽(TM))"},
-    {0x0004000000053600ULL, "Penguin's problem The Wars(ペンギンの問題 ザ・ウォーズ)"},
+    {0x0004000000053600ULL, "Penguin's problem The Wars(ペンギンの問題 ザ-ウォーズ)"},
     {0x0004000000053700ULL, "Extropers(エクストルーパーズ)"},
     {0x0004000000053800ULL, "Frogger 3D(フロッガー3D)"},
     {0x0004000000053A00ULL, "Poyopoyo observation diary(ポヨポヨ観察日記)"},
@@ -463,9 +463,9 @@ static const title_entry_t title_database[] = {
     {0x0004000000059600ULL, "Selection selected person(セレクション 選ばれし者)"},
     {0x0004000000059900ULL, "LOCK'N CHASE"},
     {0x0004000000059A00ULL, "Lock'N Chase"},
-    {0x0004000000059B00ULL, "The Rolling Western(ザ･ローリング･ウエスタン)"},
+    {0x0004000000059B00ULL, "The Rolling Western(ザ-ローリング-ウエスタン)"},
     {0x0004000000059C00ULL, "Super speed deformation gyrosetter Alvarus wings(超速変形ジャイロゼッター アルバロスの翼)"},
-    {0x0004000000059E00ULL, "If you are in a closed room with a girl, you may be doing XX.(女の子と密室にいたら ○○しちゃうかもしれない。)"},
+    {0x0004000000059E00ULL, "If you are in a closed room with a girl, you may be doing XX.(女の子と密室にいたら OOしちゃうかもしれない。)"},
     {0x0004000000059F00ULL, "World Soccer Winning Eleven 2012(ワールドサッカー ウイニングイレブン 2012)"},
     {0x000400000005A000ULL, "EarthPedia(Earthpedia(アースペディア))"},
     {0x000400000005A100ULL, "Arc Style: Three Kingdoms Pinball(ARC STYLE: 三国志Pinball)"},
@@ -586,11 +586,11 @@ static const title_entry_t title_database[] = {
     {0x0004000000064200ULL, "Picross E(ピクロスe)"},
     {0x0004000000064300ULL, "Rettsu! Gorufu 3D"},
     {0x0004000000064400ULL, "Okukuru Golf 3D(おきらくゴルフ3D)"},
-    {0x0004000000064500ULL, "Tintin Adventure ★ Secret of Unicorn ★(タンタンの冒険 ★ユニコーン号の秘密★)"},
+    {0x0004000000064500ULL, "Tintin Adventure * Secret of Unicorn *(タンタンの冒険 *ユニコーン号の秘密*)"},
     {0x0004000000064600ULL, "I hurt him count(AZITO 3D)"},
     {0x0004000000064700ULL, "Ace Combat 3D Cross Rumble(エースコンバット 3D クロスランブル)"},
     {0x0004000000064900ULL, "ACE COMBAT(R) Assault Horizon Legacy"},
-    {0x0004000000064A00ULL, "Moe Moe Great War ☆ Gendai Ban 3D(萌え萌え大戦争☆げんだいばーん 3D)"},
+    {0x0004000000064A00ULL, "Moe Moe Great War * Gendai Ban 3D(萌え萌え大戦争*げんだいばーん 3D)"},
     {0x0004000000064C00ULL, "Spring Ringuke Anatouus(疾走すりぬけ アナトウス)"},
     {0x0004000000064D00ULL, "Mario Tennis Open(マリオテニス オープン)"},
     {0x0004000000064E00ULL, "The Whitakers present Milton and Friends 3D"},
@@ -599,14 +599,14 @@ static const title_entry_t title_database[] = {
     {0x0004000000065100ULL, "Spider-Man - Edge of Time"},
     {0x0004000000065200ULL, "Order Up!!"},
     {0x0004000000065600ULL, "Brave Company Brave Company(勇現会社ブレイブカンパニー)"},
-    {0x0004000000065700ULL, "NICOLA supervised model ☆ Stylish audition 2(nicola監修 モデル☆おしゃれオーディション 2)"},
+    {0x0004000000065700ULL, "NICOLA supervised model * Stylish audition 2(nicola監修 モデル*おしゃれオーディション 2)"},
     {0x0004000000065800ULL, "Rune Factory 4(ルーンファクトリー4)"},
     {0x0004000000065900ULL, "Girls RPG Cinderife(ガールズRPG シンデレライフ)"},
     {0x0004000000065A00ULL, "Medalot 7 stag Ver.(メダロット7 クワガタ Ver.)"},
     {0x0004000000065B00ULL, "Medalot 7 Kabuto Ver.(メダロット7 カブト Ver.)"},
     {0x0004000000065C00ULL, "Beyond Labyrinth(ラビリンスの彼方)"},
-    {0x0004000000065D00ULL, "Girls fashion 3D ☆ Aim! Top stylist(ガールズファッション3D☆ めざせ!トップスタイリスト)"},
-    {0x0004000000065E00ULL, "Dragon Quest ⅶ Eden Warriors(ドラゴンクエストⅦ エデンの戦士たち)"},
+    {0x0004000000065D00ULL, "Girls fashion 3D * Aim! Top stylist(ガールズファッション3D* めざせ!トップスタイリスト)"},
+    {0x0004000000065E00ULL, "Dragon Quest VII Eden Warriors(ドラゴンクエストVII エデンの戦士たち)"},
     {0x0004000000065F00ULL, "Ninjibi 3D(Shinobi 3D)"},
     {0x0004000000066000ULL, "Ben 10 - Galactic Racing"},
     {0x0004000000066100ULL, "Winter Sports 2012 - Feel the Spirit"},
@@ -706,14 +706,14 @@ static const title_entry_t title_database[] = {
     {0x000400000006D700ULL, "Pets Resort 3D"},
     {0x000400000006D900ULL, "4 Elements"},
     {0x000400000006DA00ULL, "Rhythm Thief and the Emperor's Treasure"},
-    {0x000400000006DB00ULL, "Princess Gal ♥ Paradise Metikawa!(姫ギャル♥パラダイス メチカワ! アゲ盛り↑センセーション!)"},
+    {0x000400000006DB00ULL, "Princess Gal * Paradise Metikawa!(姫ギャル*パラダイス メチカワ! アゲ盛りセンセーション!)"},
     {0x000400000006DC00ULL, "ARC Style: Happy Ocean(ARC STYLE: ハッピーオーシャン)"},
     {0x000400000006DD00ULL, "To Nikori's puzzle(ニコリのパズル へやわけ)"},
     {0x000400000006DE00ULL, "Okukuru Bowling 3D(おきらくボウリング3D)"},
     {0x000400000006DF00ULL, "Phantom Thief Stina and 30 jewels(怪盗スティナと30の宝石)"},
     {0x000400000006E000ULL, "Takaya Riman(タケヤリマン)"},
     {0x000400000006E100ULL, "Super -high -rise construction plan Bildinger(超高層建造計画 ビルディンガー)"},
-    {0x000400000006E200ULL, "Need for Speed The Run(ニード･フォー･スピード ザ･ラン)"},
+    {0x000400000006E200ULL, "Need for Speed The Run(ニード-フォー-スピード ザ-ラン)"},
     {0x000400000006E300ULL, "Nikori Puzzle Coloring(ニコリのパズル ぬりかべ)"},
     {0x000400000006E400ULL, "Super mario bros(スーパーマリオブラザーズ)"},
     {0x000400000006E500ULL, "Super Mario Bros.(TM)"},
@@ -772,7 +772,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000072400ULL, "Nintendo 3DS Ambassador Certificate"},
     {0x0004000000072500ULL, "Ambassador Certificate"},
     {0x0004000000072700ULL, "Mighty Switch Force!"},
-    {0x0004000000072A00ULL, "True ･ Three Kingdoms Warriors VS(真･三國無双 VS)"},
+    {0x0004000000072A00ULL, "True - Three Kingdoms Warriors VS(真-三國無双 VS)"},
     {0x0004000000072B00ULL, "Murder on the Titanic"},
     {0x0004000000072C00ULL, "Secret Agent Files - Miami"},
     {0x0004000000073200ULL, "Pokemon AR searcher(ポケモンARサーチャー)"},
@@ -828,13 +828,13 @@ static const title_entry_t title_database[] = {
     {0x0004000000077B00ULL, "Petz(R) Countryside"},
     {0x0004000000077C00ULL, "Petz(R) Beach"},
     {0x0004000000077E00ULL, "Radio human RPG(電波人間のRPG)"},
-    {0x0004000000077F00ULL, "Rabbi x Rabi Eposod 3(ラビ×ラビ えぴそーど3)"},
+    {0x0004000000077F00ULL, "Rabbi x Rabi Eposod 3(ラビxラビ えぴそーど3)"},
     {0x0004000000078000ULL, "ARC Style: Simple Mahjong 3D(ARC STYLE: シンプル麻雀3D)"},
     {0x0004000000078100ULL, "Rhythm Phantom Thief R Emperor Napoleon's heritage(リズム怪盗R 皇帝ナポレオンの遺産)"},
     {0x0004000000078200ULL, "THEATRHYTHM FINAL FANTASY(THEATRHYTHM FINAL FANTASY)"},
     {0x0004000000078300ULL, "Dora Kazu Nobita's Suji Daikyo Adventure(ドラかず のび太のすうじ大冒険)"},
     {0x0004000000078500ULL, "Cardboard fighter explosion boost(ダンボール戦機 爆ブースト)"},
-    {0x0004000000078600ULL, "Happy ☆ Animal Ranch(ハッピー☆アニマル牧場)"},
+    {0x0004000000078600ULL, "Happy * Animal Ranch(ハッピー*アニマル牧場)"},
     {0x0004000000078900ULL, "Living with a stylish hamster(おしゃれハムスターと暮らそう いっしょにおでかけ)"},
     {0x0004000000078A00ULL, "Super Robot Wars UX(スーパーロボット大戦UX)"},
     {0x0004000000078B00ULL, "Professor Layton vs Reversal Trial(レイトン教授VS逆転裁判)"},
@@ -911,7 +911,7 @@ static const title_entry_t title_database[] = {
     {0x000400000007FE00ULL, "Transformers Prime - The Game"},
     {0x000400000007FF00ULL, "Zombie Slayer Diox(TM)"},
     {0x0004000000080000ULL, "Battleship"},
-    {0x0004000000080100ULL, "Labyrinth of World Tree II Traditional Giant God(世界樹の迷宮Ⅳ 伝承の巨神)"},
+    {0x0004000000080100ULL, "Labyrinth of World Tree II Traditional Giant God(世界樹の迷宮IV 伝承の巨神)"},
     {0x0004000000080300ULL, "TEKKEN 3D Prime Edition"},
     {0x0004000000080400ULL, "Kemonomics+(ケモノミクス+)"},
     {0x0004000000080500ULL, "CAHIER ~ Fairing(CahiEr ～飼い絵～)"},
@@ -938,10 +938,10 @@ static const title_entry_t title_database[] = {
     {0x0004000000082D00ULL, "Tumble pop(タンブルポップ)"},
     {0x0004000000082E00ULL, "Tumble Pop(TM)"},
     {0x0004000000082F00ULL, "Tumble Pop"},
-    {0x0004000000083000ULL, "Selection Ⅱ Dark seal(セレクションⅡ 暗黒の封印)"},
+    {0x0004000000083000ULL, "Selection II Dark seal(セレクションII 暗黒の封印)"},
     {0x0004000000083100ULL, "The Sword of Hope II"},
     {0x0004000000083200ULL, "The Sword of Hope II"},
-    {0x0004000000083500ULL, "Rayman Mister Dark Trap(レイマン ミスター･ダークの罠)"},
+    {0x0004000000083500ULL, "Rayman Mister Dark Trap(レイマン ミスター-ダークの罠)"},
     {0x0004000000083600ULL, "Rayman(R)"},
     {0x0004000000083700ULL, "Rayman(R)"},
     {0x0004000000083800ULL, "Ketzal's Corridors(TM)"},
@@ -992,7 +992,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000088700ULL, "Sonic the Hedgehog(TM): Triple Trouble"},
     {0x0004000000088800ULL, "Dragon Crystal(TM)"},
     {0x0004000000088900ULL, "The Amazing Spider-Man"},
-    {0x0004000000088A00ULL, "Shin Megami Tensei IV(真･女神転生Ⅳ)"},
+    {0x0004000000088A00ULL, "Shin Megami Tensei IV(真-女神転生IV)"},
     {0x0004000000088B00ULL, "Bloody Vampire(ブラッディヴァンパイア)"},
     {0x0004000000088E00ULL, "@Simple DL Series Vol.3 The Escape Celebrity Mansion Edition from the closed room(@SIMPLE DLシリーズ Vol.3 THE 密室からの脱出 セレブな豪邸編)"},
     {0x0004000000088F00ULL, "Hyper paddle block lasher(ハイパーパドル ブロックラッシャー)"},
@@ -1048,7 +1048,7 @@ static const title_entry_t title_database[] = {
     {0x000400000008C500ULL, "Tomodachi Collection New Life(トモダチコレクション 新生活)"},
     {0x000400000008C600ULL, "TIME TRAVELERS(TIME TRAVELERS)"},
     {0x000400000008C700ULL, "Okukuru Millionaire 3D(おきらく大富豪3D)"},
-    {0x000400000008C800ULL, "Dragon Quest ⅹ Outing Moshaus de Battle(ドラゴンクエストⅩ おでかけモシャスdeバトル)"},
+    {0x000400000008C800ULL, "Dragon Quest X Outing Moshaus de Battle(ドラゴンクエストX おでかけモシャスdeバトル)"},
     {0x000400000008C900ULL, "Marvel Pinball 3D"},
     {0x000400000008CA00ULL, "Petz(R) Countryside"},
     {0x000400000008CB00ULL, "Petz(R) Beach"},
@@ -1100,7 +1100,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000091A00ULL, "Junior Games 3D"},
     {0x0004000000091D00ULL, "Skylanders Giants(TM)"},
     {0x0004000000091E00ULL, "Tekken 3D Prime Edition(철권 3D 프라임 에디션)"},
-    {0x0004000000091F00ULL, "National Model ★ Audition Superstar 2(전국민 모델★오디션 슈퍼스타 2)"},
+    {0x0004000000091F00ULL, "National Model * Audition Superstar 2(전국민 모델*오디션 슈퍼스타 2)"},
     {0x0004000000092000ULL, "Gummy Bears Magical Medallion"},
     {0x0004000000092100ULL, "Bowling Bonanza 3D"},
     {0x0004000000092200ULL, "Sudoku by Nikoli"},
@@ -1145,7 +1145,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000094D00ULL, "Toki Tori"},
     {0x0004000000094E00ULL, "Super Mario Bros.(TM): The Lost Levels"},
     {0x0004000000094F00ULL, "Super Mario Bros.(TM): The Lost Levels(TM)"},
-    {0x0004000000095000ULL, "Pokemon Mysterious Dungeon -Magned Gate and ∞ Labyrinth-(ポケモン不思議のダンジョン ～マグナゲートと∞迷宮～)"},
+    {0x0004000000095000ULL, "Pokemon Mysterious Dungeon -Magned Gate and Labyrinth-(ポケモン不思議のダンジョン ～マグナゲートと迷宮～)"},
     {0x0004000000095100ULL, "THEATRHYTHM(TM) FINAL FANTASY(R)"},
     {0x0004000000095200ULL, "Aqua Moto Racing 3D(TM)"},
     {0x0004000000095300ULL, "Dot Runner: Complete Edition"},
@@ -1156,7 +1156,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000095800ULL, "Art Academy(TM): Lessons for Everyone!"},
     {0x0004000000095900ULL, "Akari by Nikoli"},
     {0x0004000000095B00ULL, "Observation set(こびとづかん こびと観察セット)"},
-    {0x0004000000095C00ULL, "Disney Magic Castle My Happy Life(ディズニー マジックキャッスル マイ･ハッピー･ライフ)"},
+    {0x0004000000095C00ULL, "Disney Magic Castle My Happy Life(ディズニー マジックキャッスル マイ-ハッピー-ライフ)"},
     {0x0004000000095E00ULL, "ARC STYLE: Baseball !! 3D(ARC STYLE: 野球!!3D)"},
     {0x0004000000095F00ULL, "ARC Style: Women's Soccer !! 3D(ARC STYLE: 女子サッカー!!3D)"},
     {0x0004000000096100ULL, "VVVVVV"},
@@ -1178,12 +1178,12 @@ static const title_entry_t title_database[] = {
     {0x0004000000097500ULL, "The Phantom Thief Stina and the 30 Jewels"},
     {0x0004000000097900ULL, "Shifting World"},
     {0x0004000000097A00ULL, "LEra Glaciale 4 - Continenti alla Deriva - Giochi Polari"},
-    {0x0004000000097C00ULL, "Shadam Kurcader far kingdom(シャダム･クルセイダー 遥かなる王国)"},
+    {0x0004000000097C00ULL, "Shadam Kurcader far kingdom(シャダム-クルセイダー 遥かなる王国)"},
     {0x0004000000098000ULL, "Arriel Crystal Legend(アーリエル クリスタル伝説)"},
     {0x0004000000098100ULL, "G-LOC AIR BATTLE(G-LOC AIR BATTLE)"},
     {0x0004000000098200ULL, "IN THE WAKE OF VAMPIRE(IN THE WAKE OF VAMPIRE)"},
     {0x0004000000098300ULL, "Puyo Puyo(ぷよぷよ)"},
-    {0x0004000000098400ULL, "Shining Force Gaiden Ⅱ The awakening of the evil god(シャイニング･フォース外伝Ⅱ 邪神の覚醒)"},
+    {0x0004000000098400ULL, "Shining Force Gaiden II The awakening of the evil god(シャイニング-フォース外伝II 邪神の覚醒)"},
     {0x0004000000098500ULL, "LEGO Batman 2 - DC Super Heroes"},
     {0x0004000000098600ULL, "LEGO Batman 2 - DC Super Heroes"},
     {0x0004000000098700ULL, "Wreck-It Ralph"},
@@ -1251,7 +1251,7 @@ static const title_entry_t title_database[] = {
     {0x000400000009D500ULL, "Spy Hunter"},
     {0x000400000009D600ULL, "Doragon kuesuto _ - b_ken-sha no o dekake benri ts_ru"},
     {0x000400000009D700ULL, "Hot -blooded hard -to -kun oct(熱血硬派くにおくん 番外乱闘編)"},
-    {0x000400000009D800ULL, "Goddess Reincarnation Last Bible III(女神転生外伝ラストバイブルⅡ)"},
+    {0x000400000009D800ULL, "Goddess Reincarnation Last Bible III(女神転生外伝ラストバイブルII)"},
     {0x000400000009DA00ULL, "Rado Castle Dracula(悪魔城ドラキュラ)"},
     {0x000400000009DB00ULL, "Castlevania(R)"},
     {0x000400000009DC00ULL, "Castlevania(TM)"},
@@ -1302,10 +1302,10 @@ static const title_entry_t title_database[] = {
     {0x00040000000A1600ULL, "Mega Man(TM) 6"},
     {0x00040000000A1700ULL, "Mega Man(TM) 6"},
     {0x00040000000A1A00ULL, "Homemai Nichitamagotchi(おうちまいにち たまごっち)"},
-    {0x00040000000A1B00ULL, "Inazuma Eleven GO2 Chrono Stone Nepu(イナズマイレブンGO2 クロノ･ストーン ネップウ)"},
-    {0x00040000000A1C00ULL, "Inazuma Eleven GO2 Chrono Stone Remay(イナズマイレブンGO2 クロノ･ストーン ライメイ)"},
+    {0x00040000000A1B00ULL, "Inazuma Eleven GO2 Chrono Stone Nepu(イナズマイレブンGO2 クロノ-ストーン ネップウ)"},
+    {0x00040000000A1C00ULL, "Inazuma Eleven GO2 Chrono Stone Remay(イナズマイレブンGO2 クロノ-ストーン ライメイ)"},
     {0x00040000000A1D00ULL, "Wan Nyan Animal Hospital 2(わんニャンどうぶつ病院2)"},
-    {0x00040000000A1E00ULL, "Chibi ☆ Devi!(ちび☆デビ!)"},
+    {0x00040000000A1E00ULL, "Chibi * Devi!(ちび*デビ!)"},
     {0x00040000000A1F00ULL, "AZITO 3D Tokyo"},
     {0x00040000000A2000ULL, "King of the Takakari King(鷹狩王)"},
     {0x00040000000A2100ULL, "Finding Nemo - Escape to the Big Blue - Special Edition"},
@@ -1382,7 +1382,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000A7800ULL, "Aikatsu! Cinderella Lesson(アイカツ!シンデレラレッスン)"},
     {0x00040000000A7900ULL, "Radio humans RPG2(電波人間のRPG2)"},
     {0x00040000000A7A00ULL, "@Simple DL Series Vol.4 The Escape from the closed room(@SIMPLE DLシリーズ Vol.4 THE 密室からの脱出 南国のリゾート編)"},
-    {0x00040000000A7B00ULL, "Jewel Pet Magical Dance with magic ☆ Deco ~!(ジュエルペット 魔法でおしゃれにダンス☆デコ～!)"},
+    {0x00040000000A7B00ULL, "Jewel Pet Magical Dance with magic * Deco ~!(ジュエルペット 魔法でおしゃれにダンス*デコ～!)"},
     {0x00040000000A7C00ULL, "Jewel Master - Cradle of Egypt 2 3D"},
     {0x00040000000A7D00ULL, "SpeedX 3D"},
     {0x00040000000A7E00ULL, "Crazy Kangaroo"},
@@ -1403,7 +1403,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000A9300ULL, "New Super Mario Bros._ 2 Trailer"},
     {0x00040000000A9500ULL, "Luigi_s Mansion_ Dark Moon Trailer"},
     {0x00040000000A9700ULL, "Paper Mario_ Sticker Star Trailer"},
-    {0x00040000000A9800ULL, "NICOLA supervised model ☆ Stylish audition platinum(nicola監修 モデル☆おしゃれ オーディション プラチナ)"},
+    {0x00040000000A9800ULL, "NICOLA supervised model * Stylish audition platinum(nicola監修 モデル*おしゃれ オーディション プラチナ)"},
     {0x00040000000A9900ULL, "Crazy Chicken Pirates 3D"},
     {0x00040000000A9A00ULL, "Nintendo dairekuto 2012. 6. 22 - Debirusaman_ souruhakk_zu"},
     {0x00040000000A9B00ULL, "Nintendo dairekuto 2012. 6. 22 - Ekusutor_p_zu"},
@@ -1434,11 +1434,11 @@ static const title_entry_t title_database[] = {
     {0x00040000000AC100ULL, "E 3 2012 - p_p_mario"},
     {0x00040000000AC700ULL, "Card Fight !! Vanguard Ride to Victory !!(カードファイト!! ヴァンガード ライド トゥ ビクトリー!!)"},
     {0x00040000000AC800ULL, "I am an Air Controller Airport Hero 3D Honolulu(ぼくは航空管制官 エアポートヒーロー3D ホノルル)"},
-    {0x00040000000AC900ULL, "Bear Tomo(クマ･トモ)"},
+    {0x00040000000AC900ULL, "Bear Tomo(クマ-トモ)"},
     {0x00040000000ACA00ULL, "Torico Guremon Stars!(トリコ グルメモンスターズ!)"},
     {0x00040000000ACC00ULL, "Geist Crusher(ガイストクラッシャー)"},
-    {0x00040000000ACD00ULL, "Pachipara 3D Ocean Story 2 with Agnes Lamb(パチパラ3D 大海物語2 With アグネス･ラム)"},
-    {0x00040000000ACE00ULL, "Hermina Jugosic 3D Remix -Ulm Zakir and Dark Ritual-(エルミナージュゴシック3D REMIX ～ウルム･ザキールと闇の儀式～)"},
+    {0x00040000000ACD00ULL, "Pachipara 3D Ocean Story 2 with Agnes Lamb(パチパラ3D 大海物語2 With アグネス-ラム)"},
+    {0x00040000000ACE00ULL, "Hermina Jugosic 3D Remix -Ulm Zakir and Dark Ritual-(エルミナージュゴシック3D REMIX ～ウルム-ザキールと闇の儀式～)"},
     {0x00040000000ACF00ULL, "Paper Mario_ Sticker Star Trailer"},
     {0x00040000000AD000ULL, "Luigis Mansion_ Dark Moon Trailer"},
     {0x00040000000AD100ULL, "New Super Mario Bros._ 2"},
@@ -1561,7 +1561,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000B6600ULL, "Touch Battle Tank 3D"},
     {0x00040000000B6700ULL, "Every time(毎度 花札)"},
     {0x00040000000B6800ULL, "Kururin Sussie(クルりんスッシー)"},
-    {0x00040000000B6900ULL, "If you are in a closed room with a female tutor Ita, you may be able to do it.(女家庭教師 伊都香先生と密室にいたら○○しちゃうかもしれない。)"},
+    {0x00040000000B6900ULL, "If you are in a closed room with a female tutor Ita, you may be able to do it.(女家庭教師 伊都香先生と密室にいたらOOしちゃうかもしれない。)"},
     {0x00040000000B6A00ULL, "Touch Battle Tank 3D-2(タッチバトル戦車3D-2)"},
     {0x00040000000B6B00ULL, "@Simple DL Series Vol.6 The Escape Kumadonal Bowl Edition from the closed room(@SIMPLE DLシリーズ Vol.6 THE密室からの脱出クマドナルボウル編)"},
     {0x00040000000B6C00ULL, "Get a kingdom handsome boyfriend!(オレ様キングダム イケメン彼氏をゲットしよ!)"},
@@ -1614,8 +1614,8 @@ static const title_entry_t title_database[] = {
     {0x00040000000BB400ULL, "The Beet Party - Episode 4 - UnderWaterMelon"},
     {0x00040000000BB500ULL, "Kurabunintend_pikurosu"},
     {0x00040000000BB600ULL, "Style Savvy - Trendsetters"},
-    {0x00040000000BB800ULL, "Inazuma Eleven 1.2.3 !! Endo Mamoru Legend(イナズマイレブン1･2･3!! 円堂守伝説)"},
-    {0x00040000000BB900ULL, "Acrylic Palette -Color Cafe, CHEERS-(アクリルパレット ～彩りカフェ･Cheers～)"},
+    {0x00040000000BB800ULL, "Inazuma Eleven 1.2.3 !! Endo Mamoru Legend(イナズマイレブン1-2-3!! 円堂守伝説)"},
+    {0x00040000000BB900ULL, "Acrylic Palette -Color Cafe, CHEERS-(アクリルパレット ～彩りカフェ-Cheers～)"},
     {0x00040000000BBA00ULL, "Sonic the Hedgehog(TM)"},
     {0x00040000000BBB00ULL, "Sonic the Hedgehog 2"},
     {0x00040000000BBD00ULL, "Puzzler World 2013"},
@@ -1635,15 +1635,15 @@ static const title_entry_t title_database[] = {
     {0x00040000000BCF00ULL, "Mario Bros.(マリオブラザーズ)"},
     {0x00040000000BD000ULL, "Mario Bros(TM)"},
     {0x00040000000BD100ULL, "Mario Bros.(TM)"},
-    {0x00040000000BD200ULL, "NES Detective Club Part II girl standing in the back (front and rear)(ファミコン探偵倶楽部 PARTⅡ うしろに立つ少女(前後編))"},
+    {0x00040000000BD200ULL, "NES Detective Club Part II girl standing in the back (front and rear)(ファミコン探偵倶楽部 PARTII うしろに立つ少女(前後編))"},
     {0x00040000000BD300ULL, "Etrian Odyssey(TM) IV: Legends of the Titan"},
     {0x00040000000BD400ULL, "Puzzler Brain Games"},
     {0x00040000000BD700ULL, "Hot -blooded high school dodgeball club(熱血高校ドッジボール部)"},
     {0x00040000000BD800ULL, "Super Dodge Ball"},
     {0x00040000000BD900ULL, "Sugoro Quest Dice warriors(すごろクエスト ダイスの戦士たち)"},
-    {0x00040000000BDA00ULL, "Dracula Ⅱ Seal of curse(ドラキュラⅡ 呪いの封印)"},
+    {0x00040000000BDA00ULL, "Dracula II Seal of curse(ドラキュラII 呪いの封印)"},
     {0x00040000000BDB00ULL, "Castlevania II: Simon's Quest"},
-    {0x00040000000BDC00ULL, "Castlevania Ⅱ Simon's Quest"},
+    {0x00040000000BDC00ULL, "Castlevania II Simon's Quest"},
     {0x00040000000BDD00ULL, "Challenger(チャレンジャー)"},
     {0x00040000000BDE00ULL, "Dragon buster(ドラゴンバスター)"},
     {0x00040000000BE200ULL, "Dinosaur Office"},
@@ -1673,7 +1673,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000C0000ULL, "Star Frost Amazones(星霜のアマゾネス)"},
     {0x00040000000C0100ULL, "Magi's beginning labyrinth(マギ はじまりの迷宮)"},
     {0x00040000000C0200ULL, "Professor Layton and Super Civilization A heritage(レイトン教授と超文明Aの遺産)"},
-    {0x00040000000C0300ULL, "Pretty Rhythm My ☆ Decoraine Bow Wedding(プリティーリズム マイ☆デコレインボーウエディング)"},
+    {0x00040000000C0300ULL, "Pretty Rhythm My * Decoraine Bow Wedding(プリティーリズム マイ*デコレインボーウエディング)"},
     {0x00040000000C0400ULL, "Lolas Math Train"},
     {0x00040000000C0500ULL, "3D Game Collection"},
     {0x00040000000C0600ULL, "Farming Simulator 3D"},
@@ -1687,7 +1687,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000C0F00ULL, "Mahjong Mysteries - Ancient Athena"},
     {0x00040000000C1000ULL, "3D MahJongg"},
     {0x00040000000C1100ULL, "Murder on the Titanic"},
-    {0x00040000000C1200ULL, "Sonic the Hedgehog 2(ソニック･ザ･ヘッジホッグ2)"},
+    {0x00040000000C1200ULL, "Sonic the Hedgehog 2(ソニック-ザ-ヘッジホッグ2)"},
     {0x00040000000C1300ULL, "Tails adventure(テイルスアドベンチャー)"},
     {0x00040000000C1400ULL, "10-in-1: Arcade Collection"},
     {0x00040000000C1500ULL, "Wild Adventures: Ultimate Deer Hunt 3D"},
@@ -1725,7 +1725,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000C3900ULL, "Pazdora Z(パズドラＺ)"},
     {0x00040000000C3A00ULL, "Devil Survival 2 Blake Records(デビルサバイバー2 ブレイクレコード)"},
     {0x00040000000C3B00ULL, "Pachipara 3D Deluxe Sea Monogatari(パチパラ3D デラックス海物語)"},
-    {0x00040000000C3C00ULL, "Rodea the Sky Soldier(ロデア･ザ･スカイソルジャー)"},
+    {0x00040000000C3C00ULL, "Rodea the Sky Soldier(ロデア-ザ-スカイソルジャー)"},
     {0x00040000000C3D00ULL, "THEATRHYTHM FINAL FANTASY(THEATRHYTHM FINAL FANTASY)"},
     {0x00040000000C4000ULL, "Heavy Fire: Black Arms 3D"},
     {0x00040000000C4100ULL, "Of Goga(KOKUGA)"},
@@ -1749,7 +1749,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000C5E00ULL, "The 3D Machine Series: Episode 5"},
     {0x00040000000C6300ULL, "Gunman Clive"},
     {0x00040000000C6400ULL, "Project X Zone"},
-    {0x00040000000C6500ULL, "From beginners to the best in Japan, abacus, anzan, flash mental arithmetic(初心者から日本一まで そろばん･あんざん･フラッシュ暗算)"},
+    {0x00040000000C6500ULL, "From beginners to the best in Japan, abacus, anzan, flash mental arithmetic(初心者から日本一まで そろばん-あんざん-フラッシュ暗算)"},
     {0x00040000000C6600ULL, "Flipnote Studio 3D"},
     {0x00040000000C6700ULL, "Flipnote Studio 3D"},
     {0x00040000000C6800ULL, "Paper Mario Sticker Star(페이퍼 마리오 스티커 스타)"},
@@ -1759,7 +1759,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000C6E00ULL, "Secret Agent Files: Miami"},
     {0x00040000000C6F00ULL, "MH3U Data Transfer Program"},
     {0x00040000000C7100ULL, "Monster Hunter(TM) 3 Ultimate Data Transfer Program"},
-    {0x00040000000C7200ULL, "The Rolling Western Last Bouncer(ザ･ローリング･ウエスタン 最後の用心棒)"},
+    {0x00040000000C7200ULL, "The Rolling Western Last Bouncer(ザ-ローリング-ウエスタン 最後の用心棒)"},
     {0x00040000000C7300ULL, "Save Data Transfer Tool"},
     {0x00040000000C7400ULL, "URBAN TRIAL FREESTYLE"},
     {0x00040000000C7500ULL, "My Farm 3D"},
@@ -1805,7 +1805,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000CA300ULL, "Devil World(デビルワールド)"},
     {0x00040000000CA400ULL, "Devil World"},
     {0x00040000000CA500ULL, "Good luck Goemon! Karakuri Road(がんばれゴエモン!からくり道中)"},
-    {0x00040000000CA600ULL, "Takahashi Master's Adventure Island II(高橋名人の冒険島Ⅱ)"},
+    {0x00040000000CA600ULL, "Takahashi Master's Adventure Island II(高橋名人の冒険島II)"},
     {0x00040000000CA700ULL, "Adventure Island II"},
     {0x00040000000CA800ULL, "Hot -blooded hard(熱血硬派くにおくん)"},
     {0x00040000000CA900ULL, "Renegade(TM)"},
@@ -1859,7 +1859,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000CE300ULL, "Espard Dream(エスパードリーム)"},
     {0x00040000000CE400ULL, "Burn !! Professional baseball(燃えろ!!プロ野球)"},
     {0x00040000000CE500ULL, "Bases Loaded(TM)"},
-    {0x00040000000CE600ULL, "Famikonkakashi Tale New / Onigashima (front and back)(ふぁみこんむかし話 新･鬼ヶ島(前後編))"},
+    {0x00040000000CE600ULL, "Famikonkakashi Tale New / Onigashima (front and back)(ふぁみこんむかし話 新-鬼ヶ島(前後編))"},
     {0x00040000000CEC00ULL, "Gummy Bears Mini Golf"},
     {0x00040000000CEE00ULL, "CRAZY CONSTRUCTION"},
     {0x00040000000CEF00ULL, "Swords and Soldiers 3D"},
@@ -1869,9 +1869,9 @@ static const title_entry_t title_database[] = {
     {0x00040000000CF300ULL, "Custom Monsters(カスタムモンスターズ)"},
     {0x00040000000CF400ULL, "Youkai watch(妖怪ウォッチ)"},
     {0x00040000000CF500ULL, "Dragon Quest Monsters 2 Il and Luka's mysterious mysterious key(ドラゴンクエストモンスターズ2 イルとルカの不思議なふしぎな鍵)"},
-    {0x00040000000CF600ULL, "Conception II's guidance and muzzle nightmare(CONCEPTIONⅡ 七星の導きとマズルの悪夢)"},
+    {0x00040000000CF600ULL, "Conception II's guidance and muzzle nightmare(CONCEPTIONII 七星の導きとマズルの悪夢)"},
     {0x00040000000CF700ULL, "Doraemon Nobita's Secret Tool Museum(ドラえもん のび太のひみつ道具博物館)"},
-    {0x00040000000CF800ULL, "New World Tree Labyrinth Millennium Girl(新･世界樹の迷宮 ミレニアムの少女)"},
+    {0x00040000000CF800ULL, "New World Tree Labyrinth Millennium Girl(新-世界樹の迷宮 ミレニアムの少女)"},
     {0x00040000000CF900ULL, "Pokemon Art Academy(ポケモンアートアカデミー)"},
     {0x00040000000CFA00ULL, "Adventure Island II"},
     {0x00040000000CFB00ULL, "Around the World with Hello Kitty and Friends"},
@@ -1920,8 +1920,8 @@ static const title_entry_t title_database[] = {
     {0x00040000000D3100ULL, "Mysterious village rain castle(謎の村雨城)"},
     {0x00040000000D3200ULL, "The Mysterious Murasame Castle"},
     {0x00040000000D3300ULL, "The Mysterious Murasame Castle"},
-    {0x00040000000D3400ULL, "E -Al Kung Fu(イー･アル･カンフー)"},
-    {0x00040000000D3500ULL, "Double Dragon II THE REVENGE(ダブルドラゴンⅡ The Revenge)"},
+    {0x00040000000D3400ULL, "E -Al Kung Fu(イー-アル-カンフー)"},
+    {0x00040000000D3500ULL, "Double Dragon II THE REVENGE(ダブルドラゴンII The Revenge)"},
     {0x00040000000D3600ULL, "Double Dragon II: The Revenge"},
     {0x00040000000D3700ULL, "Double Dragon II: The Revenge"},
     {0x00040000000D3800ULL, "Ikeiike! Hot -blooded hockey club \"Slide and big brawl\"(いけいけ!熱血ホッケー部 「すべってころんで大乱闘」)"},
@@ -1932,7 +1932,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000D3D00ULL, "Mario Tennis(TM)"},
     {0x00040000000D3E00ULL, "Mario Tennis(TM)"},
     {0x00040000000D3F00ULL, "Ninja Jajamaru -kun Sakura Princess and Fire Dragon Secret(忍者じゃじゃ丸くん さくら姫と火竜のひみつ)"},
-    {0x00040000000D4000ULL, "Sherlock Holmes Puzzle City(シャーロック･ホームズ パズルシティ)"},
+    {0x00040000000D4000ULL, "Sherlock Holmes Puzzle City(シャーロック-ホームズ パズルシティ)"},
     {0x00040000000D4100ULL, "Farming Simulator 3D Pocket Farm(Farming Simulator 3D ポケット農園)"},
     {0x00040000000D4200ULL, "Kipper Eigo Classroom Floppy's PhoneCS Vol.2 Biff(キッパーのえいご教室 Floppy's Phonics vol.2 ビフ編)"},
     {0x00040000000D4300ULL, "Kipper Eigo Classroom Floppy's PhoneCS vol.1 Kipper(キッパーのえいご教室 Floppy's Phonics vol.1 キッパー編)"},
@@ -1966,7 +1966,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000D6900ULL, "My Riding Stables 3D - Jumping for the Team"},
     {0x00040000000D6B00ULL, "Batman: Arkham Origins Blackgate"},
     {0x00040000000D6C00ULL, "Pick-A-Gem"},
-    {0x00040000000D6D00ULL, "True Goddess Rebirth IV (Japanese version)(真・女神轉生Ⅳ (日文版))"},
+    {0x00040000000D6D00ULL, "True Goddess Rebirth IV (Japanese version)(真-女神轉生IV (日文版))"},
     {0x00040000000D6E00ULL, "Zelda's legendary Mujura mask 3D(ゼルダの伝説 ムジュラの仮面 3D)"},
     {0x00040000000D6F00ULL, "Mystery Case Files Ravenhearst(R)"},
     {0x00040000000D7000ULL, "Batman: Arkham Origins Blackgate"},
@@ -2024,11 +2024,11 @@ static const title_entry_t title_database[] = {
     {0x00040000000DB700ULL, "@Simple DL series Vol.15 The Mahjong(@SIMPLE DLシリーズ Vol.15 THE 麻雀)"},
     {0x00040000000DB800ULL, "Basket m01d(KORG M01D)"},
     {0x00040000000DB900ULL, "Recapture command Witch Dungeon -I have to do it for the Lord ~(奪還指令魔女ダンジョン ～主の為ならやらねばなるまい～)"},
-    {0x00040000000DBA00ULL, "Kira ★ Meki fashionable salon! ~ My work is a hairdresser ~(キラ★メキ おしゃれサロン! ～わたしのしごとは美容師さん～)"},
-    {0x00040000000DBB00ULL, "Starry☆Sky～in Spring～3D(Starry☆Sky～in Spring～3D)"},
+    {0x00040000000DBA00ULL, "Kira * Meki fashionable salon! ~ My work is a hairdresser ~(キラ*メキ おしゃれサロン! ～わたしのしごとは美容師さん～)"},
+    {0x00040000000DBB00ULL, "Starry*Sky～in Spring～3D(Starry*Sky～in Spring～3D)"},
     {0x00040000000DBC00ULL, "One Piece Romance Dawn Adventure Dawn(ワンピース ROMANCE DAWN 冒険の夜明け)"},
     {0x00040000000DBD00ULL, "SIMPLE Series for Nintendo 3DS Vol.1 The Mahjong(SIMPLEシリーズ for ニンテンドー3DS Vol.1 THE 麻雀)"},
-    {0x00040000000DBE00ULL, "Tamagotchi's pounding ☆ Dream Omisechi(たまごっちの ドキドキ☆ドリームおみせっち)"},
+    {0x00040000000DBE00ULL, "Tamagotchi's pounding * Dream Omisechi(たまごっちの ドキドキ*ドリームおみせっち)"},
     {0x00040000000DC100ULL, "Turbo - Super Stunt Squad"},
     {0x00040000000DC200ULL, "3D Altered Beast"},
     {0x00040000000DC300ULL, "Pick-A-Gem"},
@@ -2037,7 +2037,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000DC600ULL, "A stuffed animal cake shop -Magical patissier(ぬいぐるみのケーキ屋さん ～魔法のパティシエール～)"},
     {0x00040000000DC700ULL, "Hot -blooded hard -to -rigid speech concertos(熱血硬派くにおくんSP 乱闘協奏曲)"},
     {0x00040000000DC800ULL, "Bravely Second(ブレイブリーセカンド)"},
-    {0x00040000000DC900ULL, "Chibi ☆ Devi! 2 -Magical Yumeehong ~(ちび☆デビ!2 ～魔法のゆめえほん～)"},
+    {0x00040000000DC900ULL, "Chibi * Devi! 2 -Magical Yumeehong ~(ちび*デビ!2 ～魔法のゆめえほん～)"},
     {0x00040000000DCA00ULL, "Cardboard fighter w Super custom(ダンボール戦機W 超カスタム)"},
     {0x00040000000DCB00ULL, "Tails Adventure(TM)"},
     {0x00040000000DCC00ULL, "Chain Blaster"},
@@ -2134,18 +2134,18 @@ static const title_entry_t title_database[] = {
     {0x00040000000E9500ULL, "Nikori puzzle number link(ニコリのパズル ナンバーリンク)"},
     {0x00040000000E9700ULL, "Nikori Puzzle Yajirin(ニコリのパズル ヤジリン)"},
     {0x00040000000E9800ULL, "3D beast king(3D 獣王記)"},
-    {0x00040000000E9900ULL, "3D Sonic the Hedgehog(3D ソニック･ザ･ヘッジホッグ)"},
+    {0x00040000000E9900ULL, "3D Sonic the Hedgehog(3D ソニック-ザ-ヘッジホッグ)"},
     {0x00040000000E9A00ULL, "Seatrism Final Fantasy Curtain Call(シアトリズム ファイナル ファンタジー カーテンコール)"},
     {0x00040000000E9B00ULL, "Escape adventure despair fortress(脱出アドベンチャー 絶望要塞)"},
     {0x00040000000E9C00ULL, "Fantasy Life Link!(ファンタジーライフ LINK!)"},
-    {0x00040000000E9D00ULL, "Starry☆Sky～in Summer～3D(Starry☆Sky～in Summer～3D)"},
+    {0x00040000000E9D00ULL, "Starry*Sky～in Summer～3D(Starry*Sky～in Summer～3D)"},
     {0x00040000000E9E00ULL, "Joy Mechafight(ジョイメカファイト)"},
     {0x00040000000E9F00ULL, "SD Gundam World Gachapon Warrior Scramble Wars(SDガンダムワールド ガチャポン 戦士 スクランブルウォーズ)"},
     {0x00040000000EA000ULL, "Mappy(マッピー)"},
     {0x00040000000EA100ULL, "Kanshaku Tamanage Kang Taro's 53rd Tokaido(かんしゃく玉なげカン太郎の 東海道五十三次)"},
     {0x00040000000EA200ULL, "Mystery of Atlantis(アトランチスの謎)"},
-    {0x00040000000EA300ULL, "Shin Megami Reincarnation Devil Children Black Book(真･女神転生デビルチルドレン 黒の書)"},
-    {0x00040000000EA400ULL, "Shin -Megami Reincarnation Devil Children Red Book(真･女神転生デビルチルドレン 赤の書)"},
+    {0x00040000000EA300ULL, "Shin Megami Reincarnation Devil Children Black Book(真-女神転生デビルチルドレン 黒の書)"},
+    {0x00040000000EA400ULL, "Shin -Megami Reincarnation Devil Children Red Book(真-女神転生デビルチルドレン 赤の書)"},
     {0x00040000000EA500ULL, "Dora Chie Minidora Music Band and 7 Wisdom(ドラちえ ミニドラ音楽隊と7つの知恵)"},
     {0x00040000000EA600ULL, "Etrian Odyssey(TM) IV: Legends of the Titan"},
     {0x00040000000EA700ULL, "LEGO Friends"},
@@ -2199,12 +2199,12 @@ static const title_entry_t title_database[] = {
     {0x00040000000EE100ULL, "Legendary Shinobu and Survival Battle during battle!(戦闘中 伝説の忍とサバイバルバトル!)"},
     {0x00040000000EE200ULL, "I am Air Controller Airport Hero 3D Naha Premium(ぼくは航空管制官 エアポート ヒーロー3D 那覇 PREMIUM)"},
     {0x00040000000EE300ULL, "Tamagotchi! Dream School(たまごっち! せーしゅんのドリームスクール)"},
-    {0x00040000000EE400ULL, "Starry☆Sky～in Autumn～3D(Starry☆Sky～in Autumn～3D)"},
-    {0x00040000000EE500ULL, "Starry☆Sky～in Winter～3D(Starry☆Sky～in Winter～3D)"},
+    {0x00040000000EE400ULL, "Starry*Sky～in Autumn～3D(Starry*Sky～in Autumn～3D)"},
+    {0x00040000000EE500ULL, "Starry*Sky～in Winter～3D(Starry*Sky～in Winter～3D)"},
     {0x00040000000EE600ULL, "Dogi Megi Inryoku -chan(どぎめぎインリョクちゃん)"},
-    {0x00040000000EE700ULL, "3D Echo the Dolphin(3D エコー･ザ･ドルフィン)"},
-    {0x00040000000EE800ULL, "3D The Super Ninja II(3D ザ･スーパー忍Ⅱ)"},
-    {0x00040000000EE900ULL, "3D Bear Knuckle Angry Tekken(3D ベア･ナックル 怒りの鉄拳)"},
+    {0x00040000000EE700ULL, "3D Echo the Dolphin(3D エコー-ザ-ドルフィン)"},
+    {0x00040000000EE800ULL, "3D The Super Ninja II(3D ザ-スーパー忍II)"},
+    {0x00040000000EE900ULL, "3D Bear Knuckle Angry Tekken(3D ベア-ナックル 怒りの鉄拳)"},
     {0x00040000000EEA00ULL, "Picross E3(ピクロスe3)"},
     {0x00040000000EEF00ULL, "Maru g_kaku! Gy_sei shoshi shiken"},
     {0x00040000000EF000ULL, "Radio humans RPG3(電波人間のRPG3)"},
@@ -2273,7 +2273,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000F3300ULL, "Profesor Layton y el Legado de los Ashalanti, El"},
     {0x00040000000F3400ULL, "Professor Layton e lEredita degli Aslant, Il"},
     {0x00040000000F3500ULL, "Professor Layton en de Erfenis van de Azran"},
-    {0x00040000000F3600ULL, "Brunch ☆ Panic!(ブランチ☆パニック!)"},
+    {0x00040000000F3600ULL, "Brunch * Panic!(ブランチ*パニック!)"},
     {0x00040000000F3700ULL, "Maru g_kaku! Keamanej_ shiken"},
     {0x00040000000F3800ULL, "Challenge from Greco! Kanji House and Obake 1 1st grade(グレコからの挑戦状! 漢字の館とオバケたち 小学1年生)"},
     {0x00040000000F3900ULL, "Challenge from Greco! Kanji House and Obake 2 elementary school students(グレコからの挑戦状! 漢字の館とオバケたち 小学2年生)"},
@@ -2312,7 +2312,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000F5D00ULL, "LEGO Marvel Super Heroes - Universum in Gefahr"},
     {0x00040000000F5F00ULL, "Doraemon"},
     {0x00040000000F6000ULL, "Doraemon - Nobitas Number Adventure"},
-    {0x00040000000F6100ULL, "Jin Goddess Life ⅳ(진 여신전생Ⅳ)"},
+    {0x00040000000F6100ULL, "Jin Goddess Life IV(진 여신전생IV)"},
     {0x00040000000F6700ULL, "Putty Squad"},
     {0x00040000000F6B00ULL, "Ocean Runner"},
     {0x00040000000F6C00ULL, "Yu -Gi -Oh! ZEXAL collision! Duel carnival!(遊戯王ZEXAL 激突!デュエルカーニバル!)"},
@@ -2320,12 +2320,12 @@ static const title_entry_t title_database[] = {
     {0x00040000000F7000ULL, "My Vet Practice 3D - In the Country"},
     {0x00040000000F7100ULL, "My Little Baby 3D"},
     {0x00040000000F7200ULL, "Learn with Nanami! Tips for improving English(ナナミと一緒に学ぼ! English上達のコツ)"},
-    {0x00040000000F7300ULL, "New World Tree Labyrinth Millennium Girl (Japanese Version)(新・世界樹の迷宮 ミレニアムの少女 (日文版))"},
+    {0x00040000000F7300ULL, "New World Tree Labyrinth Millennium Girl (Japanese Version)(新-世界樹の迷宮 ミレニアムの少女 (日文版))"},
     {0x00040000000F7400ULL, "Coaster Creator 3D"},
     {0x00040000000F7500ULL, "Stylish puppy 3D(おしゃれな仔犬3D)"},
     {0x00040000000F7600ULL, "Chibi-Robo!(TM) Let's Go, Photo!"},
-    {0x00040000000F7700ULL, "Labyrinth of World Water IV (Japanese)(세계수의 미궁 Ⅳ (일본어))"},
-    {0x00040000000F7800ULL, "Labyrinth of World Water ⅳ (English)(세계수의 미궁 Ⅳ (영어))"},
+    {0x00040000000F7700ULL, "Labyrinth of World Water IV (Japanese)(세계수의 미궁 IV (일본어))"},
+    {0x00040000000F7800ULL, "Labyrinth of World Water IV (English)(세계수의 미궁 IV (영어))"},
     {0x00040000000F7900ULL, "Nickelodeon Teenage Mutant Ninja Turtles"},
     {0x00040000000F7A00ULL, "Angry Birds Star Wars"},
     {0x00040000000F7B00ULL, "Inazuma Eleven(R) 3: Bomb Blast"},
@@ -2341,7 +2341,7 @@ static const title_entry_t title_database[] = {
     {0x00040000000F8500ULL, "Mighty Final Fight(マイティファイナルファイト)"},
     {0x00040000000F8600ULL, "Mighty Final Fight(R)"},
     {0x00040000000F8700ULL, "Mighty Final Fight"},
-    {0x00040000000F8800ULL, "Red Almere II(レッドアリーマーⅡ)"},
+    {0x00040000000F8800ULL, "Red Almere II(レッドアリーマーII)"},
     {0x00040000000F8900ULL, "Gargoyle's Quest(TM) II: The Demon Darkness"},
     {0x00040000000F8A00ULL, "Gargoyle's Quest II: The Demon Darkness"},
     {0x00040000000F8B00ULL, "Final Fantasy(ファイナルファンタジー)"},
@@ -2363,23 +2363,23 @@ static const title_entry_t title_database[] = {
     {0x00040000000FA300ULL, "@Simple DL Series Vol.16 The Escape Family Room Remarks Edition(@SIMPLE DLシリーズ Vol.16 THE 密室からの脱出 ファミレス編)"},
     {0x00040000000FA500ULL, "Cooking mom 5(クッキングママ5)"},
     {0x00040000000FA600ULL, "Sonipro(ソニプロ)"},
-    {0x00040000000FA700ULL, "Fate/KALEID LINER Prisma ☆ Ilya(Fate/kaleid liner プリズマ☆イリヤ)"},
-    {0x00040000000FA800ULL, "Kumamon ★ Bomber Puzzle de Kumamon Gymnastics(くまモン★ボンバー パズル de くまモン体操)"},
+    {0x00040000000FA700ULL, "Fate/KALEID LINER Prisma * Ilya(Fate/kaleid liner プリズマ*イリヤ)"},
+    {0x00040000000FA800ULL, "Kumamon * Bomber Puzzle de Kumamon Gymnastics(くまモン*ボンバー パズル de くまモン体操)"},
     {0x00040000000FA900ULL, "Challenge from Greco! Column Castle and Obake Toshi(グレコからの挑戦状! 計算の城とオバケたち たし算)"},
     {0x00040000000FAA00ULL, "Challenge from Greco! Calling Castle and Obake(グレコからの挑戦状! 計算の城とオバケたち ひき算)"},
     {0x00040000000FAC00ULL, "Challenge from Greco! Country of calculation and ghosts(グレコからの挑戦状! 計算の城とオバケたち わり算)"},
     {0x00040000000FAE00ULL, "Challenge from Greco! Calculation Castle and Obake and others(グレコからの挑戦状! 計算の城とオバケたち かけ算)"},
     {0x00040000000FAF00ULL, "Let's make a roller coaster! 3D(ジェットコースターをつくろう!3D)"},
-    {0x00040000000FB000ULL, "Character puzzle(文字パズル ことだまーる★)"},
+    {0x00040000000FB000ULL, "Character puzzle(文字パズル ことだまーる*)"},
     {0x00040000000FB100ULL, "Senran Kagura 2 -Crimson--(閃乱カグラ2 -真紅-)"},
     {0x00040000000FB200ULL, "Nobunaga's ambition(信長の野望)"},
     {0x00040000000FB300ULL, "Toriko Ultimate Survival(トリコ アルティメットサバイバル)"},
-    {0x00040000000FB400ULL, "Model ☆ Stylish Audition Dream Girl(モデル☆おしゃれオーディション ドリームガール)"},
+    {0x00040000000FB400ULL, "Model * Stylish Audition Dream Girl(モデル*おしゃれオーディション ドリームガール)"},
     {0x00040000000FB500ULL, "Little Dor Princess -Snack Edition-(リトルドールプリンセス ～おやつ編～)"},
     {0x00040000000FB600ULL, "Little Dor Princess -Cooking-(リトルドールプリンセス ～料理編～)"},
     {0x00040000000FB700ULL, "Colors! 3D(Colors! 3D)"},
     {0x00040000000FB800ULL, "SWORDS and DARKNESS(SWORDS and DARKNESS)"},
-    {0x00040000000FB900ULL, "3D Galaxy Force II(3D ギャラクシーフォースⅡ)"},
+    {0x00040000000FB900ULL, "3D Galaxy Force II(3D ギャラクシーフォースII)"},
     {0x00040000000FBA00ULL, "Transformers - Rise of the Dark Spark"},
     {0x00040000000FBB00ULL, "Best of Board Games"},
     {0x00040000000FBD00ULL, "Best of Arcade Games"},
@@ -2436,10 +2436,10 @@ static const title_entry_t title_database[] = {
     {0x0004000000100500ULL, "Professor Layton vs. Phoenix Wright: Ace Attorney"},
     {0x0004000000100600ULL, "Professor Layton vs Phoenix Wright - Ace Attorney [EN, ES, IT]"},
     {0x0004000000100700ULL, "Professor Layton vs. Phoenix Wright: Ace Attorney"},
-    {0x0004000000100800ULL, "Outdoors Anrydo Africa 3D(アウトドアズ･アンリーシュド アフリカ3D)"},
+    {0x0004000000100800ULL, "Outdoors Anrydo Africa 3D(アウトドアズ-アンリーシュド アフリカ3D)"},
     {0x0004000000100900ULL, "Monster Hunter 4 (Japanese version)(MONSTER HUNTER 4 (日文版))"},
     {0x0004000000100A00ULL, "Moshi Monsters - Katsuma Unleashed"},
-    {0x0004000000100B00ULL, "Sonic the hedgehog(ソニック･ザ･ヘッジホッグ)"},
+    {0x0004000000100B00ULL, "Sonic the hedgehog(ソニック-ザ-ヘッジホッグ)"},
     {0x0004000000101200ULL, "Puyo Puyo Tetris(ぷよぷよテトリス)"},
     {0x0004000000101300ULL, "Hero bank(ヒーローバンク)"},
     {0x0004000000101400ULL, "Pazudora Z - gentei charenji-ban"},
@@ -2464,7 +2464,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000102900ULL, "PICROSS e3"},
     {0x0004000000102B00ULL, "LEGO_ Marvel_ Super Heroes Universe in Peril"},
     {0x0004000000102C00ULL, "Cube Tactics"},
-    {0x0004000000102D00ULL, "High School D × D(ハイスクールD×D)"},
+    {0x0004000000102D00ULL, "High School D x D(ハイスクールDxD)"},
     {0x0004000000102E00ULL, "Hamatra Look at Smoking World(ハマトラ Look at Smoking World)"},
     {0x0004000000102F00ULL, "Taiko no Toshikatsu Space -time Adventure(太鼓の達人 どんとかつの時空大冒険)"},
     {0x0004000000103100ULL, "Imperial Falling Sangokuni -Shu and Time Copper Judge-(難攻不落三国伝 ～蜀と時の銅雀～)"},
@@ -2491,10 +2491,10 @@ static const title_entry_t title_database[] = {
     {0x0004000000105100ULL, "VitaminX Evolution Plus(VitaminX Evolution Plus)"},
     {0x0004000000105200ULL, "Crayon Shin -chan Camed Kasukabe Movie Stars!(クレヨンしんちゃん 嵐を呼ぶ カスカベ映画スターズ!)"},
     {0x0004000000105300ULL, "BANDAI NAMCO Games Presents J Legend Trend(バンダイナムコゲームス PRESENTS Jレジェンド列伝)"},
-    {0x0004000000105400ULL, "Pretty rhythm Rainbow Live Kirakira My ☆ Design(プリティーリズムレインボーライブ きらきらマイ☆デザイン)"},
+    {0x0004000000105400ULL, "Pretty rhythm Rainbow Live Kirakira My * Design(プリティーリズムレインボーライブ きらきらマイ*デザイン)"},
     {0x0004000000105500ULL, "The Combo Pack - Madagascar 3 - Europes Most Wanted + Croods - Prehistoric Party!"},
-    {0x0004000000105800ULL, "Labyrinth of World Tree II Traditional Giant (Japanese Edition)(世界樹の迷宮Ⅳ 伝承の巨神 (日文版))"},
-    {0x0004000000105900ULL, "Etrian Odyssey ⅳ Legends of the Titan (English version)(Etrian Odyssey Ⅳ Legends of the Titan (英文版))"},
+    {0x0004000000105800ULL, "Labyrinth of World Tree II Traditional Giant (Japanese Edition)(世界樹の迷宮IV 伝承の巨神 (日文版))"},
+    {0x0004000000105900ULL, "Etrian Odyssey IV Legends of the Titan (English version)(Etrian Odyssey IV Legends of the Titan (英文版))"},
     {0x0004000000105A00ULL, "The LEGO(R) Movie Videogame"},
     {0x0004000000105C00ULL, "Blasting the old elf(爆走老精靈)"},
     {0x0004000000105D00ULL, "Hatsunemiku Project mirai 2 - 3D eiz_"},
@@ -2530,7 +2530,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000107E00ULL, "Super Dodge Ball"},
     {0x0004000000107F00ULL, "Karous‐The Beast of Re：Eden‐(Karous‐The Beast of Re：Eden‐)"},
     {0x0004000000108000ULL, "Wakedas(ワケダス)"},
-    {0x0004000000108100ULL, "Arrow of Laputa Shadow Teacher and Kiron's key(アロー･オブ･ラピュタ 影なし先生とキロンの封鍵)"},
+    {0x0004000000108100ULL, "Arrow of Laputa Shadow Teacher and Kiron's key(アロー-オブ-ラピュタ 影なし先生とキロンの封鍵)"},
     {0x0004000000108200ULL, "DQM _ monsut_ hikkoshi apuri - - ter_ kara iru to Ruka e -"},
     {0x0004000000108300ULL, "Challenge from Greco! English words and ghosts Step1(グレコからの挑戦状! 英単語の島とオバケたち STEP1)"},
     {0x0004000000108400ULL, "Challenge from Greco! English words and ghosts Step2(グレコからの挑戦状! 英単語の島とオバケたち STEP2)"},
@@ -2568,11 +2568,11 @@ static const title_entry_t title_database[] = {
     {0x000400000010B000ULL, "GUNMAN STORY(GUNMAN STORY)"},
     {0x000400000010B100ULL, "Family Bowling 3D"},
     {0x000400000010B200ULL, "Ran(なぞぷよ)"},
-    {0x000400000010B300ULL, "Shining Force Gaiden I Expedition to the Evil God(シャイニング･フォース外伝I 遠征･邪神の国へ)"},
+    {0x000400000010B300ULL, "Shining Force Gaiden I Expedition to the Evil God(シャイニング-フォース外伝I 遠征-邪神の国へ)"},
     {0x000400000010B400ULL, "Masu Puyo 2(なぞぷよ2)"},
     {0x000400000010B500ULL, "Mystery Arles Lou(なぞぷよ アルルのルー)"},
     {0x000400000010B600ULL, "Puyo Puyo Dori(ぷよぷよ通)"},
-    {0x000400000010B700ULL, "Shining Force Gaiden Final Conflict(シャイニング･フォース外伝 ファイナルコンフリクト)"},
+    {0x000400000010B700ULL, "Shining Force Gaiden Final Conflict(シャイニング-フォース外伝 ファイナルコンフリクト)"},
     {0x000400000010B800ULL, "Treasures of the World"},
     {0x000400000010BA00ULL, "Inazuma Eleven GO Galaxy Big Bang(イナズマイレブンGO ギャラクシー ビッグバン)"},
     {0x000400000010BB00ULL, "Inazuma Eleven GO Galaxy Super Nova(イナズマイレブンGO ギャラクシー スーパーノヴァ)"},
@@ -2600,7 +2600,7 @@ static const title_entry_t title_database[] = {
     {0x000400000010E600ULL, "Yugi_ _ku - V OCG - kanta n masut_! Pende~yuramu sh_kan"},
     {0x000400000010E900ULL, "Squids Odyssey"},
     {0x000400000010EB00ULL, "Etrian Odyssey(TM) Untold: The Millennium Girl"},
-    {0x000400000010EC00ULL, "Hello Kitty and Maho apron rhythm cooking ♪(ハローキティとまほうのエプロン リズムクッキング♪)"},
+    {0x000400000010EC00ULL, "Hello Kitty and Maho apron rhythm cooking *(ハローキティとまほうのエプロン リズムクッキング*)"},
     {0x000400000010ED00ULL, "Chocolate dog's little mysterious story Chocolat Princess and Magical Recipe(チョコ犬のちょこっと不思議な物語 ショコラ姫と魔法のレシピ)"},
     {0x000400000010EE00ULL, "Game(ゲームざんまい)"},
     {0x000400000010EF00ULL, "Excavation(エクスケーブ)"},
@@ -2637,7 +2637,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000111300ULL, "2in1 Horses 3D - My Foal 3D + My Riding Stables 3D - Rivals in the Saddle"},
     {0x0004000000111500ULL, "Life with Horses 3D"},
     {0x0004000000111600ULL, "MAPLE STORY Fateful Girl(Maple Story 運命の少女)"},
-    {0x0004000000111700ULL, "Disney Infinity Toy Box Challenge(ディズニーインフィニティ トイ･ボックス･チャレンジ)"},
+    {0x0004000000111700ULL, "Disney Infinity Toy Box Challenge(ディズニーインフィニティ トイ-ボックス-チャレンジ)"},
     {0x0004000000111900ULL, "Farming Simulator 14"},
     {0x0004000000111A00ULL, "Kung Fu Rabbit"},
     {0x0004000000111B00ULL, "Yoshi's New Island"},
@@ -2653,7 +2653,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000112600ULL, "Cut the Rope(R): Triple Treat"},
     {0x0004000000112700ULL, "Kitten's album -MY LITTLE CAT ~(子猫のアルバム～My Little Cat～)"},
     {0x0004000000112800ULL, "Magi new world(マギ 新たなる世界)"},
-    {0x0004000000112900ULL, "Doraemon Shin -Nobita's Great Makai -Peco and 5 Expeditions-(ドラえもん 新･のび太の大魔境 ～ペコと5人の探検隊～)"},
+    {0x0004000000112900ULL, "Doraemon Shin -Nobita's Great Makai -Peco and 5 Expeditions-(ドラえもん 新-のび太の大魔境 ～ペコと5人の探検隊～)"},
     {0x0004000000112B00ULL, "INAZUMA ELEVEN(TM)"},
     {0x0004000000112C00ULL, "Conception II - Children of the Seven Stars"},
     {0x0004000000112D00ULL, "Yumi's Odd Odyssey(TM)"},
@@ -2670,7 +2670,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000113D00ULL, "Bird Mania Christmas 3D"},
     {0x0004000000114000ULL, "Atlantic Quest"},
     {0x0004000000114100ULL, "Petit novel \"December of harvest\"(プチノベル「収穫の十二月」)"},
-    {0x0004000000114200ULL, "3D After Burner II(3D アフターバーナーⅡ)"},
+    {0x0004000000114200ULL, "3D After Burner II(3D アフターバーナーII)"},
     {0x0004000000114300ULL, "Titanic murder case(タイタニック殺人事件)"},
     {0x0004000000114400ULL, "Escape Adventure Red Stone of Siawase(脱出アドベンチャー シアワセの赤い石)"},
     {0x0004000000114500ULL, "@Simple DL Series Vol.24 THE Escape Hot Spring Edition(@SIMPLE DLシリーズ Vol.24 THE 密室からの脱出 温泉編)"},
@@ -2686,7 +2686,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000115100ULL, "WEAPON SHOP de OMASSE(TM)"},
     {0x0004000000115200ULL, "Tenkai Night Brave Battle(テンカイナイト ブレイブバトル)"},
     {0x0004000000115300ULL, "Dictionary dictionary(熟語 速引辞典)"},
-    {0x0004000000115400ULL, "Sevens Dragon II Code: VFD(セブンスドラゴンⅢ code:VFD)"},
+    {0x0004000000115400ULL, "Sevens Dragon II Code: VFD(セブンスドラゴンIII code:VFD)"},
     {0x0004000000115500ULL, "Mazinbourne time and space genie(マジンボーン 時間と空間の魔神)"},
     {0x0004000000115700ULL, "THE LEGEND OF ZELDA: A LINK BETWEEN WORLDS (English version)(The Legend of Zelda: A Link Between Worlds (英文版))"},
     {0x0004000000115800ULL, "Zelda's legendary gods of trifos 2(젤다의 전설 신들의 트라이포스 2)"},
@@ -2718,7 +2718,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000117E00ULL, "One Piece - Unlimited World Red"},
     {0x0004000000117F00ULL, "Winter Sports 2012 - Feel the Spirit"},
     {0x0004000000118100ULL, "Detective Conan Phantom Raging Song(名探偵コナン ファントム狂詩曲)"},
-    {0x0004000000118200ULL, "Herminage Identon Amenomi Hashira / Mystery(エルミナージュ異聞 アメノミハシラ･怪)"},
+    {0x0004000000118200ULL, "Herminage Identon Amenomi Hashira / Mystery(エルミナージュ異聞 アメノミハシラ-怪)"},
     {0x0004000000118300ULL, "World tree and mysterious dungeon(世界樹と不思議のダンジョン)"},
     {0x0004000000118400ULL, "Talking rabbit fashionable collection(おしゃべりうさぎ おしゃれコレクション)"},
     {0x0004000000118500ULL, "Japan Kanji ability certification association Kanken Training.(公益財団法人 日本漢字能力検定 協会 漢検トレーニング)"},
@@ -2823,12 +2823,12 @@ static const title_entry_t title_database[] = {
     {0x0004000000120200ULL, "Radilugi!(ラジルギでごじゃる!)"},
     {0x0004000000120300ULL, "Sprinkle!(といてすすんで! なぞときキャッスル)"},
     {0x0004000000120400ULL, "Gacha racing(ガチャレーシング)"},
-    {0x0004000000120500ULL, "New World Tree Labyrinth 2 Knight of Fafnir(新･世界樹の迷宮2 ファフニールの騎士)"},
+    {0x0004000000120500ULL, "New World Tree Labyrinth 2 Knight of Fafnir(新-世界樹の迷宮2 ファフニールの騎士)"},
     {0x0004000000120600ULL, "Dragon Ball Heroes Ultimate Mission 2(ドラゴンボールヒーローズ アルティメットミッション2)"},
     {0x0004000000120700ULL, "Card Fight !! Vanguard Lock on Victory !!(カードファイト!! ヴァンガード ロック オン ビクトリー!!)"},
     {0x0004000000120800ULL, "IslandDays(IslandDays)"},
     {0x0004000000120900ULL, "Contraining magna(禁忌のマグナ)"},
-    {0x0004000000120A00ULL, "Disk Wars: Avengers Ultimate Heroes(ディスク･ウォーズ:アベンジャーズ アルティメットヒーローズ)"},
+    {0x0004000000120A00ULL, "Disk Wars: Avengers Ultimate Heroes(ディスク-ウォーズ:アベンジャーズ アルティメットヒーローズ)"},
     {0x0004000000120C00ULL, "Friends Moa Apartment(친구모아 아파트)"},
     {0x0004000000120D00ULL, "Ny_ rabu purasu + - s_bud_ta hikitsugi ts_ru"},
     {0x0004000000120E00ULL, "Kashiramoji D p_fekutoshifuto - ONLINE tesuto-ban"},
@@ -2846,7 +2846,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000121A00ULL, "Japan Kanji Ability Test Association Kanken Training 9th grade Grade 10(公益財団法人 日本漢字能力検定 協会 漢検トレーニング 9級 10級)"},
     {0x0004000000121B00ULL, "Maru g_kaku! IT pasu Heisei 26-nendo-ban"},
     {0x0004000000121C00ULL, "Passed Maru! Basic Information Engineer Examination 2014 Edition(マル合格! 基本情報技術者試験 平成26年度版)"},
-    {0x0004000000121D00ULL, "3D Fantasy Zone II Double(3D ファンタジーゾーンⅡダブル)"},
+    {0x0004000000121D00ULL, "3D Fantasy Zone II Double(3D ファンタジーゾーンIIダブル)"},
     {0x0004000000121E00ULL, "Zongeripanic Nightmare(ゾンゲリパニック ナイトメア)"},
     {0x0004000000121F00ULL, "God Switch World Gulinsia(神創世界グリンシア)"},
     {0x0004000000122000ULL, "Wow catch!(ウオキャッチ!)"},
@@ -2875,7 +2875,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000124600ULL, "LEGO Ninjago - Nindroids"},
     {0x0004000000124800ULL, "Undead Storm Nightmare"},
     {0x0004000000124900ULL, "Superhuman Ultra Baseball Action Card Battle(超人ウルトラベースボール アクションカードバトル)"},
-    {0x0004000000124A00ULL, "Real Escape Game x Nintendo 3DS Escape from Super Destruction Plan(リアル脱出ゲーム×ニンテンドー 3DS 超破壊計画からの脱出)"},
+    {0x0004000000124A00ULL, "Real Escape Game x Nintendo 3DS Escape from Super Destruction Plan(リアル脱出ゲームxニンテンドー 3DS 超破壊計画からの脱出)"},
     {0x0004000000124C00ULL, "Tiny Games - Knights and Dragons"},
     {0x0004000000124E00ULL, "Color Zen Kids"},
     {0x0004000000124F00ULL, "101 Pony Pets 3D"},
@@ -2913,7 +2913,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000127800ULL, "Petit novel \"February of Gift\"(プチノベル「贈与の二月」)"},
     {0x0004000000127900ULL, "Super Robot Wars BX(スーパーロボット大戦BX)"},
     {0x0004000000127A00ULL, "I'm an Air Controller Airport Hero 3D Kansai SKY STORY(ぼくは航空管制官 エアポート ヒーロー3D 関空 SKY STORY)"},
-    {0x0004000000127B00ULL, "Happiness Charge Pretty Cure! Kawarun ☆ Collection(ハピネスチャージプリキュア! かわルン☆コレクション)"},
+    {0x0004000000127B00ULL, "Happiness Charge Pretty Cure! Kawarun * Collection(ハピネスチャージプリキュア! かわルン*コレクション)"},
     {0x0004000000127C00ULL, "World Soccer Winning Eleven 2014 Blue Samurai Challenge(ワールドサッカーウイニング イレブン2014 蒼き侍の挑戦)"},
     {0x0004000000127D00ULL, "Tenkai Knights - Brave Battle"},
     {0x0004000000127E00ULL, "Axel Knights 2 Full Throttle(アクセルナイツ2 フルスロットル)"},
@@ -2941,8 +2941,8 @@ static const title_entry_t title_database[] = {
     {0x000400000012A000ULL, "Touch battle ninja(タッチバトル忍者)"},
     {0x000400000012A100ULL, "Super Scientific Escape Story -Luxury Linfish Ship of the Sea-(超科学脱出ストーリー ～絶海の豪華客船～)"},
     {0x000400000012A200ULL, "Ashito and reversal Kumon version(あしあとリバーシ くまモンバージョン)"},
-    {0x000400000012A300ULL, "Star ★ Series: Cute Witch(スター★シリーズ: キュートウィッチ)"},
-    {0x000400000012A400ULL, "Maison de Demon King(メゾン･ド･魔王)"},
+    {0x000400000012A300ULL, "Star * Series: Cute Witch(スター*シリーズ: キュートウィッチ)"},
+    {0x000400000012A400ULL, "Maison de Demon King(メゾン-ド-魔王)"},
     {0x000400000012A500ULL, "Steel Empire Steel Empire(鋼鉄帝国 STEEL EMPIRE)"},
     {0x000400000012A600ULL, "SLICE IT!(SLICE IT!)"},
     {0x000400000012A700ULL, "Blue Thunder Gun Volt(蒼き雷霆 ガンヴォルト)"},
@@ -2956,12 +2956,12 @@ static const title_entry_t title_database[] = {
     {0x000400000012AF00ULL, "Tenkai Knights - Brave Battle"},
     {0x000400000012B100ULL, "Kasekihorid_ z_ry_ mugengia"},
     {0x000400000012B200ULL, "Finding mistakes and fun adult mistakes(名画と楽しむ大人の間違い探し)"},
-    {0x000400000012B300ULL, "Star ★ Series: 3D darts(スター★シリーズ:3D ダーツ)"},
-    {0x000400000012B400ULL, "Squeezing and playing ♪ How fun ①(がっき で あそぼ♪ たのしい どうよう①)"},
+    {0x000400000012B300ULL, "Star * Series: 3D darts(スター*シリーズ:3D ダーツ)"},
+    {0x000400000012B400ULL, "Squeezing and playing * How fun ①(がっき で あそぼ* たのしい どうよう①)"},
     {0x000400000012B500ULL, "@Simple DL Series Vol.32 The Battle Robot Great Struggle Scramble(@SIMPLE DLシリーズ Vol.32 THEバトルロボ大共闘スクランブル)"},
     {0x000400000012B600ULL, "Hot -blooded magic story(熱血魔法物語)"},
     {0x000400000012B700ULL, "Gunma no Yabou for Nintendo 3DS(ぐんまのやぼう for ニンテンドー3DS)"},
-    {0x000400000012B800ULL, "Star ★ Series: Magic Bubble(スター★シリーズ:マジックバブル)"},
+    {0x000400000012B800ULL, "Star * Series: Magic Bubble(スター*シリーズ:マジックバブル)"},
     {0x000400000012B900ULL, "Inazuma Eleven manga vol.2"},
     {0x000400000012BA00ULL, "Inazuma Eleven manga vol.3"},
     {0x000400000012BB00ULL, "Inazuma Eleven manga vol.4"},
@@ -2989,7 +2989,7 @@ static const title_entry_t title_database[] = {
     {0x000400000012D500ULL, "My First Songs 2"},
     {0x000400000012D600ULL, "Cooking Mama 5: Bon Appétit!"},
     {0x000400000012D700ULL, "Gardening Mama 2: Forest Friends"},
-    {0x000400000012D800ULL, "Girls Mode 3 Glitter ☆ Corde(GIRLS MODE 3 キラキラ☆コーデ)"},
+    {0x000400000012D800ULL, "Girls Mode 3 Glitter * Corde(GIRLS MODE 3 キラキラ*コーデ)"},
     {0x000400000012D900ULL, "SteamWorld Heist"},
     {0x000400000012DA00ULL, "The Keep"},
     {0x000400000012DB00ULL, "Fossil Fighters(TM): Frontier"},
@@ -3015,7 +3015,7 @@ static const title_entry_t title_database[] = {
     {0x000400000012F600ULL, "ABC, a word that can be remembered with Thomas(トーマスとあそんでおぼえる ことばとかずとABC)"},
     {0x000400000012F800ULL, "Yokai Watch 2 Honke(妖怪ウォッチ2 本家)"},
     {0x000400000012F900ULL, "Yo -Kai Watch 2 Original(妖怪ウォッチ2 元祖)"},
-    {0x000400000012FA00ULL, "Dory ♪ Canon(ドーリィ♪カノン)"},
+    {0x000400000012FA00ULL, "Dory * Canon(ドーリィ*カノン)"},
     {0x000400000012FB00ULL, "Gundam Try Age SP(ガンダムトライエイジSP)"},
     {0x000400000012FE00ULL, "Touching Detective Rina Ozawa Nameko Rhythm(おさわり探偵 小沢里奈 なめこリズム)"},
     {0x000400000012FF00ULL, "Local railway -Local characters and travel all over Japan-(ご当地鉄道 ～ご当地キャラと日本全国の旅～)"},
@@ -3034,7 +3034,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000131400ULL, "Slice It!"},
     {0x0004000000131500ULL, "Parking Star 3D"},
     {0x0004000000131600ULL, "Wizdom"},
-    {0x0004000000131A00ULL, "Pick a jewel(ピック･ア･ジュエル)"},
+    {0x0004000000131A00ULL, "Pick a jewel(ピック-ア-ジュエル)"},
     {0x0004000000131C00ULL, "Legend of Legacy(レジェンド オブ レガシー)"},
     {0x0004000000131D00ULL, "Teenage Mutant Ninja Turtles - Danger of the Ooze"},
     {0x0004000000131E00ULL, "Attack on Titan - Humanity in Chains"},
@@ -3188,7 +3188,7 @@ static const title_entry_t title_database[] = {
     {0x000400000013CD00ULL, "Steel Empire"},
     {0x000400000013CE00ULL, "Vacation Adventures Park Ranger 2"},
     {0x000400000013D000ULL, "Doragonb_ruh_r_zu UM 2 - g_mud_ta hikitsugi apuri"},
-    {0x000400000013D100ULL, "Dragon Quest ⅹ Online(ドラゴンクエストⅩ オンライン)"},
+    {0x000400000013D100ULL, "Dragon Quest X Online(ドラゴンクエストX オンライン)"},
     {0x000400000013D200ULL, "Ninja Battle Heroes"},
     {0x000400000013D300ULL, "1001 Spikes"},
     {0x000400000013D500ULL, "I Love My Horse"},
@@ -3217,7 +3217,7 @@ static const title_entry_t title_database[] = {
     {0x000400000013EC00ULL, "Secret Empires of the Ancient World"},
     {0x000400000013ED00ULL, "Secret Journeys: Cities of the World"},
     {0x000400000013EE00ULL, "Woah Dave!"},
-    {0x000400000013F000ULL, "Star ★ Series: 3D soccer(スター★シリーズ:3D サッカー)"},
+    {0x000400000013F000ULL, "Star * Series: 3D soccer(スター*シリーズ:3D サッカー)"},
     {0x000400000013F100ULL, "Farming Simulator 14 -Pocket Farm 2-(Farming Simulator 14 -ポケット農園 2-)"},
     {0x000400000013F200ULL, "Bukigami zangeki rangan-hen"},
     {0x000400000013F600ULL, "GLORY OF GENERALS"},
@@ -3235,12 +3235,12 @@ static const title_entry_t title_database[] = {
     {0x0004000000140400ULL, "Gurutan adult English words(ぐるたん 大人の英単語)"},
     {0x0004000000140500ULL, "Escape Adventure Black Fog at the end of the end(脱出アドベンチャー 終焉の黒い霧)"},
     {0x0004000000140600ULL, "Sango Questory Ten(サンゴクストーリーズ天)"},
-    {0x0004000000140800ULL, "Witches and heroes Ⅱ(魔女と勇者Ⅱ)"},
+    {0x0004000000140800ULL, "Witches and heroes II(魔女と勇者II)"},
     {0x0004000000140900ULL, "Aiming instantaneous! The strongest runner in the country(瞬足 めざせ! 全国最強ランナー)"},
     {0x0004000000140B00ULL, "Terra Formars A fierce battle of the Red Planet(テラフォーマーズ 紅き惑星の激闘)"},
     {0x0004000000140D00ULL, "Outback Pet Rescue 3D"},
     {0x0004000000140E00ULL, "Haikyu !! Connect! The view of the summit !!(ハイキュー!! 繋げ!頂の景色!!)"},
-    {0x0004000000140F00ULL, "Dragon Quest ⅹ Adventurer's outing super convenient tool(ドラゴンクエストⅩ 冒険者のおでかけ超便利ツール)"},
+    {0x0004000000140F00ULL, "Dragon Quest X Adventurer's outing super convenient tool(ドラゴンクエストX 冒険者のおでかけ超便利ツール)"},
     {0x0004000000141000ULL, "Pokémon(TM) Shuffle"},
     {0x0004000000141200ULL, "Nintendo Anime Channel"},
     {0x0004000000141600ULL, "I Love My Horse"},
@@ -3253,7 +3253,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000141F00ULL, "FOSSIL FIGHTERS (TM): Frontier (English version)(Fossil Fighters(TM): Frontier(英文版))"},
     {0x0004000000142000ULL, "My First Songs"},
     {0x0004000000142100ULL, "STORY OF SEASONS"},
-    {0x0004000000143000ULL, "It's so hot ♪ How fun is ②(がっき で あそぼ♪ たのしい どうよう②)"},
+    {0x0004000000143000ULL, "It's so hot * How fun is ②(がっき で あそぼ* たのしい どうよう②)"},
     {0x0004000000143100ULL, "Escape from Treasure Rader Pyramid!(トレジャーレイダー ピラミッドから脱出!)"},
     {0x0004000000143200ULL, "Exciting training with Anpanman(アンパンマンとタッチでわくわくトレーニング)"},
     {0x0004000000143300ULL, "New SUPER MARIO BROS. 2 Gold Edition"},
@@ -3273,16 +3273,16 @@ static const title_entry_t title_database[] = {
     {0x0004000000144400ULL, "One Piece Super Grand Battle! X(ワンピース 超グランドバトル!X)"},
     {0x0004000000144500ULL, "STELLA GLOW(STELLA GLOW)"},
     {0x0004000000144600ULL, "Yowamushi Pedal high rotation to tomorrow(弱虫ペダル 明日への高回転)"},
-    {0x0004000000144700ULL, "Fujiko F. Fujio Characters Large Assembly!(藤子･F･不二雄キャラクターズ 大集合! SFドタバタパーティー!!)"},
+    {0x0004000000144700ULL, "Fujiko F. Fujio Characters Large Assembly!(藤子-F-不二雄キャラクターズ 大集合! SFドタバタパーティー!!)"},
     {0x0004000000144800ULL, "12 years old.~ Real Kimochi ~(12歳。 ～ほんとのキモチ～)"},
     {0x0004000000144900ULL, "CUBIT One -button Running Action(CUBIT ワンボタン ランニング アクション)"},
     {0x0004000000144B00ULL, "Ultimate Poker and BlackJack(Ultimate Poker and BlackJack)"},
-    {0x0004000000144C00ULL, "Squeezing and play ♪ How fun is ③(がっき で あそぼ♪ たのしい どうよう③)"},
+    {0x0004000000144C00ULL, "Squeezing and play * How fun is ③(がっき で あそぼ* たのしい どうよう③)"},
     {0x0004000000144D00ULL, "Dengeki BAZOOKA! ! - Oh! Gatchimansupesharug_mu"},
     {0x0004000000144E00ULL, "@Simple DL Series Vol.33 The hot -blooded! Flame ramen shop(@SIMPLE DLシリーズ Vol.33 THE 熱血!炎のラーメン屋)"},
     {0x0004000000144F00ULL, "Maru g_kaku! Kaigo fukushi Heisei 26-nendo-ban"},
     {0x0004000000145000ULL, "Maru g_kaku! Keamane Heisei 26-nendo-ban"},
-    {0x0004000000145100ULL, "Tunglam x Tunglam -Silhouette Puzzle that everyone is addicted to(タングラム×タングラム ～誰もがハマるシルエットパズル～)"},
+    {0x0004000000145100ULL, "Tunglam x Tunglam -Silhouette Puzzle that everyone is addicted to(タングラムxタングラム ～誰もがハマるシルエットパズル～)"},
     {0x0004000000145200ULL, "Ornero Odyssey -Escape from Earth-(オーノーオデッセイ ～地球からの脱出～)"},
     {0x0004000000145300ULL, "Demon Girl -chronicle 2D ACT-(魔神少女 -Chronicle 2D ACT-)"},
     {0x0004000000145400ULL, "Fossil Fighters(TM) Frontier"},
@@ -3351,9 +3351,9 @@ static const title_entry_t title_database[] = {
     {0x000400000014A600ULL, "My Pet School 3D"},
     {0x000400000014A700ULL, "Rune Factory 4"},
     {0x000400000014A800ULL, "Hatsune Miku Project Mirai(初音ミク Project mirai でらっくす)"},
-    {0x000400000014A900ULL, "Survan, Aanzan, flash mental arithmetic complete version(そろばん･あんざん･ フラッシュ暗算 完全版)"},
+    {0x000400000014A900ULL, "Survan, Aanzan, flash mental arithmetic complete version(そろばん-あんざん- フラッシュ暗算 完全版)"},
     {0x000400000014AA00ULL, "Railway Topin! Each route Eizan train edition(鉄道にっぽん!路線たび 叡山電車編)"},
-    {0x000400000014AB00ULL, "Maho Kore -Magic ☆ Aidoru Collection ~(まほコレ～魔法☆ あいどるコレクション～)"},
+    {0x000400000014AB00ULL, "Maho Kore -Magic * Aidoru Collection ~(まほコレ～魔法* あいどるコレクション～)"},
     {0x000400000014AC00ULL, "Future Card Baddy Fight Friendship Explosion Fight!(フューチャーカードバディファイト 友情の爆熱ファイト!)"},
     {0x000400000014AD00ULL, "Great Reversal Trial -Narido Ryunosuke's Adventure-(大逆転裁判 -成歩堂龍ノ介の冒險-)"},
     {0x000400000014AE00ULL, "Sonic Toon Island Adventure(ソニックトゥーン アイランドアドベンチャー)"},
@@ -3423,7 +3423,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000150600ULL, "KAROUS - THE BEAST OF RE:EDEN -"},
     {0x0004000000150700ULL, "The Hand of Panda"},
     {0x0004000000150800ULL, "TOYS VS MONSTERS"},
-    {0x0004000000150900ULL, "Brutus and Futée ©"},
+    {0x0004000000150900ULL, "Brutus and Futée (C)"},
     {0x0004000000150A00ULL, "Imagine Collection"},
     {0x0004000000150B00ULL, "Pokemon Art Academy(포켓몬 아트 아카데미)"},
     {0x0004000000150C00ULL, "Asterix The Mansions of the Gods"},
@@ -3469,7 +3469,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000153E00ULL, "Space Lift Danger Panic!"},
     {0x0004000000153F00ULL, "Pear juice action! Funashishi's pleasant Hanashi(梨汁アクション! ふなっしーの愉快なおはなっしー)"},
     {0x0004000000154000ULL, "Sega 3D reprint archives(セガ3D復刻アーカイブス)"},
-    {0x0004000000154100ULL, "LEGO(R) Movie the Game(LEGO(R)ムービー ザ･ゲーム)"},
+    {0x0004000000154100ULL, "LEGO(R) Movie the Game(LEGO(R)ムービー ザ-ゲーム)"},
     {0x0004000000154200ULL, "Iron Combat - War in the Air"},
     {0x0004000000154300ULL, "Space Lift Danger Panic!"},
     {0x0004000000154400ULL, "Pazuru"},
@@ -3483,7 +3483,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000154C00ULL, "Pazuru"},
     {0x0004000000154D00ULL, "Atelier Decorador Collection(アトリエ デコ ラ ドール コレクション)"},
     {0x0004000000154E00ULL, "I am Air Controller Airport Hero 3D Narita All Stars(ぼくは航空管制官 エアポート ヒーロー3D 成田 ALL STARS)"},
-    {0x0004000000155000ULL, "Disney Magic Castle My Happy Life 2(ディズニー マジックキャッスル マイ･ハッピー･ライフ2)"},
+    {0x0004000000155000ULL, "Disney Magic Castle My Happy Life 2(ディズニー マジックキャッスル マイ-ハッピー-ライフ2)"},
     {0x0004000000155100ULL, "Yokai Watch 2 Shin -Hit(妖怪ウォッチ2 真打)"},
     {0x0004000000155200ULL, "D_b_sutarion OLD"},
     {0x0004000000155400ULL, "Monster Hunter Cross(モンスターハンタークロス)"},
@@ -3491,7 +3491,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000155700ULL, "A-Train(TM) 3D: City Simulator"},
     {0x0004000000155800ULL, "PrepurchaseTest"},
     {0x0004000000155900ULL, "Undead Storm Nightmare"},
-    {0x0004000000155A00ULL, "Rhythm Heavenly The Best+(リズム天国 ザ･ベスト+)"},
+    {0x0004000000155A00ULL, "Rhythm Heavenly The Best+(リズム天国 ザ-ベスト+)"},
     {0x0004000000155B00ULL, "Cooking Mama: Bon Appétit"},
     {0x0004000000155C00ULL, "Gardening Mama: Forest Friends"},
     {0x0004000000155D00ULL, "Can you help Cooking Mama Mama?(쿠킹마마 마마를 도와줄래?)"},
@@ -3513,7 +3513,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000157100ULL, "101 Pony Pets 3D"},
     {0x0004000000157200ULL, "Sumico"},
     {0x0004000000157300ULL, "Passed Maru! Bookkeeping 3rd grade journal drill(マル合格! 簿記3級 仕訳ドリル)"},
-    {0x0004000000157400ULL, "Passed Maru! Bookkeeping Level 2 Journal Drill Commercial Bookkeeping / Industrial Bookkeeping(マル合格! 簿記2級 仕訳ドリル 商業簿記･工業簿記)"},
+    {0x0004000000157400ULL, "Passed Maru! Bookkeeping Level 2 Journal Drill Commercial Bookkeeping / Industrial Bookkeeping(マル合格! 簿記2級 仕訳ドリル 商業簿記-工業簿記)"},
     {0x0004000000157500ULL, "Passed Maru! Company Worker Examination 2015 Edition(マル合格! 社労士試験 平成27年度版)"},
     {0x0004000000157600ULL, "Passed Maru! Medical Medical Clinic Request for Clearing Due to Certification Exam (Medical Sciences)(マル合格! 医療事務 診療報酬 請求事務能力認定試験(医科))"},
     {0x0004000000157700ULL, "Passed Maru! FP3 class 2016-27 version(マル合格! FP3級 平成26-27年度版)"},
@@ -3556,8 +3556,8 @@ static const title_entry_t title_database[] = {
     {0x000400000015A400ULL, "OlliOlli"},
     {0x000400000015A600ULL, "Demon Girl -chronicle 2D ACT- (Traditional Chinese Version)(魔神少女 -Chronicle 2D ACT-(繁體中文版))"},
     {0x000400000015A700ULL, "Puzzle and Dragon Z + Puzzle and Dragon Super Marie of Brothers Edition(퍼즐앤드래곤 Z + 퍼즐앤드래곤 슈퍼 마리오브라더스 에디션)"},
-    {0x000400000015A800ULL, "6×1≠UNLIMITED?(6×1≠UNLIMITED?)"},
-    {0x000400000015A900ULL, "LEGO(R) Marvel Super Heroes The Game(LEGO(R) マーベル スーパー･ヒーローズ ザ･ゲーム)"},
+    {0x000400000015A800ULL, "6x1UNLIMITED?(6x1UNLIMITED?)"},
+    {0x000400000015A900ULL, "LEGO(R) Marvel Super Heroes The Game(LEGO(R) マーベル スーパー-ヒーローズ ザ-ゲーム)"},
     {0x000400000015AA00ULL, "PUZZLEBOX setup"},
     {0x000400000015AD00ULL, "The Legend of Zelda - Majoras Mask 3D"},
     {0x000400000015AE00ULL, "The Legend of Zelda - Majoras Mask 3D"},
@@ -3580,8 +3580,8 @@ static const title_entry_t title_database[] = {
     {0x000400000015C500ULL, "Excave II : Wizard of the Underworld"},
     {0x000400000015C600ULL, "Flick Golf 3D"},
     {0x000400000015CA00ULL, "Ninja Usagimaru - The Gem of Blessings -"},
-    {0x000400000015CB00ULL, "New Rorona's atelier The Story of the Beginning -Alchemist in Arland-(新･ロロナのアトリエ はじまりの 物語 ～アーランドの錬金術士～)"},
-    {0x000400000015CD00ULL, "Dragon Quest ⅷ Sky, Sea, Earth and Cursed Princess(ドラゴンクエストⅧ 空と海と大地と呪われし姫君)"},
+    {0x000400000015CB00ULL, "New Rorona's atelier The Story of the Beginning -Alchemist in Arland-(新-ロロナのアトリエ はじまりの 物語 ～アーランドの錬金術士～)"},
+    {0x000400000015CD00ULL, "Dragon Quest VIII Sky, Sea, Earth and Cursed Princess(ドラゴンクエストVIII 空と海と大地と呪われし姫君)"},
     {0x000400000015CE00ULL, "Gunman Clive 2"},
     {0x000400000015D100ULL, "FAIRUNE (Traditional Chinese Version)(Fairune(繁體中文版))"},
     {0x000400000015D300ULL, "The Smurfs"},
@@ -3594,7 +3594,7 @@ static const title_entry_t title_database[] = {
     {0x000400000015DC00ULL, "Excake -Fate of Fate's Phantom Power Edition-(エクスケーブ ～運命の夢幻塔編～)"},
     {0x000400000015DD00ULL, "Eye Compassel Tappingo(アイコンパズル タッピンゴ)"},
     {0x000400000015DE00ULL, "Outer World 20th Anniversary Edition(Outer World 20th Anniversary Edition)"},
-    {0x000400000015DF00ULL, "Kirka drive(キルカ･ドライブ)"},
+    {0x000400000015DF00ULL, "Kirka drive(キルカ-ドライブ)"},
     {0x000400000015E000ULL, "Ocean runner(オーシャンランナー)"},
     {0x000400000015E100ULL, "Fairloon 2(フェアルーン2)"},
     {0x000400000015E200ULL, "Picross E6(ピクロスe6)"},
@@ -3625,7 +3625,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000160200ULL, "Goosebumps: The Game"},
     {0x0004000000160300ULL, "KAMI"},
     {0x0004000000160400ULL, "Navy Commander"},
-    {0x0004000000160500ULL, "The Sky Fighters -Trium War-(ザ･スカイファイターズ ～トリウム戦争～)"},
+    {0x0004000000160500ULL, "The Sky Fighters -Trium War-(ザ-スカイファイターズ ～トリウム戦争～)"},
     {0x0004000000160800ULL, "Comic Studio 2(コミック工房2)"},
     {0x0004000000160900ULL, "The Smurfs"},
     {0x0004000000160A00ULL, "Everyone's decoration card(みんなのデコレーションカード)"},
@@ -3652,15 +3652,15 @@ static const title_entry_t title_database[] = {
     {0x0004000000162200ULL, "Ijin explosion !! Udejiman(イジン爆闘!!ウデジマン)"},
     {0x0004000000162300ULL, "PUZZLE and DRAGONS SUPER MARIO BROS. EDITION(PUZZLE and DRAGONS SUPER MARIO BROS. EDITION)"},
     {0x0004000000162400ULL, "Passed Maru! Home Building Examination 2015 Edition(マル合格! 宅建試験 平成27年度版)"},
-    {0x0004000000162500ULL, "3D Bear Knuckle II Requiem Song for Death Fight(3D ベア･ナックルⅡ 死闘への鎮魂歌)"},
+    {0x0004000000162500ULL, "3D Bear Knuckle II Requiem Song for Death Fight(3D ベア-ナックルII 死闘への鎮魂歌)"},
     {0x0004000000162600ULL, "3D Gun Star Heroes(3D ガンスターヒーローズ)"},
-    {0x0004000000162700ULL, "3D Sonic the Hedgehog 2(3D ソニック･ザ･ヘッジホッグ2)"},
+    {0x0004000000162700ULL, "3D Sonic the Hedgehog 2(3D ソニック-ザ-ヘッジホッグ2)"},
     {0x0004000000162800ULL, "Puppari ~ Nya!(ひっぱり～ニャ!)"},
     {0x0004000000162900ULL, "Touch Battle Tank 3D-3(タッチバトル戦車3D-3)"},
     {0x0004000000162A00ULL, "Escape Adventure Curse Total(脱出アドベンチャー 呪いの数列)"},
-    {0x0004000000162B00ULL, "Legend of Shiva Curly(シバ･カーリーの伝説)"},
+    {0x0004000000162B00ULL, "Legend of Shiva Curly(シバ-カーリーの伝説)"},
     {0x0004000000162C00ULL, "Grandpa Karl's flying house 3D(カールじいさんの空飛ぶ家 3D)"},
-    {0x0004000000162D00ULL, "LEGO(R) Batman 3 from the Game Gossam to space(LEGO(R)バットマン3 ザ･ゲーム ゴッサムから宇宙へ)"},
+    {0x0004000000162D00ULL, "LEGO(R) Batman 3 from the Game Gossam to space(LEGO(R)バットマン3 ザ-ゲーム ゴッサムから宇宙へ)"},
     {0x0004000000162F00ULL, "Chibi-Robo!(TM) Zip Lash"},
     {0x0004000000163000ULL, "Chibi-Robo!(TM) Zip Lash"},
     {0x0004000000163100ULL, "Stretchmo(TM)"},
@@ -3680,7 +3680,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000164600ULL, "Pokémon(TM) Rumble World"},
     {0x0004000000164700ULL, "Sonic Boom(TM): Fire and Ice"},
     {0x0004000000164800ULL, "Pokémon(TM) Sun"},
-    {0x0004000000164900ULL, "Sugar Rush 3D(シュガー･ラッシュ 3D)"},
+    {0x0004000000164900ULL, "Sugar Rush 3D(シュガー-ラッシュ 3D)"},
     {0x0004000000164A00ULL, "Ever OASIS Spirit and Tanevito Mirage(Ever Oasis 精霊とタネビトの蜃気楼)"},
     {0x0004000000164B00ULL, "Gunman story 2(ガンマンストーリー2)"},
     {0x0004000000164C00ULL, "WE(KAMI)"},
@@ -3710,7 +3710,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000166800ULL, "Goonyan(Goonyan)"},
     {0x0004000000166900ULL, "I'm an Air Controller Airport Hero 3D Haneda All Stars(ぼくは航空管制官 エアポート ヒーロー3D 羽田 ALL STARS)"},
     {0x0004000000166A00ULL, "Reversal trial 6(逆転裁判6)"},
-    {0x0004000000166B00ULL, "Shin Megami Tensei II FINAL(真・女神転生Ⅳ FINAL)"},
+    {0x0004000000166B00ULL, "Shin Megami Tensei II FINAL(真-女神転生IV FINAL)"},
     {0x0004000000166C00ULL, "Battle of Elemental REBOOST(バトル オブ エレメンタル REBOOST)"},
     {0x0004000000166E00ULL, "Monhan Diary Pokkapaka Airou Village DX(モンハン日記 ぽかぽかアイルー村DX)"},
     {0x0004000000166F00ULL, "Comic Workshop 2"},
@@ -3815,7 +3815,7 @@ static const title_entry_t title_database[] = {
     {0x000400000016DF00ULL, "Mujura o asonde kurete - kansha k_pon"},
     {0x000400000016E000ULL, "Excave III : Tower of Destiny"},
     {0x000400000016E100ULL, "Monster Hunter Stories(モンスターハンター ストーリーズ)"},
-    {0x000400000016E200ULL, "Super / Escape Atsushi! The strongest escape(超･逃走中 あつまれ!最強の逃走者たち)"},
+    {0x000400000016E200ULL, "Super / Escape Atsushi! The strongest escape(超-逃走中 あつまれ!最強の逃走者たち)"},
     {0x000400000016E300ULL, "Metroid Prime(TM): Federation Force"},
     {0x000400000016E400ULL, "Metroid Prime Blast Ball(メトロイドプライム ブラストボール)"},
     {0x000400000016E500ULL, "Monster High - New Ghoul in School"},
@@ -3846,7 +3846,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000170100ULL, "Vampire Sniper(ヴァンパイアスナイパー)"},
     {0x0004000000170200ULL, "Noah's shaking basket(ノアの揺り籠)"},
     {0x0004000000170300ULL, "GO! Princess Pretty Cure Sugar Kingdom and 6 Princess!(Go!プリンセスプリキュア シュガー王国と6人のプリンセス!)"},
-    {0x0004000000170400ULL, "Nico ☆ Petit Girls Runway(ニコ☆プチ ガールズランウェイ)"},
+    {0x0004000000170400ULL, "Nico * Petit Girls Runway(ニコ*プチ ガールズランウェイ)"},
     {0x0004000000170500ULL, "Card Fight !! Vanguard G Stride to Victory !!(カードファイト!! ヴァンガードG ストライド トゥ ビクトリー!!)"},
     {0x0004000000170600ULL, "LEGO(R) Ninjago Lonin Shadow(LEGO(R)ニンジャゴー ローニンの影)"},
     {0x0004000000170700ULL, "Sonic Toon Fire and Ice(ソニックトゥーン ファイアー＆アイス)"},
@@ -3876,7 +3876,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000171F00ULL, "Gotcha Racing(TM)"},
     {0x0004000000172000ULL, "Xeodrifter"},
     {0x0004000000172100ULL, "Anna and the Snow Queen Oraf(アナと雪の女王 オラフの贈りもの)"},
-    {0x0004000000172200ULL, "LEGO(R) Jurassic World(LEGO(R)ジュラシック･ワールド)"},
+    {0x0004000000172200ULL, "LEGO(R) Jurassic World(LEGO(R)ジュラシック-ワールド)"},
     {0x0004000000172300ULL, "Pocket monster gold(ポケットモンスター 金)"},
     {0x0004000000172400ULL, "Pokemon Silver(ポケットモンスター 銀)"},
     {0x0004000000172500ULL, "Pokemon Crystal version(ポケットモンスター クリスタルバージョン)"},
@@ -3899,7 +3899,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000173600ULL, "Pokémon(포켓몬스터 은)"},
     {0x0004000000173700ULL, "Stella Glow"},
     {0x0004000000173B00ULL, "SAMURAI WARRIORS: Chronicles 3"},
-    {0x0004000000173C00ULL, "Adventure Time Nameless Kingdom of 3 Princesses(アドベンチャー・タイム ネームレス王国の3人のプリンセス)"},
+    {0x0004000000173C00ULL, "Adventure Time Nameless Kingdom of 3 Princesses(アドベンチャー-タイム ネームレス王国の3人のプリンセス)"},
     {0x0004000000173D00ULL, "Cube creator 3D(キューブクリエイター3D)"},
     {0x0004000000173E00ULL, "I am an Air Traffic Controller Airport Hero Narita"},
     {0x0004000000173F00ULL, "Japanese Rail Sim 3D Journey to Kyoto"},
@@ -3914,7 +3914,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000174900ULL, "Become a wonderful veterinarian!(わんニャンどうぶつ病院 ステキな獣医さんになろう!)"},
     {0x0004000000174A00ULL, "One plate of Food of Somae and Soma Friendship and Bonds(食戟のソーマ 友情と絆の一皿)"},
     {0x0004000000174B00ULL, "Baymax Heroes Battle(ベイマックス ヒーローズバトル)"},
-    {0x0004000000174C00ULL, "Bon Bon Ri Bon Tokimeki Corde Kirakira Dance(ぼんぼんりぼん ときめきコーデ･キラキラダンス)"},
+    {0x0004000000174C00ULL, "Bon Bon Ri Bon Tokimeki Corde Kirakira Dance(ぼんぼんりぼん ときめきコーデ-キラキラダンス)"},
     {0x0004000000174D00ULL, "Three Kingdoms 2(三國志2)"},
     {0x0004000000174E00ULL, "Medalot 9 Kabuto Ver.(メダロット9 カブトVer.)"},
     {0x0004000000174F00ULL, "Medalot 9 stag beetle ver.(メダロット9 クワガタVer.)"},
@@ -3958,7 +3958,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000178000ULL, "Dream Girl Premier(ドリームガール プルミエ)"},
     {0x0004000000178100ULL, "12 years old.~ DIARY in love ~(12歳。 ～恋するDiary～)"},
     {0x0004000000178200ULL, "Alice and Prince!(創作アリスと王子さま!)"},
-    {0x0004000000178300ULL, "Puripara Aim! Idol ☆ Grand Prix No.1!(プリパラ めざせ! アイドル☆グランプリNo.1!)"},
+    {0x0004000000178300ULL, "Puripara Aim! Idol * Grand Prix No.1!(プリパラ めざせ! アイドル*グランプリNo.1!)"},
     {0x0004000000178400ULL, "Raiko-Azure Chapter-(雷子-紺碧の章-)"},
     {0x0004000000178500ULL, "Sumiriko Gurashi Omise starts(すみっコぐらし おみせはじめるんです)"},
     {0x0004000000178800ULL, "Miitopia(Miitopia(ミートピア))"},
@@ -3981,8 +3981,8 @@ static const title_entry_t title_database[] = {
     {0x000400000017A800ULL, "Fire Emblem Fates - Special Edition"},
     {0x000400000017A900ULL, "Johnny's Payday Panic(Johnny's Payday Panic(英日版))"},
     {0x000400000017AA00ULL, "@Simple DL Series Vol.39 The Escape Sports Gym Edition from the closed room(@SIMPLE DLシリーズ Vol.39 THE密室からの脱出スポーツジム編)"},
-    {0x000400000017AB00ULL, "Hermina Jugosic 3D Remix -Ulm Zakir and Dark Ritual-(エルミナージュゴシック3D REMIX ～ウルム･ザキールと闇の儀式～)"},
-    {0x000400000017AC00ULL, "Herminage Identon Amenomi Hashira / Mystery(エルミナージュ異聞 アメノミハシラ･怪)"},
+    {0x000400000017AB00ULL, "Hermina Jugosic 3D Remix -Ulm Zakir and Dark Ritual-(エルミナージュゴシック3D REMIX ～ウルム-ザキールと闇の儀式～)"},
+    {0x000400000017AC00ULL, "Herminage Identon Amenomi Hashira / Mystery(エルミナージュ異聞 アメノミハシラ-怪)"},
     {0x000400000017AD00ULL, "Dai 2-ji s_p_robotto taisen"},
     {0x000400000017AE00ULL, "Dating ball(出会い玉)"},
     {0x000400000017AF00ULL, "The Peanuts Movie - Snoopys Grand Adventure"},
@@ -4016,7 +4016,7 @@ static const title_entry_t title_database[] = {
     {0x000400000017CF00ULL, "Passed Maru! Social Worker Examination 2016 Edition(マル合格! 社会福祉士試験 平成28年度版)"},
     {0x000400000017D000ULL, "IRONFALL -Invasion-(IRONFALL -Invasion-)"},
     {0x000400000017D100ULL, "Waruky_re no b_ken-ji no kagi densetsu - u~izu shaomu~u"},
-    {0x000400000017D200ULL, "Super scientific escape gear detective(超科学脱出 ギア･ディテクティブ)"},
+    {0x000400000017D200ULL, "Super scientific escape gear detective(超科学脱出 ギア-ディテクティブ)"},
     {0x000400000017D300ULL, "Q(Q)"},
     {0x000400000017D400ULL, "I'm Airport Hero 3D Kansai ALL STARS(ぼくは航空管制官 エアポート ヒーロー3D 関空 ALL STARS)"},
     {0x000400000017D500ULL, "Zelda Musou Hailal All Stars(ゼルダ無双 ハイラルオールスターズ)"},
@@ -4064,7 +4064,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000180A00ULL, "Super Chari Run! Super Beast Hunter(超チャリ走 あつめて! 超獣ハンター)"},
     {0x0004000000180B00ULL, "Holy War Chronicle(聖戦クロニクル)"},
     {0x0004000000180C00ULL, "1001 Spikes(1001 Spikes)"},
-    {0x0004000000180D00ULL, "Escape Fantasy Alice in Eskapland(脱出ファンタジー アリス・イン・エスケープランド)"},
+    {0x0004000000180D00ULL, "Escape Fantasy Alice in Eskapland(脱出ファンタジー アリス-イン-エスケープランド)"},
     {0x0004000000180E00ULL, "Sega 3D reprint archives 2(セガ3D復刻アーカイブス2)"},
     {0x0004000000180F00ULL, "ZERO ESCAPE engraved dilemma(ZERO ESCAPE 刻のジレンマ)"},
     {0x0004000000181000ULL, "A mysterious box with my melody wish(マイメロディ 願いがかなう不思議な箱)"},
@@ -4181,7 +4181,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000189800ULL, "Kirby Planet Robobot Demo"},
     {0x0004000000189900ULL, "Battle Puzzle Cross(対戦パズドラクロス)"},
     {0x0004000000189A00ULL, "Kisekae doll Atelier Decado Doll Collection(きせかえ人形 アトリエ デコ ラ ドール コレクション)"},
-    {0x0004000000189B00ULL, "Dancia Saga(ドランシア・サーガ)"},
+    {0x0004000000189B00ULL, "Dancia Saga(ドランシア-サーガ)"},
     {0x0004000000189E00ULL, "The legends of Zelda(젤다무쌍 하이랄의 전설들)"},
     {0x000400000018A100ULL, "Mario and Luigi - Paper Jam Bros."},
     {0x000400000018A400ULL, "Rhythm Heaven(TM) Megamix"},
@@ -4196,7 +4196,7 @@ static const title_entry_t title_database[] = {
     {0x000400000018B000ULL, "Youkai Three Kingdoms(妖怪三国志)"},
     {0x000400000018B200ULL, "Beyblade burst(ベイブレードバースト)"},
     {0x000400000018B300ULL, "RPG Maker Festival(RPGツクール フェス)"},
-    {0x000400000018B400ULL, "Doraemon New Nobita's birth in Japan(ドラえもん 新・のび太の日本誕生)"},
+    {0x000400000018B400ULL, "Doraemon New Nobita's birth in Japan(ドラえもん 新-のび太の日本誕生)"},
     {0x000400000018B500ULL, "Nyanko War POP!(냥코대전쟁 POP!)"},
     {0x000400000018B600ULL, "Goosebumps - The Game"},
     {0x000400000018B700ULL, "Alphadia"},
@@ -4219,7 +4219,7 @@ static const title_entry_t title_database[] = {
     {0x000400000018CD00ULL, "Ninja Smasher!(Ninja Smasher!)"},
     {0x000400000018CE00ULL, "Doko pon choi su - nisekoi Vol. 2"},
     {0x000400000018CF00ULL, "Doko pon choi su - nisekoi Vol. 1"},
-    {0x000400000018D000ULL, "Labyrinth of World Tree ⅴ The end of a long myth(世界樹の迷宮Ⅴ 長き神話の果て)"},
+    {0x000400000018D000ULL, "Labyrinth of World Tree V The end of a long myth(世界樹の迷宮V 長き神話の果て)"},
     {0x000400000018D200ULL, "Doko pon choi su - i shoujo kar_-ban"},
     {0x000400000018D300ULL, "Doko pon choi su - anedo ki~tsu"},
     {0x000400000018D400ULL, "Doko pon choi su - aoharaido"},
@@ -4241,7 +4241,7 @@ static const title_entry_t title_database[] = {
     {0x000400000018E600ULL, "Zero Escape: Zero Time Dilemma(Zero Escape: Zero Time Dilemma)"},
     {0x000400000018E700ULL, "Reversal referee 6 / Phoenix Wright: Ace Attorney -Spirit of Justice (English version)(逆轉裁判 6 / Phoenix Wright: Ace Attorney - Spirit of Justice (英文版))"},
     {0x000400000018E800ULL, "BOXBOXBOY!(TM)"},
-    {0x000400000018E900ULL, "My Hero Academia Battle for All(僕のヒーローアカデミア バトル・フォー・オール)"},
+    {0x000400000018E900ULL, "My Hero Academia Battle for All(僕のヒーローアカデミア バトル-フォー-オール)"},
     {0x000400000018EA00ULL, "ONE PIECE Ocean Pirate Arena(ONE PIECE 大海賊闘技場)"},
     {0x000400000018EB00ULL, "Downtown hot -blooded story SP(ダウンタウン熱血物語SP)"},
     {0x000400000018EE00ULL, "BOXBOXBOY!(TM)"},
@@ -4273,13 +4273,13 @@ static const title_entry_t title_database[] = {
     {0x0004000000190A00ULL, "Megamime tour(めがみめぐり)"},
     {0x0004000000190B00ULL, "Sabak's rat!(サバクのネズミ団！)"},
     {0x0004000000190C00ULL, "Taqi, you will count(TOKI TORI 3D)"},
-    {0x0004000000190D00ULL, "LEGO(R) Star Wars(LEGO(R)スター・ウォーズ)"},
+    {0x0004000000190D00ULL, "LEGO(R) Star Wars(LEGO(R)スター-ウォーズ)"},
     {0x0004000000190E00ULL, "Taiko no Tatsujin Dokodon!Mystery adventure(太鼓の達人 ドコドン！ ミステリーアドベンチャー)"},
     {0x0004000000190F00ULL, "Puzzle Labyrinth"},
     {0x0004000000191000ULL, "Yokai Watch 3 Sushi(妖怪ウォッチ3 スシ)"},
     {0x0004000000191100ULL, "Yo -Kai Watch 3 Templar(妖怪ウォッチ3 テンプラ)"},
     {0x0004000000191300ULL, "Puzzle Labyrinth"},
-    {0x0004000000191400ULL, "Tunagare Numbers(ツナガレ・ナンバーズ)"},
+    {0x0004000000191400ULL, "Tunagare Numbers(ツナガレ-ナンバーズ)"},
     {0x0004000000191500ULL, "Metroid(Metroid)"},
     {0x0004000000191600ULL, "Donkey Kong(Donkey Kong)"},
     {0x0004000000191700ULL, "Baseball(Baseball)"},
@@ -4324,7 +4324,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000194C00ULL, "Magic hammer(マジックハンマー)"},
     {0x0004000000194E00ULL, "Kuni Okun Heat Blood Complete NES edition(くにおくん熱血コンプリート ファミコン編)"},
     {0x0004000000194F00ULL, "Train operation command!Tokaido edition(電車運転指令！ 東海道編)"},
-    {0x0004000000195000ULL, "RV-7 My Drone(RV-7 マイ・ドローン)"},
+    {0x0004000000195000ULL, "RV-7 My Drone(RV-7 マイ-ドローン)"},
     {0x0004000000195100ULL, "Cartoon Network: Battle Crashers"},
     {0x0004000000195300ULL, "Zelda II The Adventure of Link(Zelda II The Adventure of Link)"},
     {0x0004000000195500ULL, "Metroid II -Return of Samus (Metroid II -Return of Samus)(Metroid II - Return of Samus (메트로이드 II-리턴 오브 사무스))"},
@@ -4380,7 +4380,7 @@ static const title_entry_t title_database[] = {
     {0x0004000000199300ULL, "Caldocept (R) Revolt Start Dash Ver.(カルドセプト(R) リボルト スタートダッシュVer.)"},
     {0x0004000000199700ULL, "Ice Station Z"},
     {0x0004000000199800ULL, "Fatamolghana no Museum(ファタモルガーナの館)"},
-    {0x0004000000199900ULL, "Super -the ultimate ninja during battle and the battle player top battle!(超・戦闘中 究極の忍と バトルプレイヤー頂上決戦！)"},
+    {0x0004000000199900ULL, "Super -the ultimate ninja during battle and the battle player top battle!(超-戦闘中 究極の忍と バトルプレイヤー頂上決戦！)"},
     {0x0004000000199C00ULL, "Monster Hunter Stories (TM) (Japanese version)(MONSTER HUNTER STORIES(TM) (日文版))"},
     {0x0004000000199D00ULL, "TOYS vs Monsters (Japanese version)(Toys VS Monsters (日文版))"},
     {0x0004000000199E00ULL, "Shift dx (Japanese version)(Shift DX (日文版))"},
@@ -4416,7 +4416,7 @@ static const title_entry_t title_database[] = {
     {0x000400000019CA00ULL, "Outing octopus octopus(おでかけタコりん ちょいがえ)"},
     {0x000400000019CD00ULL, "All Kamen Rider Rider Revolution(オール仮面ライダー ライダーレボリューション)"},
     {0x000400000019CF00ULL, "Kamiwazawanda(カミワザワンダ)"},
-    {0x000400000019D000ULL, "Lillil Fairyl glitter ☆ First Fairyl Magic ♪(リルリルフェアリル キラキラ☆ はじめてのフェアリルマジック♪)"},
+    {0x000400000019D000ULL, "Lillil Fairyl glitter * First Fairyl Magic *(リルリルフェアリル キラキラ* はじめてのフェアリルマジック*)"},
     {0x000400000019D100ULL, "Digimon Universe Applimon Stars(デジモンユニバース アプリモンスターズ)"},
     {0x000400000019D300ULL, "Railway Topin! Running the Route Tomas Oigawa Railway!(鉄道にっぽん!路線たび きかんしゃ トーマス編 大井川鐵道を走ろう!)"},
     {0x000400000019D400ULL, "Dot paint(ドットペイント)"},
@@ -4444,7 +4444,7 @@ static const title_entry_t title_database[] = {
     {0x000400000019F300ULL, "Polara"},
     {0x000400000019F400ULL, "Polara"},
     {0x000400000019F500ULL, "STORY OF SEASONS: Trio of Towns"},
-    {0x000400000019F600ULL, "Girls Mode 4 Star ☆ Stylist(Girls Mode 4 スター☆スタイリスト)"},
+    {0x000400000019F600ULL, "Girls Mode 4 Star * Stylist(Girls Mode 4 スター*スタイリスト)"},
     {0x000400000019F900ULL, "Professor Layton and the Eternal Diva"},
     {0x000400000019FB00ULL, "Professor Layton und die ewige Diva"},
     {0x000400000019FC00ULL, "Professeur Layton et la Diva _ternelle"},
@@ -4702,7 +4702,7 @@ static const title_entry_t title_database[] = {
     {0x00040000001B2000ULL, "Sudoku Party"},
     {0x00040000001B2200ULL, "Word Search 10K"},
     {0x00040000001B2300ULL, "Train operation command!Tokyo Bay edition(電車運転指令！ 東京湾編)"},
-    {0x00040000001B2400ULL, "True Goddess Deep Strange Journey(真・女神転生 DEEP STRANGE JOURNEY)"},
+    {0x00040000001B2400ULL, "True Goddess Deep Strange Journey(真-女神転生 DEEP STRANGE JOURNEY)"},
     {0x00040000001B2500ULL, "World Tree and Mysterious Dungeon 2(世界樹と不思議のダンジョン2)"},
     {0x00040000001B2600ULL, "Kunio -gun Passion Comicom(쿠니오군 열혈 컴플리트 패미컴 편)"},
     {0x00040000001B2700ULL, "YO-KAI WATCH(TM) 2: Psychic Specters"},
@@ -4730,7 +4730,7 @@ static const title_entry_t title_database[] = {
     {0x00040000001B4200ULL, "Battleminerz"},
     {0x00040000001B4300ULL, "Dragon Ball Heroes Ultimate Mission X(ドラゴンボールヒーローズ アルティメットミッションＸ)"},
     {0x00040000001B4400ULL, "Butterfly Inchworm Animation II"},
-    {0x00040000001B4500ULL, "Alliance Alive(アライアンス・アライブ)"},
+    {0x00040000001B4500ULL, "Alliance Alive(アライアンス-アライブ)"},
     {0x00040000001B4600ULL, "Jikky_ pawafurupuroyaky_ h_r_zu - [taiken-ban]"},
     {0x00040000001B4800ULL, "SEVERED-Severard-(SEVERED-セヴァード-)"},
     {0x00040000001B4900ULL, "Urbant Rial: Freestyle 2(アーバントライアル： フリースタイル２)"},
@@ -4824,7 +4824,7 @@ static const title_entry_t title_database[] = {
     {0x00040000001BB700ULL, "Go! Go! Kokopolo 3D"},
     {0x00040000001BB800ULL, "Super Mario Maker for Nintendo 3DS(슈퍼 마리오 메이커 for 닌텐도 3DS)"},
     {0x00040000001BB900ULL, "Cat Atsume(ねこあつめ)"},
-    {0x00040000001BBA00ULL, "The Game 15(ザ・ゲーム１５)"},
+    {0x00040000001BBA00ULL, "The Game 15(ザ-ゲーム１５)"},
     {0x00040000001BBB00ULL, "Puroyagu famisuta Retoro"},
     {0x00040000001BBC00ULL, "1000m zombie scape!(1000m ゾンビエスケープ！)"},
     {0x00040000001BBD00ULL, "Apollo Justice: Ace Attorney"},
@@ -4848,8 +4848,8 @@ static const title_entry_t title_database[] = {
     {0x00040000001BDC00ULL, "Kung Fu FIGHT!"},
     {0x00040000001BDE00ULL, "Farming Simulator 18 Pocket Farm 4(ファーミングシミュレーター18 ポケット農園4)"},
     {0x00040000001BDF00ULL, "BLASTING AGENT ULTIMATE EDITION(BLASTING AGENT ULTIMATE EDITION)"},
-    {0x00040000001BE000ULL, "Herminage II -The goddess of twins and the earth of fate-(エルミナージュⅡ ～双生の女神と運命の大地～)"},
-    {0x00040000001BE100ULL, "PICTLOGICA FINAL FANTASY ≒(PICTLOGICA FINAL FANTASY ≒)"},
+    {0x00040000001BE000ULL, "Herminage II -The goddess of twins and the earth of fate-(エルミナージュII ～双生の女神と運命の大地～)"},
+    {0x00040000001BE100ULL, "PICTLOGICA FINAL FANTASY (PICTLOGICA FINAL FANTASY )"},
     {0x00040000001BE200ULL, "Kung Fu FIGHT!"},
     {0x00040000001BE300ULL, "River City: Knights of Justice"},
     {0x00040000001BE400ULL, "Kid Icarus 3D Anime Medusa_s Revenge"},
@@ -4889,7 +4889,7 @@ static const title_entry_t title_database[] = {
     {0x00040000001C0B00ULL, "Timberman"},
     {0x00040000001C0D00ULL, "River City: Knights of Justice"},
     {0x00040000001C0E00ULL, "Tanteijinguujisabur_ Yokohama-k_ renzoku satsujin jiken"},
-    {0x00040000001C0F00ULL, "Alliance Alive trial version(アライアンス・アライブ 体験版)"},
+    {0x00040000001C0F00ULL, "Alliance Alive trial version(アライアンス-アライブ 体験版)"},
     {0x00040000001C1000ULL, "Gekiya Banganner Habanero(ゲキヤバランナーハバネロ)"},
     {0x00040000001C1100ULL, "Administrative scrivener test 2017 version(行政書士試験平成29年度版)"},
     {0x00040000001C1300ULL, "Passed Maru!Home Building Examination 2017 Edition(マル合格！宅建士試験 平成29年度版)"},
@@ -4923,24 +4923,24 @@ static const title_entry_t title_database[] = {
     {0x00040000001C3500ULL, "Soungun(みんなでナンプレ)"},
     {0x00040000001C3600ULL, "Bit Dungeon+(Bit Dungeon+)"},
     {0x00040000001C3700ULL, "Dragon Quest(ドラゴンクエスト)"},
-    {0x00040000001C3800ULL, "Dragon Quest Ⅱ The gods of the evil spirits(ドラゴンクエストⅡ 悪霊の神々)"},
-    {0x00040000001C3900ULL, "Dragon Quest II and to the legend ...(ドラゴンクエストⅢ そして伝説へ...)"},
+    {0x00040000001C3800ULL, "Dragon Quest II The gods of the evil spirits(ドラゴンクエストII 悪霊の神々)"},
+    {0x00040000001C3900ULL, "Dragon Quest II and to the legend ...(ドラゴンクエストIII そして伝説へ...)"},
     {0x00040000001C3A00ULL, "Doragon kuesuto"},
     {0x00040000001C3D00ULL, "Mysterious Stars 3D: Road To Idol"},
     {0x00040000001C3E00ULL, "Mysterious Stars 3D: A Fairy Tale"},
     {0x00040000001C3F00ULL, "I am an air traffic controller AIRPORT HERO OSAKA-KIX"},
     {0x00040000001C4000ULL, "Asdivine Cross"},
     {0x00040000001C4600ULL, "12 years old.Deleted puzzle harmony(１２歳。とろけるパズル ふたりのハーモニー)"},
-    {0x00040000001C4700ULL, "The Game 15 Vol2(ザ・ゲーム１５ Vol２)"},
+    {0x00040000001C4700ULL, "The Game 15 Vol2(ザ-ゲーム１５ Vol２)"},
     {0x00040000001C4800ULL, "Mardita Castilla(マルディタカスティーラ)"},
-    {0x00040000001C4900ULL, "The Dead Heat Breakers(ザ・デッドヒートブレイカーズ)"},
+    {0x00040000001C4900ULL, "The Dead Heat Breakers(ザ-デッドヒートブレイカーズ)"},
     {0x00040000001C4A00ULL, "Crollors Game Pack"},
     {0x00040000001C4D00ULL, "Mario Party(TM): The Top 100"},
     {0x00040000001C4E00ULL, "Mario Party(TM): The Top 100"},
     {0x00040000001C4F00ULL, "Mario and Luigi RPG 1 DX(마리오&루이지 RPG 1 DX)"},
     {0x00040000001C5000ULL, "Asdivine Cross"},
     {0x00040000001C5100ULL, "Etrian Odyssey V: Beyond the Myth"},
-    {0x00040000001C5200ULL, "Herminage II -The Dark Apostle and the Sun Palace-(エルミナージュⅢ ～暗黒の使徒と太陽の宮殿～)"},
+    {0x00040000001C5200ULL, "Herminage II -The Dark Apostle and the Sun Palace-(エルミナージュIII ～暗黒の使徒と太陽の宮殿～)"},
     {0x00040000001C5300ULL, "Etrian Odyssey V: Beyond the Myth"},
     {0x00040000001C5500ULL, "Squareboy vs Bullies: Arena Edition"},
     {0x00040000001C5600ULL, "Hey!PIKMIN (Hey! Peak Min)(Hey! PIKMIN(헤이! 피크민))"},
@@ -5044,9 +5044,9 @@ static const title_entry_t title_database[] = {
     {0x00040000001CF800ULL, "Machine Knight"},
     {0x00040000001CFA00ULL, "Fat Dragons"},
     {0x00040000001CFD00ULL, "Picross E8(ピクロスe8)"},
-    {0x00040000001CFE00ULL, "Fun / interesting Kanken Elementary School Students(たのしく・おもしろく 漢検小学生)"},
+    {0x00040000001CFE00ULL, "Fun / interesting Kanken Elementary School Students(たのしく-おもしろく 漢検小学生)"},
     {0x00040000001CFF00ULL, "Mosaic Art Fill-A-PIX(モザイクアート Fill-a-Pix)"},
-    {0x00040000001D0000ULL, "The Dead Heat Breakers trial version(ザ・デッドヒートブレイカーズ 体験版)"},
+    {0x00040000001D0000ULL, "The Dead Heat Breakers trial version(ザ-デッドヒートブレイカーズ 体験版)"},
     {0x00040000001D0100ULL, "WAKU WAKU SWEETS: Happy Sweets Making"},
     {0x00040000001D0300ULL, "Fat Dragons"},
     {0x00040000001D0400ULL, "WAKU WAKU SWEETS: Happy Sweets Making"},
@@ -5054,8 +5054,8 @@ static const title_entry_t title_database[] = {
     {0x00040000001D0600ULL, "Big Bass Arcade: No Limit"},
     {0x00040000001D0700ULL, "Thorium Wars: Attack of the Skyfighter"},
     {0x00040000001D0900ULL, "Battleminerz(Battleminerz)"},
-    {0x00040000001D0B00ULL, "Cat / Tomo(ネコ・トモ)"},
-    {0x00040000001D0C00ULL, "Witches and heroes Ⅲ(魔女と勇者Ⅲ)"},
+    {0x00040000001D0B00ULL, "Cat / Tomo(ネコ-トモ)"},
+    {0x00040000001D0C00ULL, "Witches and heroes III(魔女と勇者III)"},
     {0x00040000001D0E00ULL, "Link-a-Pix Colour"},
     {0x00040000001D0F00ULL, "Let's go with a cute pet!Wan Nyan and Idol Animal(かわいいペットとくらそう！ わんニャン＆アイドルアニマル)"},
     {0x00040000001D1100ULL, "Witch and Hero 3"},
@@ -5286,7 +5286,7 @@ static const title_entry_t title_database[] = {
     {0x000400000F702D00ULL, "Wind-up Knight 2"},
     {0x000400000F702E00ULL, "Super Donkey Kong 3 Mysterious Clemis Island(スーパードンキーコング3 謎のクレミス島)"},
     {0x000400000F702F00ULL, "Donkey Kong Country 3: Dixie Kong's Double Trouble(TM)"},
-    {0x000400000F703000ULL, "Super Street Fighter II The New Challengers(スーパーストリートファイターⅡ ザ ニューチャレンジャーズ)"},
+    {0x000400000F703000ULL, "Super Street Fighter II The New Challengers(スーパーストリートファイターII ザ ニューチャレンジャーズ)"},
     {0x000400000F703100ULL, "Super Street Fighter(TM) II: The New Challengers"},
     {0x000400000F703200ULL, "Rockman X2(ロックマンX2)"},
     {0x000400000F703300ULL, "Mega Man X2"},
@@ -5300,7 +5300,7 @@ static const title_entry_t title_database[] = {
     {0x000400000F703D00ULL, "Fire Emblem Mystery(ファイアーエムブレム 紋章の謎)"},
     {0x000400000F703E00ULL, "Final fight(ファイナルファイト)"},
     {0x000400000F703F00ULL, "Final Fight"},
-    {0x000400000F704000ULL, "Street Fighter Ⅱ Turbo Hyperfighting(ストリートファイターⅡ ターボ ハイパー ファイティング)"},
+    {0x000400000F704000ULL, "Street Fighter II Turbo Hyperfighting(ストリートファイターII ターボ ハイパー ファイティング)"},
     {0x000400000F704100ULL, "Street Fighter(TM) II Turbo: Hyper Fighting"},
     {0x000400000F704200ULL, "Street Fighter ZERO2(ストリートファイターZERO2)"},
     {0x000400000F704300ULL, "Street Fighter(TM) Alpha 2"},
@@ -5315,11 +5315,11 @@ static const title_entry_t title_database[] = {
     {0x000400000F704C00ULL, "Final Fight 2(TM)"},
     {0x000400000F704D00ULL, "Final Fight Tough(ファイナルファイト タフ)"},
     {0x000400000F704E00ULL, "Final Fight 3(TM)"},
-    {0x000400000F705100ULL, "Romancing Sa Ga(ロマンシング サ・ガ)"},
+    {0x000400000F705100ULL, "Romancing Sa Ga(ロマンシング サ-ガ)"},
     {0x000400000F705200ULL, "Tactics Ouga(タクティクスオウガ)"},
     {0x000400000F705300ULL, "Breath of Fire Dragon Warrior(ブレス オブ ファイア 竜の戦士)"},
     {0x000400000F705400ULL, "BREATH OF FIRE"},
-    {0x000400000F705500ULL, "Breath of Fire II child of mission(ブレス オブ ファイアⅡ 使命の子)"},
+    {0x000400000F705500ULL, "Breath of Fire II child of mission(ブレス オブ ファイアII 使命の子)"},
     {0x000400000F705600ULL, "Breath of Fire II"},
     {0x000400000F705700ULL, "Pop'n Twin Bee(Pop'nツインビー)"},
     {0x000400000F705900ULL, "Dragon fang(ドラゴンファング)"},
@@ -5334,7 +5334,7 @@ static const title_entry_t title_database[] = {
     {0x000400000F706800ULL, "DEMON'S CREST(TM)"},
     {0x000400000F706900ULL, "Lifespeed"},
     {0x000400000F706A00ULL, "Lifespeed"},
-    {0x000400000F706B00ULL, "Live a live(ライブ・ア・ライブ)"},
+    {0x000400000F706B00ULL, "Live a live(ライブ-ア-ライブ)"},
     {0x000400000F707000ULL, "BlockForm"},
     {0x000400000F707100ULL, "BlockForm"},
     {0x000400000F707200ULL, "BRICK RACE"},
@@ -5344,13 +5344,13 @@ static const title_entry_t title_database[] = {
     {0x000400000F707600ULL, "Final Fantasy V(ファイナルファンタジーV)"},
     {0x000400000F707700ULL, "Final Fantasy VI(ファイナルファンタジーVI)"},
     {0x000400000F707800ULL, "Pixel Hunter"},
-    {0x000400000F707900ULL, "Romancing Sa Ga 2(ロマンシング サ・ガ2)"},
+    {0x000400000F707900ULL, "Romancing Sa Ga 2(ロマンシング サ-ガ2)"},
     {0x000400000F707A00ULL, "Good luck Goemon 3 Lion Shigokubei's Karakuri Swastika Firm(がんばれゴエモン3 獅子重禄兵衛のからくり卍固め)"},
     {0x000400000F707B00ULL, "Rado Castle Dracula XX(悪魔城ドラキュラXX)"},
     {0x000400000F707D00ULL, "Castlevania Dracula X"},
     {0x000400000F707F00ULL, "Hyperlight EX"},
     {0x000400000F708100ULL, "Hyperlight EX"},
-    {0x000400000F708200ULL, "NES Detective Club Part II Girl standing in the back(ファミコン探偵倶楽部 PARTⅡ うしろに立つ少女)"},
+    {0x000400000F708200ULL, "NES Detective Club Part II Girl standing in the back(ファミコン探偵倶楽部 PARTII うしろに立つ少女)"},
     {0x000400000F708300ULL, "Legendary Ouga Battle(伝説のオウガバトル)"},
     {0x000400000F708400ULL, "Scoop'n Birds"},
     {0x000400000F708500ULL, "Pirate Pop Plus"},
@@ -8730,15 +8730,21 @@ bool title_database_contains(u64 title_id)
 	return lookup_game_name(title_id) != NULL;
 }
 
+// Entries are emitted sorted by title ID.
 const char* lookup_game_name(u64 title_id) {
-    u32 database_size = get_database_size();
+    u32 lo = 0;
+    u32 hi = get_database_size();
 
-    for (u32 i = 0; i < database_size; i++) {
-        if (title_database[i].title_id == title_id) {
-            return title_database[i].game_name;
-        }
+    while (lo < hi) {
+        u32 mid = lo + (hi - lo) / 2;
+        if (title_database[mid].title_id < title_id)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
 
+    if (lo < get_database_size() && title_database[lo].title_id == title_id)
+        return title_database[lo].game_name;
     return NULL;
 }
 
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_histogram.h"
+
+#include <string.h>
+
+#include "title_database.h"
+#include "title_picker.h"
+
+static bool scan_contains(const title_scan_t *scan, u64 titleId)
+{
+	u32 i;
+
+	for (i = 0; i < scan->count; i++) {
+		if (scan->titles[i] == titleId)
+			return true;
+	}
+
+	return false;
+}
+
+void title_histogram_build(title_histogram_t *hist, const title_scan_t *const scans[TITLE_HISTOGRAM_MEDIA_COUNT],
+	u32 mediaMask)
+{
+	u32 media;
+
+	if (hist == NULL)
+		return;
+
+	memset(hist, 0, sizeof(*hist));
+	if (scans == NULL)
+		return;
+
+	for (media = 0; media < TITLE_HISTOGRAM_MEDIA_COUNT; media++) {
+		if (scans[media] != NULL && (mediaMask & TITLE_HISTOGRAM_MEDIA_BIT(media)))
+			hist->media_mask |= TITLE_HISTOGRAM_MEDIA_BIT(media);
+	}
+
+	for (media = 0; media < TITLE_HISTOGRAM_MEDIA_COUNT; media++) {
+		const title_scan_t *scan = scans[media];
+		u32 i;
+
+		if ((hist->media_mask & TITLE_HISTOGRAM_MEDIA_BIT(media)) == 0)
+			continue;
+
+		for (i = 0; i < scan->count; i++) {
+			u64 titleId = scan->titles[i];
+			u32 cls = title_meta_category_class(title_meta_decode_category(titleId));
+			u32 set = TITLE_HISTOGRAM_MEDIA_BIT(media);
+			bool counted = false;
+			bool isVc;
+			u32 other;
+
+			/* A title on several media goes to the first list holding it, with all of them in its set. */
+			for (other = 0; other < TITLE_HISTOGRAM_MEDIA_COUNT; other++) {
+				if (other == media || (hist->media_mask & TITLE_HISTOGRAM_MEDIA_BIT(other)) == 0 ||
+				    !scan_contains(scans[other], titleId))
+					continue;
+				if (other < media) {
+					counted = true;
+					break;
+				}
+				set |= TITLE_HISTOGRAM_MEDIA_BIT(other);
+			}
+			if (counted)
+				continue;
+
+			isVc = cls == TITLE_CLASS_APPLICATION && title_database_is_virtual_console(titleId);
+			hist->cells[title_meta_class_index(cls)][isVc][title_database_contains(titleId)][set]++;
+			hist->title_count++;
+		}
+	}
+}
+
+u32 title_histogram_count(const title_histogram_t *hist, const title_filter_options_t *filters,
+	bool include_homebrew, u32 mediaMask)
+{
+	u32 classMask;
+	u32 count = 0;
+	u32 slot;
+
+	if (hist == NULL || filters == NULL)
+		return 0;
+
+	classMask = title_meta_compile_filter_mask(filters);
+	mediaMask &= hist->media_mask;
+
+	for (slot = 0; slot < TITLE_CLASS_COUNT; slot++) {
+		u32 vc;
+
+		for (vc = 0; vc < 2; vc++) {
+			u32 catalog;
+
+			for (catalog = 0; catalog < 2; catalog++) {
+				const u16 *sets = hist->cells[slot][vc][catalog];
+				u32 set;
+
+				if (!title_picker_traits_eligible(1u << slot, vc != 0, catalog != 0, classMask, filters,
+					include_homebrew))
+					continue;
+
+				for (set = 1; set < TITLE_HISTOGRAM_MEDIA_SETS; set++) {
+					if (set & mediaMask)
+						count += sets[set];
+				}
+			}
+		}
+	}
+
+	return count;
+}
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_HISTOGRAM_H
+#define TITLE_HISTOGRAM_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+#include "title_meta.h"
+#include "title_scan.h"
+
+/* Indexed by FS_MediaType: NAND, SD, game card. */
+#define TITLE_HISTOGRAM_MEDIA_COUNT 3
+/* A title's cell records every scanned media it is on, so a title on two media counts once. */
+#define TITLE_HISTOGRAM_MEDIA_SETS (1u << TITLE_HISTOGRAM_MEDIA_COUNT)
+#define TITLE_HISTOGRAM_MEDIA_BIT(media) (1u << (u32)(media))
+
+/*
+ * Scanned titles counted per (filter class x Virtual Console x in catalog x media set). Every
+ * pool setting filters whole cells, so the pool size for any settings is a sum over the cells.
+ */
+typedef struct {
+	u16 cells[TITLE_CLASS_COUNT][2][2][TITLE_HISTOGRAM_MEDIA_SETS];
+	/* Media whose lists were counted. */
+	u32 media_mask;
+	u32 title_count;
+} title_histogram_t;
+
+/// Count the scanned lists (scans indexed by FS_MediaType; media outside mediaMask are skipped).
+/// One catalog lookup per title, plus a search of the other lists for titles on several media.
+void title_histogram_build(title_histogram_t *hist, const title_scan_t *const scans[TITLE_HISTOGRAM_MEDIA_COUNT],
+	u32 mediaMask);
+
+/// Titles the pool would hold with these settings, on the media in mediaMask. O(cells); media
+/// that were not counted contribute nothing.
+u32 title_histogram_count(const title_histogram_t *hist, const title_filter_options_t *filters,
+	bool include_homebrew, u32 mediaMask);
+
+#endif
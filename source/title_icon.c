@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_icon.h"
+
+#include <string.h>
+
+#define BOTTOM_SCREEN_WIDTH 320
+#define BOTTOM_SCREEN_HEIGHT 240
+
+/*
+ * Morton indices 2k and 2k+1 differ only in x bit 0, so every pair is two adjacent pixels
+ * and moves as one 32-bit word.
+ */
+const u8 title_icon_tile_pairs[32] = {
+	 0,  8,  2, 10, 16, 24, 18, 26,  4, 12,  6, 14, 20, 28, 22, 30,
+	32, 40, 34, 42, 48, 56, 50, 58, 36, 44, 38, 46, 52, 60, 54, 62,
+};
+
+void title_icon_decode_rgb565(const u16 *tiled, u32 dim, u16 *out)
+{
+	u32 dstOffsets[32];
+	u32 tx;
+	u32 ty;
+	u32 i;
+
+	if (tiled == NULL || out == NULL || dim == 0 || (dim & 7) != 0)
+		return;
+
+	for (i = 0; i < 32; i++)
+		dstOffsets[i] = (u32)(title_icon_tile_pairs[i] >> 3) * dim + (title_icon_tile_pairs[i] & 7);
+
+	for (ty = 0; ty < dim; ty += 8) {
+		for (tx = 0; tx < dim; tx += 8) {
+			u16 *tileOut = out + ty * dim + tx;
+
+			for (i = 0; i < 32; i++) {
+				memcpy(tileOut + dstOffsets[i], tiled, 2 * sizeof(u16));
+				tiled += 2;
+			}
+		}
+	}
+}
+
+void title_icon_init_bottom_screen(void)
+{
+	gfxSetScreenFormat(GFX_BOTTOM, GSP_RGB565_OES);
+	gfxSetDoubleBuffering(GFX_BOTTOM, false);
+	title_icon_clear_bottom(0x0000);
+}
+
+void title_icon_clear_bottom(u16 color)
+{
+	u16 *fb = (u16 *)gfxGetFramebuffer(GFX_BOTTOM, GFX_LEFT, NULL, NULL);
+	u32 i;
+
+	if (fb == NULL)
+		return;
+
+	for (i = 0; i < BOTTOM_SCREEN_WIDTH * BOTTOM_SCREEN_HEIGHT; i++)
+		fb[i] = color;
+
+	gfxFlushBuffers();
+}
+
+void title_icon_draw_bottom(const u16 *pixels, u32 width, u32 height, u32 x, u32 y, u32 scale)
+{
+	u16 *fb = (u16 *)gfxGetFramebuffer(GFX_BOTTOM, GFX_LEFT, NULL, NULL);
+	u32 outWidth;
+	u32 outHeight;
+	u32 sx;
+
+	if (fb == NULL || pixels == NULL || scale == 0)
+		return;
+
+	outWidth = width * scale;
+	outHeight = height * scale;
+	if (x + outWidth > BOTTOM_SCREEN_WIDTH || y + outHeight > BOTTOM_SCREEN_HEIGHT)
+		return;
+
+	/* The framebuffer is rotated: each screen column is a contiguous run, bottom to top. */
+	for (sx = 0; sx < outWidth; sx++) {
+		const u16 *src = pixels + sx / scale;
+		u16 *dst = fb + (x + sx) * BOTTOM_SCREEN_HEIGHT + (BOTTOM_SCREEN_HEIGHT - 1 - y);
+		u32 sy;
+
+		for (sy = 0; sy < outHeight; sy++)
+			*(dst - sy) = src[(sy / scale) * width];
+	}
+
+	gfxFlushBuffers();
+}
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_ICON_H
+#define TITLE_ICON_H
+
+#include <3ds.h>
+
+/* SMDH icons are RGB565 in 8x8 tiles, pixels Morton (Z-order) within each tile. */
+#define TITLE_ICON_SMALL_DIM 24
+#define TITLE_ICON_LARGE_DIM 48
+#define TITLE_ICON_SMALL_OFFSET 0x2040
+#define TITLE_ICON_LARGE_OFFSET 0x24C0
+
+/// Row-major offset (y * 8 + x) of each horizontal pixel pair inside an 8x8 tile, in Morton order.
+/// Pair k holds Morton pixels 2k and 2k+1, which are always x and x + 1 on the same row.
+extern const u8 title_icon_tile_pairs[32];
+
+/// De-swizzle a tiled dim x dim RGB565 icon (dim multiple of 8) into row-major RGB565.
+void title_icon_decode_rgb565(const u16 *tiled, u32 dim, u16 *out);
+
+/// Switch the bottom screen to single-buffered RGB565 for icon blits. Call once after gfxInitDefault.
+void title_icon_init_bottom_screen(void);
+
+/// Fill the bottom screen with one RGB565 color.
+void title_icon_clear_bottom(u16 color);
+
+/// Blit a row-major RGB565 image (icon or banner) to the bottom screen at (x, y), scaled by an
+/// integer factor. Images that do not fit are skipped.
+void title_icon_draw_bottom(const u16 *pixels, u32 width, u32 height, u32 x, u32 y, u32 scale);
+
+#endif
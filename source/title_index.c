@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_index.h"
+
+#include <string.h>
+
+#define TITLE_INDEX_STACK_SIZE (32 * 1024)
+#define TITLE_INDEX_PAUSE_SLEEP_NS (5LL * 1000 * 1000)
+/* A pausing caller polls this often for the read in flight to finish. */
+#define TITLE_INDEX_IDLE_POLL_NS (500LL * 1000)
+
+/*
+ * Single writer (indexer thread), single reader (main thread). Entries below
+ * g_done are complete and never rewritten while the thread runs; the barrier
+ * before each g_done store publishes the entry payload first.
+ *
+ * g_busy is raised before the worker checks g_pause and lowered once the read is done; with a
+ * full barrier on both sides, a pausing caller that sees it low knows no read can start.
+ */
+static title_source_t g_titles[TITLE_PICKER_POOL_MAX];
+static title_index_entry_t g_entries[TITLE_PICKER_POOL_MAX];
+static u32 g_total = 0;
+static volatile u32 g_done = 0;
+static volatile bool g_stop = false;
+static volatile u32 g_pause = 0;
+static volatile bool g_busy = false;
+static Thread g_thread = NULL;
+
+static void copy_utf8_truncated(char *out, size_t outSize, const char *text)
+{
+	size_t len = strlen(text);
+
+	if (len >= outSize) {
+		len = outSize - 1;
+		while (len > 0 && ((unsigned char)text[len] & 0xC0) == 0x80)
+			len--;
+	}
+
+	memcpy(out, text, len);
+	out[len] = '\0';
+}
+
+static void index_one(const title_source_t *title, title_index_entry_t *entry)
+{
+	title_smdh_info_t info;
+	char text[TITLE_SMDH_SHORT_NAME_UTF8_MAX];
+	Result res;
+
+	memset(entry, 0, sizeof(*entry));
+	entry->titleId = title->titleId;
+	entry->smdh_result = title_smdh_load_ex(title->titleId, title->media, &info, NULL, &res);
+	if (entry->smdh_result != TITLE_SMDH_OK)
+		return;
+
+	copy_utf8_truncated(entry->name, sizeof(entry->name),
+		title_smdh_field(&info, TITLE_SMDH_FIELD_SHORT_NAME, text, sizeof(text)));
+	copy_utf8_truncated(entry->publisher, sizeof(entry->publisher),
+		title_smdh_field(&info, TITLE_SMDH_FIELD_PUBLISHER, text, sizeof(text)));
+	entry->region_lock = info.region_lock;
+	entry->flags = info.flags;
+}
+
+static void index_thread_main(void *arg)
+{
+	u32 i;
+
+	(void)arg;
+
+	for (i = g_done; i < g_total && !g_stop; i++) {
+		for (;;) {
+			g_busy = true;
+			__sync_synchronize();
+			if (g_pause == 0 || g_stop)
+				break;
+			g_busy = false;
+			svcSleepThread(TITLE_INDEX_PAUSE_SLEEP_NS);
+		}
+		if (g_stop)
+			break;
+
+		index_one(&g_titles[i], &g_entries[i]);
+		__sync_synchronize();
+		g_done = i + 1;
+		g_busy = false;
+	}
+	g_busy = false;
+}
+
+void title_index_stop(void)
+{
+	if (g_thread == NULL)
+		return;
+
+	g_stop = true;
+	threadJoin(g_thread, U64_MAX);
+	threadFree(g_thread);
+	g_thread = NULL;
+	g_stop = false;
+}
+
+void title_index_sync(const title_source_t *titles, u32 titleCount)
+{
+	title_index_sync_seeded(titles, titleCount, NULL, 0);
+}
+
+void title_index_sync_seeded(const title_source_t *titles, u32 titleCount,
+	const title_index_entry_t *seed, u32 seedCount)
+{
+	s32 priority = 0x30;
+	u32 seeded = 0;
+
+	if (titles == NULL)
+		titleCount = 0;
+	if (titleCount > TITLE_PICKER_POOL_MAX)
+		titleCount = TITLE_PICKER_POOL_MAX;
+
+	if (titleCount == g_total && (g_thread != NULL || g_done == g_total) &&
+	    memcmp(titles, g_titles, titleCount * sizeof(title_source_t)) == 0)
+		return;
+
+	title_index_stop();
+
+	if (titleCount > 0)
+		memcpy(g_titles, titles, titleCount * sizeof(title_source_t));
+	g_total = titleCount;
+
+	if (seed == NULL)
+		seedCount = 0;
+	while (seeded < seedCount && seeded < titleCount && seed[seeded].titleId == titles[seeded].titleId) {
+		g_entries[seeded] = seed[seeded];
+		seeded++;
+	}
+	g_done = seeded;
+	if (seeded == titleCount)
+		return;
+
+	/* Lower priority than the UI thread: only runs while the main loop waits for VBlank. */
+	svcGetThreadPriority(&priority, CUR_THREAD_HANDLE);
+	if (priority < 0x3F)
+		priority++;
+
+	g_thread = threadCreate(index_thread_main, NULL, TITLE_INDEX_STACK_SIZE, priority, -2, false);
+}
+
+void title_index_pause(void)
+{
+	g_pause++;
+	__sync_synchronize();
+	while (g_busy)
+		svcSleepThread(TITLE_INDEX_IDLE_POLL_NS);
+}
+
+void title_index_resume(void)
+{
+	if (g_pause > 0)
+		g_pause--;
+}
+
+const title_index_entry_t *title_index_lookup(u32 position, u64 titleId)
+{
+	const title_index_entry_t *entry;
+
+	if (position >= g_done)
+		return NULL;
+
+	entry = &g_entries[position];
+	if (entry->titleId != titleId)
+		return NULL;
+
+	return entry;
+}
+
+const title_index_entry_t *title_index_entries(void)
+{
+	return g_entries;
+}
+
+u32 title_index_done_count(void)
+{
+	return g_done;
+}
+
+u32 title_index_total_count(void)
+{
+	return g_total;
+}
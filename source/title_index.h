@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_INDEX_H
+#define TITLE_INDEX_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+#include "title_picker.h"
+#include "title_smdh.h"
+
+#define TITLE_INDEX_NAME_MAX 128
+#define TITLE_INDEX_PUBLISHER_MAX 64
+
+typedef struct {
+	u64 titleId;
+	title_smdh_result_t smdh_result;
+	char name[TITLE_INDEX_NAME_MAX];
+	char publisher[TITLE_INDEX_PUBLISHER_MAX];
+	u32 region_lock;
+	u32 flags;
+} title_index_entry_t;
+
+/// Start (or restart) background SMDH indexing of titles. No-op if the list is unchanged.
+/// The list is copied; the caller may reuse its array immediately.
+void title_index_sync(const title_source_t *titles, u32 titleCount);
+
+/// Like title_index_sync, but reuses leading snapshot entries whose title IDs still line up
+/// with the list; indexing continues after the last reused entry.
+void title_index_sync_seeded(const title_source_t *titles, u32 titleCount,
+	const title_index_entry_t *seed, u32 seedCount);
+
+/// Stop and join the indexer thread (safe to call when not running).
+void title_index_stop(void);
+
+/// Pause/resume around foreground SMDH reads (nestable). Pause returns once the worker is idle,
+/// waiting out at most the one SMDH read it already started.
+void title_index_pause(void);
+void title_index_resume(void);
+
+/// Lock-free read: entry for position in the synced list, or NULL if not indexed yet
+/// or the list has since changed (titleId mismatch).
+const title_index_entry_t *title_index_lookup(u32 position, u64 titleId);
+
+/// Completed entries, title_index_done_count() of them, in list order (for the snapshot).
+const title_index_entry_t *title_index_entries(void);
+
+/// Progress for the TECHNICAL page.
+u32 title_index_done_count(void);
+u32 title_index_total_count(void);
+
+#endif
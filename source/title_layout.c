@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_layout.h"
+
+#include <3ds/util/utf.h>
+#include <string.h>
+
+u32 title_layout_codepoint_columns(u32 cp)
+{
+	if (cp < 0x20 || cp == 0x7F)
+		return cp == '\n' || cp == '\r' || cp == '\t' ? 1 : 0;
+
+	if ((cp >= 0x1100 && cp <= 0x115F) || (cp >= 0x2E80 && cp <= 0x303E) ||
+	    (cp >= 0x3041 && cp <= 0x4DBF) || (cp >= 0x4E00 && cp <= 0xA4CF) ||
+	    (cp >= 0xAC00 && cp <= 0xD7A3) || (cp >= 0xF900 && cp <= 0xFAFF) ||
+	    (cp >= 0xFE30 && cp <= 0xFE4F) || (cp >= 0xFF00 && cp <= 0xFF60) ||
+	    (cp >= 0xFFE0 && cp <= 0xFFE6))
+		return 2;
+	return 1;
+}
+
+/* Decode one code point; invalid bytes count as a single one-column character. */
+static u32 next_codepoint(const u8 *text, u32 *outCp)
+{
+	uint32_t cp;
+	ssize_t consumed = decode_utf8(&cp, text);
+
+	if (consumed <= 0) {
+		*outCp = '?';
+		return 1;
+	}
+
+	*outCp = cp;
+	return (u32)consumed;
+}
+
+u32 title_layout_columns(const char *text, size_t size)
+{
+	const u8 *in = (const u8 *)text;
+	size_t pos = 0;
+	u32 cols = 0;
+
+	while (text != NULL && pos < size && in[pos] != '\0') {
+		u32 cp;
+
+		pos += next_codepoint(in + pos, &cp);
+		cols += title_layout_codepoint_columns(cp);
+	}
+
+	return cols;
+}
+
+static bool is_space(u8 c)
+{
+	return c == ' ' || c == '\n' || c == '\r';
+}
+
+/* Lay out one line starting at start; returns where the next line starts. */
+static u32 layout_line(const u8 *text, u32 start, u32 width, title_layout_line_t *line)
+{
+	u32 pos = start;
+	u32 cols = 0;
+	/* End (exclusive) and width of the line if it breaks at the last candidate seen. */
+	u32 breakEnd = 0;
+	u32 breakCols = 0;
+	u32 breakNext = 0;
+	bool haveBreak = false;
+
+	while (text[pos] != '\0') {
+		u32 cp;
+		u32 len = next_codepoint(text + pos, &cp);
+		u32 w = title_layout_codepoint_columns(cp);
+
+		if (is_space(text[pos])) {
+			/* Breaking here drops the space, so it never has to fit. */
+			breakEnd = pos;
+			breakCols = cols;
+			breakNext = pos + len;
+			haveBreak = true;
+		} else if (cols + w > width) {
+			break;
+		}
+
+		pos += len;
+		cols += w;
+		if (text[pos - len] == ';') {
+			breakEnd = pos;
+			breakCols = cols;
+			breakNext = pos;
+			haveBreak = true;
+		}
+		if (cols >= width && !is_space(text[pos]))
+			break;
+	}
+
+	if (text[pos] == '\0' && cols <= width) {
+		breakEnd = pos;
+		breakCols = cols;
+		breakNext = pos;
+	} else if (!haveBreak || breakEnd == start) {
+		/* One word wider than the line: split it at the last code point that fits. */
+		if (pos == start) {
+			u32 cp;
+
+			pos += next_codepoint(text + pos, &cp);
+		}
+		breakEnd = pos;
+		breakCols = title_layout_columns((const char *)text + start, pos - start);
+		breakNext = pos;
+	}
+
+	line->offset = (u16)start;
+	line->length = (u16)(breakEnd - start);
+	line->columns = (u16)breakCols;
+
+	while (is_space(text[breakNext]))
+		breakNext++;
+	return breakNext;
+}
+
+const title_layout_t *title_layout_wrap(title_layout_t *layout, const char *text, u32 width)
+{
+	const u8 *in = (const u8 *)text;
+	u32 pos = 0;
+
+	if (layout == NULL)
+		return NULL;
+	if (width == 0 || layout->width == width)
+		return layout;
+
+	memset(layout, 0, sizeof(*layout));
+	layout->width = (u16)width;
+	if (text == NULL)
+		return layout;
+
+	while (in[pos] != '\0' && layout->line_count < TITLE_LAYOUT_LINES_MAX)
+		pos = layout_line(in, pos, width, &layout->lines[layout->line_count++]);
+
+	return layout;
+}
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_LAYOUT_H
+#define TITLE_LAYOUT_H
+
+#include <3ds.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Lines past this are dropped; the longest SMDH long name needs five at the narrowest width. */
+#define TITLE_LAYOUT_LINES_MAX 8
+
+typedef struct {
+	/* Byte range in the laid-out text; break spaces are excluded, a breaking ';' is kept. */
+	u16 offset;
+	u16 length;
+	u16 columns;
+} title_layout_line_t;
+
+typedef struct {
+	/* Width the breaks were computed for; 0 until the first layout. */
+	u16 width;
+	u16 line_count;
+	title_layout_line_t lines[TITLE_LAYOUT_LINES_MAX];
+} title_layout_t;
+
+/// Display columns of one code point: 2 for East Asian wide/fullwidth, 0 for control
+/// characters, else 1.
+u32 title_layout_codepoint_columns(u32 cp);
+
+/// Display columns of a UTF-8 string (newlines count as one column, like the spaces they render as).
+u32 title_layout_columns(const char *text, size_t size);
+
+/// Break text into lines of at most width columns, preferring the last space or ';' that fits and
+/// splitting words only when a single word is wider than a line. Newlines are break points too.
+/// The result is memoized in layout: a second call with the same width returns it unchanged, so
+/// the caller must reset layout->width (or zero the struct) when the text changes.
+const title_layout_t *title_layout_wrap(title_layout_t *layout, const char *text, u32 width);
+
+#endif
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_lz11.h"
+
+#include <string.h>
+
+#define LZ11_MAGIC 0x11
+
+static bool lz11_flush(title_lz11_stream_t *stream)
+{
+	u32 len = stream->produced - stream->flushed;
+	u32 start = stream->flushed & (TITLE_LZ11_WINDOW_SIZE - 1);
+
+	if (len == 0)
+		return true;
+
+	stream->flushed = stream->produced;
+	return stream->sink == NULL || stream->sink(stream->ctx, stream->window + start, len);
+}
+
+static bool lz11_emit(title_lz11_stream_t *stream, u8 value)
+{
+	stream->window[stream->produced & (TITLE_LZ11_WINDOW_SIZE - 1)] = value;
+	stream->produced++;
+
+	if (stream->produced - stream->flushed == TITLE_LZ11_FLUSH_SIZE)
+		return lz11_flush(stream);
+	return true;
+}
+
+/* Returns true once the 4- or 8-byte header is complete. */
+static bool lz11_header_done(const title_lz11_stream_t *stream)
+{
+	if (stream->header_len < 4)
+		return false;
+	/* A zero 24-bit size means the real size follows as a 32-bit word. */
+	if (stream->header[1] == 0 && stream->header[2] == 0 && stream->header[3] == 0)
+		return stream->header_len == 8;
+	return true;
+}
+
+static title_lz11_status_t lz11_read_header_byte(title_lz11_stream_t *stream, u8 value)
+{
+	stream->header[stream->header_len++] = value;
+
+	if (stream->header_len == 1 && value != LZ11_MAGIC)
+		return TITLE_LZ11_ERR_HEADER;
+
+	if (!lz11_header_done(stream))
+		return TITLE_LZ11_NEED_INPUT;
+
+	if (stream->header_len == 4) {
+		stream->out_size = (u32)stream->header[1] | ((u32)stream->header[2] << 8) |
+			((u32)stream->header[3] << 16);
+	} else {
+		stream->out_size = (u32)stream->header[4] | ((u32)stream->header[5] << 8) |
+			((u32)stream->header[6] << 16) | ((u32)stream->header[7] << 24);
+	}
+
+	return stream->out_size == 0 ? TITLE_LZ11_DONE : TITLE_LZ11_NEED_INPUT;
+}
+
+static u8 lz11_token_length(u8 first)
+{
+	switch (first >> 4) {
+	case 0:
+		return 3;
+	case 1:
+		return 4;
+	default:
+		return 2;
+	}
+}
+
+static title_lz11_status_t lz11_copy_token(title_lz11_stream_t *stream)
+{
+	const u8 *t = stream->token;
+	u32 len;
+	u32 disp;
+	u32 remaining;
+
+	switch (t[0] >> 4) {
+	case 0:
+		len = ((u32)(t[0] & 0x0F) << 4 | (t[1] >> 4)) + 0x11;
+		disp = ((u32)(t[1] & 0x0F) << 8 | t[2]) + 1;
+		break;
+	case 1:
+		len = ((u32)(t[0] & 0x0F) << 12 | (u32)t[1] << 4 | (t[2] >> 4)) + 0x111;
+		disp = ((u32)(t[2] & 0x0F) << 8 | t[3]) + 1;
+		break;
+	default:
+		len = (u32)(t[0] >> 4) + 1;
+		disp = ((u32)(t[0] & 0x0F) << 8 | t[1]) + 1;
+		break;
+	}
+
+	if (disp > stream->produced)
+		return TITLE_LZ11_ERR_DATA;
+
+	remaining = stream->out_size - stream->produced;
+	if (len > remaining)
+		len = remaining;
+
+	while (len-- > 0) {
+		u8 value = stream->window[(stream->produced - disp) & (TITLE_LZ11_WINDOW_SIZE - 1)];
+
+		if (!lz11_emit(stream, value))
+			return TITLE_LZ11_ABORTED;
+	}
+
+	return TITLE_LZ11_NEED_INPUT;
+}
+
+void title_lz11_init(title_lz11_stream_t *stream, title_lz11_sink_fn sink, void *ctx)
+{
+	if (stream == NULL)
+		return;
+
+	memset(stream, 0, offsetof(title_lz11_stream_t, window));
+	stream->sink = sink;
+	stream->ctx = ctx;
+	stream->status = TITLE_LZ11_NEED_INPUT;
+}
+
+title_lz11_status_t title_lz11_feed(title_lz11_stream_t *stream, const u8 *in, size_t size)
+{
+	size_t i = 0;
+
+	if (stream == NULL)
+		return TITLE_LZ11_ERR_HEADER;
+
+	while (stream->status == TITLE_LZ11_NEED_INPUT && i < size) {
+		u8 value = in[i++];
+		title_lz11_status_t status = TITLE_LZ11_NEED_INPUT;
+
+		if (!lz11_header_done(stream)) {
+			stream->status = lz11_read_header_byte(stream, value);
+			continue;
+		}
+
+		if (stream->flag_bits == 0) {
+			stream->flags = value;
+			stream->flag_bits = 8;
+			continue;
+		}
+
+		if ((stream->flags & 0x80) == 0) {
+			if (!lz11_emit(stream, value))
+				status = TITLE_LZ11_ABORTED;
+		} else {
+			stream->token[stream->token_len++] = value;
+			if (stream->token_len < lz11_token_length(stream->token[0]))
+				continue;
+			status = lz11_copy_token(stream);
+			stream->token_len = 0;
+		}
+
+		stream->flags <<= 1;
+		stream->flag_bits--;
+
+		if (status == TITLE_LZ11_NEED_INPUT && stream->produced >= stream->out_size)
+			status = lz11_flush(stream) ? TITLE_LZ11_DONE : TITLE_LZ11_ABORTED;
+		stream->status = status;
+	}
+
+	return stream->status;
+}
+
+u32 title_lz11_output_size(const title_lz11_stream_t *stream)
+{
+	if (stream == NULL || !lz11_header_done(stream))
+		return 0;
+
+	return stream->out_size;
+}
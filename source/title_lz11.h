@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_LZ11_H
+#define TITLE_LZ11_H
+
+#include <3ds.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* LZ11 back-references reach at most 0x1000 bytes; the ring holds two flush chunks. */
+#define TITLE_LZ11_WINDOW_SIZE 0x2000
+#define TITLE_LZ11_FLUSH_SIZE 0x1000
+
+typedef enum {
+	TITLE_LZ11_NEED_INPUT = 0,
+	TITLE_LZ11_DONE,
+	TITLE_LZ11_ERR_HEADER,
+	TITLE_LZ11_ERR_DATA,
+	TITLE_LZ11_ABORTED,
+} title_lz11_status_t;
+
+/// Receives decompressed bytes in order, in chunks of at most TITLE_LZ11_FLUSH_SIZE.
+/// Return false to abort decoding.
+typedef bool (*title_lz11_sink_fn)(void *ctx, const u8 *data, size_t size);
+
+typedef struct {
+	title_lz11_sink_fn sink;
+	void *ctx;
+	title_lz11_status_t status;
+	u32 out_size;
+	u32 produced;
+	u32 flushed;
+	u8 header[8];
+	u8 header_len;
+	u8 flags;
+	u8 flag_bits;
+	u8 token[4];
+	u8 token_len;
+	u8 window[TITLE_LZ11_WINDOW_SIZE];
+} title_lz11_stream_t;
+
+/// Reset a stream. Memory use is fixed (sizeof(title_lz11_stream_t)), independent of output size.
+void title_lz11_init(title_lz11_stream_t *stream, title_lz11_sink_fn sink, void *ctx);
+
+/// Feed the next slice of compressed input (any size, including partial tokens).
+title_lz11_status_t title_lz11_feed(title_lz11_stream_t *stream, const u8 *in, size_t size);
+
+/// Decompressed size from the LZ11 header (0 until the header has been read).
+u32 title_lz11_output_size(const title_lz11_stream_t *stream);
+
+#endif
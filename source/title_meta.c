@@ -6,12 +6,20 @@
 #include <stdio.h>
 #include <string.h>
 
+/* Bumped from the main thread and the library refresh thread. */
+static u32 g_amCallCount = 0;
+
+static void count_am_call(void)
+{
+	__atomic_fetch_add(&g_amCallCount, 1, __ATOMIC_RELAXED);
+}
+
 void title_meta_load(u64 titleId, FS_MediaType media, title_meta_t *meta)
 {
 	u32 titleHigh;
 	u32 titleLow;
-	AM_TitleEntry entry;
 
+	(void)media;
 	memset(meta, 0, sizeof(*meta));
 
 	titleHigh = (u32)(titleId >> 32);
@@ -22,44 +30,114 @@ void title_meta_load(u64 titleId, FS_MediaType media, title_meta_t *meta)
 	meta->variation = (u8)(titleLow & 0xFF);
 	meta->unique_id = (titleLow >> 8) & 0xFFFFFF;
 	meta->new3ds_only = (titleLow & 0xF0000000) == 0x20000000;
+}
+
+void title_meta_load_lazy(u64 titleId, FS_MediaType media, title_meta_t *meta)
+{
+	title_meta_lazy_t *lazy;
+
+	if (meta == NULL || meta->lazy.loaded)
+		return;
+
+	lazy = &meta->lazy;
+	lazy->loaded = true;
+
+	count_am_call();
+	lazy->product_code_result = AM_GetTitleProductCode(media, titleId, lazy->product_code);
+	if (R_FAILED(lazy->product_code_result))
+		lazy->product_code[0] = '\0';
+
+	count_am_call();
+	lazy->extdata_result = AM_GetTitleExtDataId(&lazy->extdata_id, media, titleId);
+	lazy->has_extdata = R_SUCCEEDED(lazy->extdata_result) && lazy->extdata_id != 0;
+}
 
-	meta->title_info_result = AM_GetTitleInfo(media, 1, &titleId, &entry);
-	if (R_SUCCEEDED(meta->title_info_result)) {
-		meta->installed_size = entry.size;
-		meta->version_major = (u8)((entry.version >> 8) & 0xFF);
-		meta->version_minor = (u8)(entry.version & 0xFF);
+static void store_title_info(const AM_TitleEntry *entry, Result result, u64 *size, u16 *version,
+	Result *outResult)
+{
+	*outResult = result;
+	*size = R_SUCCEEDED(result) ? entry->size : 0;
+	*version = R_SUCCEEDED(result) ? entry->version : 0;
+}
+
+u32 title_meta_fetch_info(FS_MediaType media, const u64 *titleIds, u32 count, u64 *sizes,
+	u16 *versions, Result *results)
+{
+	/* On the stack: the background rescan fetches concurrently with the UI thread. */
+	AM_TitleEntry entries[TITLE_META_INFO_BATCH];
+	u32 fetched = 0;
+	u32 base;
+	u32 i;
+
+	if (titleIds == NULL || sizes == NULL || versions == NULL || results == NULL)
+		return 0;
+
+	for (base = 0; base < count; base += TITLE_META_INFO_BATCH) {
+		u32 batch = count - base;
+		Result res;
+
+		if (batch > TITLE_META_INFO_BATCH)
+			batch = TITLE_META_INFO_BATCH;
+
+		count_am_call();
+		res = AM_GetTitleInfo(media, batch, (u64 *)(titleIds + base), entries);
+		if (R_SUCCEEDED(res)) {
+			for (i = 0; i < batch; i++)
+				store_title_info(&entries[i], res, &sizes[base + i], &versions[base + i],
+					&results[base + i]);
+			fetched += batch;
+			continue;
+		}
+
+		for (i = 0; i < batch; i++) {
+			u64 titleId = titleIds[base + i];
+
+			count_am_call();
+			res = AM_GetTitleInfo(media, 1, &titleId, &entries[0]);
+			store_title_info(&entries[0], res, &sizes[base + i], &versions[base + i],
+				&results[base + i]);
+			if (R_SUCCEEDED(res))
+				fetched++;
+		}
 	}
 
-	meta->product_code_result = AM_GetTitleProductCode(media, titleId, meta->product_code);
-	if (R_FAILED(meta->product_code_result))
-		meta->product_code[0] = '\0';
+	return fetched;
+}
+
+void title_meta_set_title_info(title_meta_t *meta, Result result, u64 installedSize, u16 version)
+{
+	if (meta == NULL)
+		return;
+
+	meta->title_info_result = result;
+	meta->installed_size = R_SUCCEEDED(result) ? installedSize : 0;
+	meta->version_major = R_SUCCEEDED(result) ? (u8)((version >> 8) & 0xFF) : 0;
+	meta->version_minor = R_SUCCEEDED(result) ? (u8)(version & 0xFF) : 0;
+}
 
-	meta->extdata_result = AM_GetTitleExtDataId(&meta->extdata_id, media, titleId);
-	meta->has_extdata = R_SUCCEEDED(meta->extdata_result) && meta->extdata_id != 0;
+u32 title_meta_am_call_count(void)
+{
+	return __atomic_load_n(&g_amCallCount, __ATOMIC_RELAXED);
 }
 
+#define TITLE_META_NAME_ENTRY(code, name, cls) [code] = name,
+#define TITLE_META_CLASS_ENTRY(code, name, cls) [code] = (u16)(cls),
+
+static const char *const s_category_names[256] = {
+	TITLE_META_CATEGORIES(TITLE_META_NAME_ENTRY)
+};
+
+/* Zero entries are categories missing from the list; they read as TITLE_CLASS_OTHER. */
+static const u16 s_category_classes[256] = {
+	TITLE_META_CATEGORIES(TITLE_META_CLASS_ENTRY)
+};
+
 const char *title_meta_category_name(u16 contentCategory)
 {
-	switch (contentCategory) {
-	case 0x0000: return "Application";
-	case 0x0001: return "Download Play child";
-	case 0x0002: return "Demo";
-	case 0x0003: return "Content pack";
-	case 0x0004: return "DSiWare app";
-	case 0x0005: return "System application";
-	case 0x0006: return "System applet";
-	case 0x0007: return "Instruction manual";
-	case 0x0008: return "System data";
-	case 0x0009: return "System tool";
-	case 0x000A: return "Download Play parent";
-	case 0x000B: return "DSiWare patch";
-	case 0x000C: return "DSiWare demo";
-	case 0x000D: return "DSiWare content";
-	case 0x000E: return "Patch / update";
-	case 0x000F: return "Certificate store";
-	case 0x008C: return "DLC";
-	default: return "Unknown";
-	}
+	if ((contentCategory >> 8) != 0 || s_category_names[contentCategory] == NULL)
+		return "Unknown";
+
+	return s_category_names[contentCategory];
 }
 
 const char *title_meta_platform_name(u16 platform)
@@ -100,64 +178,66 @@ u16 title_meta_decode_category(u64 titleId)
 	return (u16)(((u32)(titleId >> 32)) & 0xFFFF);
 }
 
-bool title_meta_is_patch(u16 category)
+u32 title_meta_category_class(u16 category)
 {
-	return category == 0x000E || category == 0x000B;
-}
+	u32 cls;
 
-bool title_meta_is_dlc(u16 category)
-{
-	return category == 0x008C;
-}
+	if ((category >> 8) != 0)
+		return TITLE_CLASS_OTHER;
 
-bool title_meta_is_system(u16 category)
-{
-	return category >= 0x0005 && category <= 0x0009;
+	cls = s_category_classes[category];
+	return cls != 0 ? cls : TITLE_CLASS_OTHER;
 }
 
-bool title_meta_is_demo(u16 category)
+u32 title_meta_class_index(u32 cls)
 {
-	return category == 0x0002 || category == 0x000C;
+	u32 index = 0;
+
+	while (index + 1 < TITLE_CLASS_COUNT && (cls & (1u << index)) == 0)
+		index++;
+
+	return index;
 }
 
-bool title_meta_is_dsiware(u16 category)
+const char *title_meta_class_name(u32 cls)
 {
-	return category == 0x0004 || category == 0x000D;
+	switch (cls) {
+	case TITLE_CLASS_APPLICATION: return "Applications";
+	case TITLE_CLASS_PATCH: return "Patches";
+	case TITLE_CLASS_DLC: return "DLC";
+	case TITLE_CLASS_SYSTEM: return "System";
+	case TITLE_CLASS_DEMO: return "Demos";
+	case TITLE_CLASS_DSIWARE: return "DSiWare";
+	case TITLE_CLASS_CONTENT_PACK: return "Content packs";
+	case TITLE_CLASS_HIDDEN: return "Hidden";
+	default: return "Other";
+	}
 }
 
-bool title_meta_is_content_pack(u16 category)
+u32 title_meta_compile_filter_mask(const title_filter_options_t *filters)
 {
-	return category == 0x0003;
+	u32 mask = TITLE_CLASS_OTHER | TITLE_CLASS_APPLICATION;
+
+	if (filters == NULL)
+		return 0;
+
+	if (filters->include_patches)
+		mask |= TITLE_CLASS_PATCH;
+	if (filters->include_dlc)
+		mask |= TITLE_CLASS_DLC;
+	if (filters->include_system)
+		mask |= TITLE_CLASS_SYSTEM;
+	if (filters->include_demos)
+		mask |= TITLE_CLASS_DEMO;
+	if (filters->include_dsiware)
+		mask |= TITLE_CLASS_DSIWARE;
+	if (filters->include_content_packs)
+		mask |= TITLE_CLASS_CONTENT_PACK;
+
+	return mask;
 }
 
 bool title_meta_passes_filters(u16 category, const title_filter_options_t *filters)
 {
-	if (filters == NULL)
-		return false;
-
-	if (title_meta_is_patch(category))
-		return filters->include_patches;
-
-	if (title_meta_is_dlc(category))
-		return filters->include_dlc;
-
-	if (title_meta_is_system(category))
-		return filters->include_system;
-
-	if (category == 0x0001 || category == 0x000A)
-		return false;
-
-	if (category == 0x000F)
-		return false;
-
-	if (title_meta_is_demo(category))
-		return filters->include_demos;
-
-	if (title_meta_is_dsiware(category))
-		return filters->include_dsiware;
-
-	if (title_meta_is_content_pack(category))
-		return filters->include_content_packs;
-
-	return true;
+	return (title_meta_category_class(category) & title_meta_compile_filter_mask(filters)) != 0;
 }
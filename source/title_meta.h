@@ -17,26 +17,92 @@ typedef struct {
 	bool include_virtual_console;
 } title_filter_options_t;
 
+/*
+ * Authoritative content-category list: X(code, name, filter class). It is expanded into
+ * the category name table and the 256-entry class table in title_meta.c, so names and
+ * filtering cannot drift apart. All known categories have a zero high byte.
+ */
+#define TITLE_META_CATEGORIES(X) \
+	X(0x0000, "Application", TITLE_CLASS_APPLICATION) \
+	X(0x0001, "Download Play child", TITLE_CLASS_HIDDEN) \
+	X(0x0002, "Demo", TITLE_CLASS_DEMO) \
+	X(0x0003, "Content pack", TITLE_CLASS_CONTENT_PACK) \
+	X(0x0004, "DSiWare app", TITLE_CLASS_DSIWARE) \
+	X(0x0005, "System application", TITLE_CLASS_SYSTEM) \
+	X(0x0006, "System applet", TITLE_CLASS_SYSTEM) \
+	X(0x0007, "Instruction manual", TITLE_CLASS_SYSTEM) \
+	X(0x0008, "System data", TITLE_CLASS_SYSTEM) \
+	X(0x0009, "System tool", TITLE_CLASS_SYSTEM) \
+	X(0x000A, "Download Play parent", TITLE_CLASS_HIDDEN) \
+	X(0x000B, "DSiWare patch", TITLE_CLASS_PATCH) \
+	X(0x000C, "DSiWare demo", TITLE_CLASS_DEMO) \
+	X(0x000D, "DSiWare content", TITLE_CLASS_DSIWARE) \
+	X(0x000E, "Patch / update", TITLE_CLASS_PATCH) \
+	X(0x000F, "Certificate store", TITLE_CLASS_HIDDEN) \
+	X(0x008C, "DLC", TITLE_CLASS_DLC)
+
+/* One bit per filter class; unlisted categories are TITLE_CLASS_OTHER. */
+typedef enum {
+	TITLE_CLASS_OTHER = 1 << 0,
+	TITLE_CLASS_APPLICATION = 1 << 1,
+	TITLE_CLASS_PATCH = 1 << 2,
+	TITLE_CLASS_DLC = 1 << 3,
+	TITLE_CLASS_SYSTEM = 1 << 4,
+	TITLE_CLASS_DEMO = 1 << 5,
+	TITLE_CLASS_DSIWARE = 1 << 6,
+	TITLE_CLASS_CONTENT_PACK = 1 << 7,
+	/* Never pickable (Download Play, certificate store); no filter enables it. */
+	TITLE_CLASS_HIDDEN = 1 << 8,
+} title_class_t;
+
+#define TITLE_CLASS_COUNT 9
+
+/* Per-title AM queries only the TECHNICAL page shows; fetched once, on first display. */
+typedef struct {
+	bool loaded;
+	char product_code[17];
+	u64 extdata_id;
+	bool has_extdata;
+	Result product_code_result;
+	Result extdata_result;
+} title_meta_lazy_t;
+
 typedef struct {
+	/* Eager: decoded from the title ID and copied from the scan-time title info table. */
 	u16 platform;
 	u16 content_category;
 	u8 variation;
 	u32 unique_id;
 	bool new3ds_only;
-	char product_code[17];
 	u8 version_major;
 	u8 version_minor;
 	u64 installed_size;
-	u64 extdata_id;
-	bool has_extdata;
 	Result title_info_result;
-	Result product_code_result;
-	Result extdata_result;
+	title_meta_lazy_t lazy;
 } title_meta_t;
 
-/// Fill metadata derived from title ID and AM services.
+/* AM_GetTitleInfo accepts an ID array; the scan fetches the library in batches of this size. */
+#define TITLE_META_INFO_BATCH 128
+
+/// Fill the eager metadata derived from the title ID. No IPC.
+/// Installed size and version come from the scan-time table; see title_meta_set_title_info.
 void title_meta_load(u64 titleId, FS_MediaType media, title_meta_t *meta);
 
+/// Fetch product code and extdata ID (two AM calls) the first time; later calls are free.
+void title_meta_load_lazy(u64 titleId, FS_MediaType media, title_meta_t *meta);
+
+/// Fetch installed size and version for every title in batched AM_GetTitleInfo calls.
+/// Output arrays are parallel to titleIds. A failed batch is retried one title at a time
+/// so a single bad entry only marks itself. Returns the number of titles fetched.
+u32 title_meta_fetch_info(FS_MediaType media, const u64 *titleIds, u32 count, u64 *sizes,
+	u16 *versions, Result *results);
+
+/// Copy one scan-table row into a pick's metadata.
+void title_meta_set_title_info(title_meta_t *meta, Result result, u64 installedSize, u16 version);
+
+/// AM IPC calls issued by this module since boot (scan batches and per-pick lookups).
+u32 title_meta_am_call_count(void);
+
 const char *title_meta_category_name(u16 contentCategory);
 const char *title_meta_platform_name(u16 platform);
 
@@ -45,12 +111,17 @@ void title_meta_format_version(u8 major, u8 minor, char *buf, size_t bufSize);
 
 u16 title_meta_decode_category(u64 titleId);
 
-bool title_meta_is_patch(u16 category);
-bool title_meta_is_dlc(u16 category);
-bool title_meta_is_system(u16 category);
-bool title_meta_is_demo(u16 category);
-bool title_meta_is_dsiware(u16 category);
-bool title_meta_is_content_pack(u16 category);
+/// Filter class bit for a content category (one table load).
+u32 title_meta_category_class(u16 category);
+
+/// Bit position of a single class bit (0..TITLE_CLASS_COUNT-1), for per-class arrays.
+u32 title_meta_class_index(u32 cls);
+
+/// Short display name for a single class bit ("Patches", "DLC", ...).
+const char *title_meta_class_name(u32 cls);
+
+/// Fold filter options into a class mask; a category passes when its class bit is set.
+u32 title_meta_compile_filter_mask(const title_filter_options_t *filters);
 
 bool title_meta_passes_filters(u16 category, const title_filter_options_t *filters);
 
@@ -10,41 +10,46 @@
 #include "title_database.h"
 #include "title_smdh.h"
 
-bool title_picker_is_eligible(u64 titleId, const title_filter_options_t *filters, bool include_homebrew)
+bool title_picker_traits_eligible(u32 cls, bool isVc, bool inCatalog, u32 classMask,
+	const title_filter_options_t *filters, bool include_homebrew)
 {
-	u16 category;
-	bool inCatalog;
-
-	if (filters == NULL)
-		return false;
-
-	category = title_meta_decode_category(titleId);
-	if (!title_meta_passes_filters(category, filters))
+	if ((cls & classMask) == 0)
 		return false;
 
-	if (category == 0x0000) {
-		bool isVc = title_database_is_virtual_console(titleId);
-
+	if (cls == TITLE_CLASS_APPLICATION) {
 		if (isVc && !filters->include_virtual_console)
 			return false;
 		if (!isVc && !filters->include_native_apps)
 			return false;
 	}
 
-	inCatalog = title_database_contains(titleId);
-	if (include_homebrew) {
-		if (inCatalog)
-			return false;
-	} else if (!inCatalog) {
+	/* Unlisted-only keeps exactly the titles the catalog does not know. */
+	return include_homebrew ? !inCatalog : inCatalog;
+}
+
+static bool is_eligible_masked(u64 titleId, u32 classMask, const title_filter_options_t *filters,
+	bool include_homebrew)
+{
+	u32 cls = title_meta_category_class(title_meta_decode_category(titleId));
+
+	/* The VC table is only consulted for applications, the only class it splits. */
+	return title_picker_traits_eligible(cls,
+		cls == TITLE_CLASS_APPLICATION && title_database_is_virtual_console(titleId),
+		title_database_contains(titleId), classMask, filters, include_homebrew);
+}
+
+bool title_picker_is_eligible(u64 titleId, const title_filter_options_t *filters, bool include_homebrew)
+{
+	if (filters == NULL)
 		return false;
-	}
 
-	return true;
+	return is_eligible_masked(titleId, title_meta_compile_filter_mask(filters), filters, include_homebrew);
 }
 
 void title_picker_rebuild_pool(title_picker_pool_t *pool, const title_source_t *titles, u32 titleCount,
 	const title_filter_options_t *filters, bool include_homebrew)
 {
+	u32 classMask;
 	u32 i;
 
 	if (pool == NULL)
@@ -55,8 +60,9 @@ void title_picker_rebuild_pool(title_picker_pool_t *pool, const title_source_t *
 	if (titles == NULL || titleCount == 0 || filters == NULL)
 		return;
 
+	classMask = title_meta_compile_filter_mask(filters);
 	for (i = 0; i < titleCount && pool->count < TITLE_PICKER_POOL_MAX; i++) {
-		if (title_picker_is_eligible(titles[i].titleId, filters, include_homebrew))
+		if (is_eligible_masked(titles[i].titleId, classMask, filters, include_homebrew))
 			pool->indices[pool->count++] = i;
 	}
 }
@@ -88,8 +94,8 @@ bool title_picker_pick_random(const title_picker_pool_t *pool, const title_sourc
 void title_picker_resolve_display_name(u64 titleId, const title_smdh_info_t *smdh, const char *catalogName,
 	bool prefer_long_name, char *out, size_t outSize, title_name_source_t *outSource)
 {
-	const char *primary;
-	const char *fallback;
+	title_smdh_field_t primary;
+	title_smdh_field_t fallback;
 
 	if (out == NULL || outSize == 0)
 		return;
@@ -100,28 +106,18 @@ void title_picker_resolve_display_name(u64 titleId, const title_smdh_info_t *smd
 
 	if (smdh != NULL && smdh->result == TITLE_SMDH_OK) {
 		if (prefer_long_name) {
-			primary = smdh->long_name;
-			fallback = smdh->short_name;
+			primary = TITLE_SMDH_FIELD_LONG_NAME;
+			fallback = TITLE_SMDH_FIELD_SHORT_NAME;
 		} else {
-			primary = smdh->short_name;
-			fallback = smdh->long_name;
-		}
-
-		if (primary[0] != '\0') {
-			strncpy(out, primary, outSize - 1);
-			out[outSize - 1] = '\0';
-			if (outSource != NULL)
-				*outSource = TITLE_NAME_SOURCE_SMDH;
-			title_text_sanitize_utf8_for_console(out, outSize);
-			return;
+			primary = TITLE_SMDH_FIELD_SHORT_NAME;
+			fallback = TITLE_SMDH_FIELD_LONG_NAME;
 		}
 
-		if (fallback[0] != '\0') {
-			strncpy(out, fallback, outSize - 1);
-			out[outSize - 1] = '\0';
+		/* Only the preferred name is decoded unless it turns out empty. */
+		if (title_smdh_field(smdh, primary, out, outSize)[0] != '\0' ||
+		    title_smdh_field(smdh, fallback, out, outSize)[0] != '\0') {
 			if (outSource != NULL)
 				*outSource = TITLE_NAME_SOURCE_SMDH;
-			title_text_sanitize_utf8_for_console(out, outSize);
 			return;
 		}
 	}
@@ -154,7 +150,7 @@ void title_picker_load_pick(u64 titleId, FS_MediaType media, bool include_homebr
 	pick->catalog_name = lookup_game_name(titleId);
 	pick->is_homebrew = !title_database_contains(titleId);
 
-	title_smdh_load(titleId, media, &pick->smdh);
+	title_smdh_load(titleId, media, &pick->smdh, &pick->icon);
 	title_meta_load(titleId, media, &pick->meta);
 
 	title_picker_resolve_display_name(titleId, &pick->smdh, pick->catalog_name, prefer_long_name,
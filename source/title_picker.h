@@ -8,6 +8,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "title_layout.h"
 #include "title_meta.h"
 #include "title_smdh.h"
 
@@ -38,9 +39,18 @@ typedef struct {
 	const char *catalog_name;
 	bool is_homebrew;
 	title_smdh_info_t smdh;
+	title_smdh_icon_t icon;
 	title_meta_t meta;
+	/* Line breaks of display_name and the SMDH long name, memoized on first display. */
+	title_layout_t name_layout;
+	title_layout_t long_name_layout;
 } title_pick_t;
 
+/// Eligibility from a title's traits: its filter class, whether it is Virtual Console, and whether
+/// the catalog lists it. classMask comes from title_meta_compile_filter_mask(filters).
+bool title_picker_traits_eligible(u32 cls, bool isVc, bool inCatalog, u32 classMask,
+	const title_filter_options_t *filters, bool include_homebrew);
+
 bool title_picker_is_eligible(u64 titleId, const title_filter_options_t *filters, bool include_homebrew);
 
 void title_picker_rebuild_pool(title_picker_pool_t *pool, const title_source_t *titles, u32 titleCount,
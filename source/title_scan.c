@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_scan.h"
+
+#include <string.h>
+
+#include "title_meta.h"
+
+#define TITLE_SCAN_STACK_SIZE (16 * 1024)
+#define FNV64_OFFSET 0xCBF29CE484222325ULL
+#define FNV64_PRIME 0x100000001B3ULL
+
+/* Written only by the refresh thread until g_refreshState leaves RUNNING. */
+static title_scan_t g_refreshSd;
+static title_scan_t g_refreshNand;
+static u64 g_expectSdHash = 0;
+static u64 g_expectNandHash = 0;
+static bool g_refreshSdEnabled = false;
+static bool g_refreshNandEnabled = false;
+static volatile title_scan_refresh_t g_refreshState = TITLE_SCAN_REFRESH_IDLE;
+static Thread g_refreshThread = NULL;
+
+/* Workers only run while the UI thread waits (VBlank, joins), like the SMDH indexer. */
+static s32 worker_priority(void)
+{
+	s32 priority = 0x30;
+
+	svcGetThreadPriority(&priority, CUR_THREAD_HANDLE);
+	if (priority < 0x3F)
+		priority++;
+	return priority;
+}
+
+/* job may be NULL; otherwise its progress is updated after the list and after each info batch. */
+static Result scan_media_tracked(title_scan_t *scan, FS_MediaType media, title_scan_job_t *job)
+{
+	u32 count = 0;
+	u32 base;
+	Result res;
+
+	if (scan == NULL)
+		return -1;
+
+	scan->count = 0;
+	res = AM_GetTitleList(&count, media, TITLE_SCAN_MAX, scan->titles);
+	if (R_FAILED(res))
+		return res;
+
+	scan->count = count;
+	if (job != NULL)
+		job->stage = TITLE_SCAN_JOB_INFO;
+
+	for (base = 0; base < count; base += TITLE_META_INFO_BATCH) {
+		u32 batch = count - base;
+
+		if (batch > TITLE_META_INFO_BATCH)
+			batch = TITLE_META_INFO_BATCH;
+
+		title_meta_fetch_info(media, scan->titles + base, batch, scan->sizes + base,
+			scan->versions + base, scan->info_results + base);
+		if (job != NULL)
+			job->info_done = base + batch;
+	}
+
+	return res;
+}
+
+Result title_scan_media(title_scan_t *scan, FS_MediaType media)
+{
+	return scan_media_tracked(scan, media, NULL);
+}
+
+static void scan_job_main(void *arg)
+{
+	title_scan_job_t *job = (title_scan_job_t *)arg;
+
+	job->result = scan_media_tracked(job->scan, job->media, job);
+	__sync_synchronize();
+	job->stage = TITLE_SCAN_JOB_DONE;
+}
+
+void title_scan_job_start(title_scan_job_t *job, title_scan_t *scan, FS_MediaType media)
+{
+	if (job == NULL)
+		return;
+
+	memset(job, 0, sizeof(*job));
+	job->scan = scan;
+	job->media = media;
+	job->stage = TITLE_SCAN_JOB_LISTING;
+
+	job->thread = threadCreate(scan_job_main, job, TITLE_SCAN_STACK_SIZE, worker_priority(), -2, false);
+	if (job->thread == NULL)
+		scan_job_main(job);
+}
+
+bool title_scan_job_done(const title_scan_job_t *job)
+{
+	return job == NULL || job->stage == TITLE_SCAN_JOB_DONE;
+}
+
+Result title_scan_job_finish(title_scan_job_t *job)
+{
+	if (job == NULL)
+		return -1;
+
+	if (job->thread != NULL) {
+		threadJoin(job->thread, U64_MAX);
+		threadFree(job->thread);
+		job->thread = NULL;
+	}
+
+	return job->result;
+}
+
+u64 title_scan_hash(const title_scan_t *scan)
+{
+	u64 hash = FNV64_OFFSET;
+	u32 i;
+	u32 b;
+
+	if (scan == NULL)
+		return hash;
+
+	for (i = 0; i < scan->count; i++) {
+		for (b = 0; b < 8; b++) {
+			hash ^= (scan->titles[i] >> (b * 8)) & 0xFF;
+			hash *= FNV64_PRIME;
+		}
+	}
+
+	return hash;
+}
+
+static void refresh_thread_main(void *arg)
+{
+	bool changed;
+	bool failed;
+
+	(void)arg;
+
+	/* A transient AM failure leaves an empty list whose hash differs; never report that as a change. */
+	changed = false;
+	failed = false;
+	if (g_refreshSdEnabled) {
+		failed = R_FAILED(title_scan_media(&g_refreshSd, MEDIATYPE_SD));
+		changed = title_scan_hash(&g_refreshSd) != g_expectSdHash;
+	}
+	if (g_refreshNandEnabled && !failed) {
+		failed = R_FAILED(title_scan_media(&g_refreshNand, MEDIATYPE_NAND));
+		changed = changed || title_scan_hash(&g_refreshNand) != g_expectNandHash;
+	}
+	__sync_synchronize();
+	if (failed)
+		g_refreshState = TITLE_SCAN_REFRESH_FAILED;
+	else
+		g_refreshState = changed ? TITLE_SCAN_REFRESH_CHANGED : TITLE_SCAN_REFRESH_UNCHANGED;
+}
+
+void title_scan_refresh_stop(void)
+{
+	if (g_refreshThread == NULL)
+		return;
+
+	threadJoin(g_refreshThread, U64_MAX);
+	threadFree(g_refreshThread);
+	g_refreshThread = NULL;
+}
+
+void title_scan_refresh_start(const title_scan_t *sd, const title_scan_t *nand)
+{
+	title_scan_refresh_stop();
+
+	g_refreshSdEnabled = sd != NULL;
+	g_refreshNandEnabled = nand != NULL;
+	g_expectSdHash = title_scan_hash(sd);
+	g_expectNandHash = title_scan_hash(nand);
+	g_refreshState = TITLE_SCAN_REFRESH_RUNNING;
+
+	g_refreshThread = threadCreate(refresh_thread_main, NULL, TITLE_SCAN_STACK_SIZE, worker_priority(), -2,
+		false);
+	if (g_refreshThread == NULL)
+		g_refreshState = TITLE_SCAN_REFRESH_IDLE;
+}
+
+title_scan_refresh_t title_scan_refresh_poll(void)
+{
+	return g_refreshState;
+}
+
+void title_scan_refresh_take(title_scan_t *sd, title_scan_t *nand)
+{
+	if (g_refreshState != TITLE_SCAN_REFRESH_CHANGED)
+		return;
+
+	title_scan_refresh_stop();
+	if (sd != NULL && g_refreshSdEnabled)
+		memcpy(sd, &g_refreshSd, sizeof(*sd));
+	if (nand != NULL && g_refreshNandEnabled)
+		memcpy(nand, &g_refreshNand, sizeof(*nand));
+	g_refreshState = TITLE_SCAN_REFRESH_IDLE;
+}
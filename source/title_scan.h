@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_SCAN_H
+#define TITLE_SCAN_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+#include "title_picker.h"
+
+/* One media's installed titles with their scan-time title info, struct-of-arrays. */
+typedef struct {
+	u32 count;
+	u64 titles[TITLE_SCAN_MAX];
+	u64 sizes[TITLE_SCAN_MAX];
+	u16 versions[TITLE_SCAN_MAX];
+	Result info_results[TITLE_SCAN_MAX];
+} title_scan_t;
+
+typedef enum {
+	TITLE_SCAN_JOB_LISTING = 0,
+	TITLE_SCAN_JOB_INFO,
+	TITLE_SCAN_JOB_DONE,
+} title_scan_job_stage_t;
+
+/* One media scanned on its own worker thread; progress fields are written by the worker. */
+typedef struct {
+	title_scan_t *scan;
+	FS_MediaType media;
+	Thread thread;
+	Result result;
+	volatile title_scan_job_stage_t stage;
+	/* Titles whose title info has been fetched so far (of scan->count, valid from TITLE_SCAN_JOB_INFO). */
+	volatile u32 info_done;
+} title_scan_job_t;
+
+typedef enum {
+	TITLE_SCAN_REFRESH_IDLE = 0,
+	TITLE_SCAN_REFRESH_RUNNING,
+	TITLE_SCAN_REFRESH_UNCHANGED,
+	TITLE_SCAN_REFRESH_CHANGED,
+	/* An AM list call failed; the rescan says nothing about the library and take ignores it. */
+	TITLE_SCAN_REFRESH_FAILED,
+} title_scan_refresh_t;
+
+/// AM_GetTitleList plus batched title info for one media. On failure the scan is left empty.
+Result title_scan_media(title_scan_t *scan, FS_MediaType media);
+
+/// Start title_scan_media for one media on a worker thread (runs inline if no thread is available).
+void title_scan_job_start(title_scan_job_t *job, title_scan_t *scan, FS_MediaType media);
+
+bool title_scan_job_done(const title_scan_job_t *job);
+
+/// Join the worker and return the scan result. The job's list is complete afterwards.
+Result title_scan_job_finish(title_scan_job_t *job);
+
+/// FNV-1a hash of the title ID list, for cheap snapshot validation.
+u64 title_scan_hash(const title_scan_t *scan);
+
+/// Rescan SD and NAND on a background thread and compare against the given lists.
+/// A NULL list is skipped (media not scanned yet) and left untouched by take.
+void title_scan_refresh_start(const title_scan_t *sd, const title_scan_t *nand);
+
+/// Poll the background rescan. Once it reports CHANGED, copy the new lists with
+/// title_scan_refresh_take; UNCHANGED and FAILED end the refresh with the lists kept.
+title_scan_refresh_t title_scan_refresh_poll(void);
+
+void title_scan_refresh_take(title_scan_t *sd, title_scan_t *nand);
+
+/// Join the refresh thread (no-op when none is running).
+void title_scan_refresh_stop(void);
+
+#endif
@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_search.h"
+
+#include <string.h>
+
+static char fold_char(char c)
+{
+	return c >= 'A' && c <= 'Z' ? (char)(c - 'A' + 'a') : c;
+}
+
+/* a-z, 0-9, then a few buckets; bit 63 collects everything else (including UTF-8 bytes). */
+static u32 char_bit(char c)
+{
+	if (c >= 'a' && c <= 'z')
+		return (u32)(c - 'a');
+	if (c >= '0' && c <= '9')
+		return 26 + (u32)(c - '0');
+	if (c == ' ')
+		return 36;
+	return 63;
+}
+
+static u64 mask_of(const char *text, u32 length)
+{
+	u64 mask = 0;
+	u32 i;
+
+	for (i = 0; i < length; i++)
+		mask |= 1ULL << char_bit(text[i]);
+	return mask;
+}
+
+static bool text_contains(const char *text, u32 length, const char *needle, u32 needleLength)
+{
+	u32 i;
+
+	if (needleLength == 0)
+		return true;
+
+	for (i = 0; i + needleLength <= length; i++) {
+		if (text[i] == needle[0] && memcmp(text + i + 1, needle + 1, needleLength - 1) == 0)
+			return true;
+	}
+	return false;
+}
+
+/* Does the entry contain the first `length` query characters (whose mask is needMask)? */
+static bool entry_matches(title_search_t *search, u32 index, u32 length, u64 needMask)
+{
+	if ((search->char_mask[index] & needMask) != needMask)
+		return false;
+	/* One letter, digit or space: the mask alone decides. */
+	if (length == 1 && char_bit(search->query[0]) != 63)
+		return true;
+
+	search->compare_count++;
+	return text_contains(search->text + search->text_offset[index], search->text_length[index],
+		search->query, length);
+}
+
+/* Longest query prefix the entry contains, searching upward from `from` (known to match). */
+static u8 entry_depth(title_search_t *search, u32 index, u32 from)
+{
+	u32 depth = from;
+
+	while (depth < search->query_length &&
+	       entry_matches(search, index, depth + 1, mask_of(search->query, depth + 1)))
+		depth++;
+	return (u8)depth;
+}
+
+static void index_name(title_search_t *search, u32 index, const char *name)
+{
+	u32 length = name != NULL ? (u32)strlen(name) : 0;
+	u32 i;
+
+	if (length > 0xFFFF)
+		length = 0xFFFF;
+	if (search->text_used + length > TITLE_SEARCH_TEXT_MAX)
+		length = 0;
+
+	search->text_offset[index] = search->text_used;
+	search->text_length[index] = (u16)length;
+	for (i = 0; i < length; i++)
+		search->text[search->text_used + i] = fold_char(name[i]);
+	search->text_used += length;
+	search->char_mask[index] = mask_of(search->text + search->text_offset[index], length);
+}
+
+void title_search_reset(title_search_t *search)
+{
+	if (search == NULL)
+		return;
+
+	search->count = 0;
+	search->text_used = 0;
+	search->query[0] = '\0';
+	search->query_length = 0;
+	search->result_count = 0;
+	search->compare_count = 0;
+}
+
+s32 title_search_add(title_search_t *search, const char *name)
+{
+	u32 index;
+
+	if (search == NULL || search->count >= TITLE_SEARCH_MAX)
+		return -1;
+
+	index = search->count++;
+	index_name(search, index, name);
+	search->depth[index] = entry_depth(search, index, 0);
+	if (search->depth[index] == search->query_length)
+		search->results[search->result_count++] = (u16)index;
+	return (s32)index;
+}
+
+void title_search_set_name(title_search_t *search, u32 index, const char *name)
+{
+	bool wasResult;
+	bool isResult;
+	u32 pos = 0;
+
+	if (search == NULL || index >= search->count)
+		return;
+
+	/* The old text stays in the arena until the next reset. */
+	wasResult = search->depth[index] == search->query_length;
+	index_name(search, index, name);
+	search->depth[index] = entry_depth(search, index, 0);
+	isResult = search->depth[index] == search->query_length;
+	if (wasResult == isResult)
+		return;
+
+	while (pos < search->result_count && search->results[pos] < index)
+		pos++;
+	if (isResult) {
+		memmove(&search->results[pos + 1], &search->results[pos],
+			(search->result_count - pos) * sizeof(search->results[0]));
+		search->results[pos] = (u16)index;
+		search->result_count++;
+	} else {
+		memmove(&search->results[pos], &search->results[pos + 1],
+			(search->result_count - pos - 1) * sizeof(search->results[0]));
+		search->result_count--;
+	}
+}
+
+void title_search_push(title_search_t *search, char c)
+{
+	u64 needMask;
+	u32 kept = 0;
+	u32 i;
+
+	if (search == NULL || search->query_length >= TITLE_SEARCH_QUERY_MAX)
+		return;
+
+	search->query[search->query_length++] = fold_char(c);
+	search->query[search->query_length] = '\0';
+	needMask = mask_of(search->query, search->query_length);
+
+	/* Only entries that matched the old query can match the longer one. */
+	for (i = 0; i < search->result_count; i++) {
+		u16 index = search->results[i];
+
+		if (entry_matches(search, index, search->query_length, needMask)) {
+			search->depth[index] = (u8)search->query_length;
+			search->results[kept++] = index;
+		}
+	}
+	search->result_count = kept;
+}
+
+void title_search_pop(title_search_t *search)
+{
+	u32 i;
+
+	if (search == NULL || search->query_length == 0)
+		return;
+
+	search->query[--search->query_length] = '\0';
+
+	/* Depths beyond the new length are clamped; everything at the new length matches again. */
+	search->result_count = 0;
+	for (i = 0; i < search->count; i++) {
+		if (search->depth[i] > search->query_length)
+			search->depth[i] = (u8)search->query_length;
+		if (search->depth[i] == search->query_length)
+			search->results[search->result_count++] = (u16)i;
+	}
+}
+
+void title_search_set_query(title_search_t *search, const char *query)
+{
+	u32 common = 0;
+
+	if (search == NULL || query == NULL)
+		return;
+
+	while (common < search->query_length && query[common] != '\0' &&
+	       fold_char(query[common]) == search->query[common])
+		common++;
+	while (search->query_length > common)
+		title_search_pop(search);
+	while (query[search->query_length] != '\0' && search->query_length < TITLE_SEARCH_QUERY_MAX)
+		title_search_push(search, query[search->query_length]);
+}
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_SEARCH_H
+#define TITLE_SEARCH_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+#include "title_picker.h"
+
+#ifndef TITLE_SEARCH_MAX
+#define TITLE_SEARCH_MAX TITLE_PICKER_POOL_MAX
+#endif
+/* Folded (lowercased) name bytes for all entries; names past this are indexed empty. */
+#ifndef TITLE_SEARCH_TEXT_MAX
+#define TITLE_SEARCH_TEXT_MAX (TITLE_SEARCH_MAX * 48)
+#endif
+#define TITLE_SEARCH_QUERY_MAX 24
+
+/*
+ * Substring search over a fixed list of names. Each entry keeps a bitmask of the characters it
+ * contains, so most non-matches are rejected without touching their text, and the length of
+ * the longest query prefix it matches, so typing a character only re-tests the current
+ * results and deleting one re-collects results from those depths without matching any text.
+ */
+typedef struct {
+	u32 text_offset[TITLE_SEARCH_MAX];
+	u16 text_length[TITLE_SEARCH_MAX];
+	u64 char_mask[TITLE_SEARCH_MAX];
+	u8 depth[TITLE_SEARCH_MAX];
+	u32 count;
+	char text[TITLE_SEARCH_TEXT_MAX];
+	u32 text_used;
+
+	char query[TITLE_SEARCH_QUERY_MAX + 1];
+	u32 query_length;
+	/* Entries matching the whole query, in entry order. */
+	u16 results[TITLE_SEARCH_MAX];
+	u32 result_count;
+	/* Name comparisons since the last reset (for benchmarks). */
+	u32 compare_count;
+} title_search_t;
+
+/// Empty index and query.
+void title_search_reset(title_search_t *search);
+
+/// Append an entry (NULL or "" if its name is not known yet); returns its index, or -1 if full.
+s32 title_search_add(title_search_t *search, const char *name);
+
+/// A name became known (or changed): re-index the entry and re-test it against the query.
+void title_search_set_name(title_search_t *search, u32 index, const char *name);
+
+/// Type one character (ASCII, matched case-insensitively). Only the current results are re-tested.
+void title_search_push(title_search_t *search, char c);
+
+/// Delete the last query character. No text is compared.
+void title_search_pop(title_search_t *search);
+
+/// Replace the query (push/pop from the common prefix).
+void title_search_set_query(title_search_t *search, const char *query);
+
+#endif
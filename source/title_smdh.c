@@ -8,6 +8,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "title_text_table.h"
+
 /* ExeFS icon is always 0x36C0; FSPXI rejects other read sizes (0xE0C046F9). */
 #define TITLE_ICON_SIZE 0x36C0
 #define SMDH_METADATA_SIZE 0x2038
@@ -26,6 +28,8 @@ typedef struct {
 } SMDH_Header;
 
 static Result g_lastSmdhResult = 0;
+/* System language cannot change while the app runs; avoid a CFG session per reroll. */
+static s16 g_smdhLanguage = -1;
 
 Result title_smdh_get_last_result(void)
 {
@@ -36,6 +40,9 @@ static u8 get_smdh_language_index(void)
 {
 	u8 lang = 1;
 
+	if (g_smdhLanguage >= 0)
+		return (u8)g_smdhLanguage;
+
 	if (R_SUCCEEDED(cfguInit())) {
 		CFGU_GetSystemLanguage(&lang);
 		cfguExit();
@@ -44,6 +51,7 @@ static u8 get_smdh_language_index(void)
 	if (lang > 11)
 		lang = 1;
 
+	g_smdhLanguage = lang;
 	return lang;
 }
 
@@ -55,101 +63,10 @@ static void append_utf16_ascii(u16 *out, size_t *pos, size_t max, const char *as
 	}
 }
 
-/* Match scripts/title_db_common.py — symbols that render poorly on the 3DS console. */
-static const char *console_codepoint_replacement(u32 cp)
-{
-	static const char *roman[] = {
-		"I", "II", "III", "IV", "V", "VI", "VII", "VIII", "IX", "X",
-		"XI", "XII", "XIII", "XIV", "XV", "XVI"
-	};
-
-	switch (cp) {
-	case 0x2122:
-		return "(TM)";
-	case 0x00AE:
-		return "(R)";
-	case 0x00A9:
-		return "(C)";
-	case 0x2013:
-	case 0x2014:
-	case 0x00B7:
-	case 0x30FB:
-	case 0xFF65:
-		return "-";
-	case 0x2018:
-	case 0x2019:
-	case 0x2032:
-		return "'";
-	case 0x201C:
-	case 0x201D:
-	case 0x2033:
-		return "\"";
-	case 0x2026:
-		return "...";
-	case 0x2022:
-	case 0x2605:
-	case 0x2606:
-	case 0x25CF:
-	case 0xFF0A:
-		return "*";
-	case 0x00D7:
-		return "x";
-	case 0x00F7:
-		return "/";
-	case 0x25CB:
-		return "O";
-	case 0x266A:
-	case 0x266B:
-		return "*";
-	case 0x2665:
-	case 0x2661:
-		return "*";
-	case 0x00A0:
-	case 0x2002:
-	case 0x2003:
-	case 0x2004:
-	case 0x2005:
-	case 0x2006:
-	case 0x2007:
-	case 0x2008:
-	case 0x2009:
-	case 0x200A:
-		return " ";
-	default:
-		break;
-	}
-
-	if (cp >= 0x2160 && cp <= 0x216F)
-		return roman[cp - 0x2160];
-	if (cp >= 0x2170 && cp <= 0x217F)
-		return roman[cp - 0x2170];
-
-	return NULL;
-}
-
-static bool console_codepoint_should_drop(u32 cp)
+/* Rules live in scripts/console_codepoints.txt, shared with clean_title_name(). */
+static const char *console_replacement_text(u8 cls)
 {
-	if (cp == '\n' || cp == '\r' || cp == '\t')
-		return false;
-	if (cp < 0x20 || cp == 0x7F)
-		return true;
-	if (cp == 0xFEFF || cp == 0x200B || cp == 0x200C || cp == 0x200D)
-		return true;
-	if (cp > 0xFFFF)
-		return true;
-	if (cp >= 0xE000 && cp <= 0xF8FF)
-		return true;
-	if (cp >= 0x2190 && cp <= 0x21FF)
-		return true;
-	if (cp >= 0x2200 && cp <= 0x22FF)
-		return true;
-	if (cp >= 0x2300 && cp <= 0x23FF)
-		return true;
-	if (cp >= 0x2600 && cp <= 0x26FF)
-		return true;
-	if (cp >= 0x2700 && cp <= 0x27BF)
-		return true;
-	return false;
+	return title_text_replacements[cls - TITLE_TEXT_CLASS_REPLACE];
 }
 
 static void append_utf8_text(char *out, size_t *pos, size_t max, const char *text)
@@ -179,14 +96,14 @@ static void sanitize_utf16_for_console(const u16 *in, u16 *out, size_t outMax, s
 
 	for (i = 0; i < inMaxChars && in[i] != 0; i++) {
 		u16 c = in[i];
-		const char *replacement = console_codepoint_replacement(c);
+		u8 cls = title_text_codepoint_class(c);
 
-		if (replacement != NULL) {
-			append_utf16_ascii(out, &pos, outMax, replacement);
+		if (cls >= TITLE_TEXT_CLASS_REPLACE) {
+			append_utf16_ascii(out, &pos, outMax, console_replacement_text(cls));
 			continue;
 		}
 
-		if (console_codepoint_should_drop(c))
+		if (cls == TITLE_TEXT_CLASS_DROP)
 			continue;
 
 		if (pos + 1 < outMax)
@@ -211,8 +128,8 @@ void title_text_sanitize_utf8_for_console(char *text, size_t textSize)
 	in = (const uint8_t *)text;
 
 	while (*in && outPos + 1 < outMax) {
-		const char *replacement;
 		uint32_t cp;
+		u8 cls;
 		ssize_t consumed;
 
 		if (in[0] == '<' && (in[1] == 'b' || in[1] == 'B') && (in[2] == 'r' || in[2] == 'R') &&
@@ -228,10 +145,10 @@ void title_text_sanitize_utf8_for_console(char *text, size_t textSize)
 			continue;
 		}
 
-		replacement = console_codepoint_replacement(cp);
-		if (replacement != NULL) {
-			append_utf8_text(sanitized, &outPos, outMax, replacement);
-		} else if (!console_codepoint_should_drop(cp)) {
+		cls = title_text_codepoint_class(cp);
+		if (cls >= TITLE_TEXT_CLASS_REPLACE) {
+			append_utf8_text(sanitized, &outPos, outMax, console_replacement_text(cls));
+		} else if (cls == TITLE_TEXT_CLASS_KEEP) {
 			append_utf8_codepoint(sanitized, &outPos, outMax, cp);
 		}
 
@@ -310,58 +227,76 @@ static Result read_icon_into_buffer(Handle handle, u8 *iconData)
 	return 0;
 }
 
-static Result read_icon_file(u64 titleId, FS_MediaType media, u8 *iconData)
+Result title_exefs_open(u64 titleId, FS_MediaType media, const char *name, Handle *outHandle,
+	FS_Archive *outArchive)
 {
-	Handle handle = 0;
 	u32 low = (u32)titleId;
 	u32 high = (u32)(titleId >> 32);
 	u32 archPath[] = { low, high, (u32)media, 0 };
-	u32 filePath[] = { 0, 0, 2, 0x6E6F6369, 0 };
-	FS_Archive archive = 0;
+	u32 filePath[] = { 0, 0, 2, 0, 0 };
 	Result res;
 
+	*outHandle = 0;
+	*outArchive = 0;
+	strncpy((char *)&filePath[3], name, 8);
+
 	res = FSUSER_OpenFileDirectly(
-		&handle,
+		outHandle,
 		ARCHIVE_SAVEDATA_AND_CONTENT,
 		(FS_Path){ PATH_BINARY, sizeof(archPath), archPath },
 		(FS_Path){ PATH_BINARY, sizeof(filePath), filePath },
 		FS_OPEN_READ,
 		0);
+	if (R_SUCCEEDED(res))
+		return res;
+
+	res = FSUSER_OpenArchive(
+		outArchive,
+		ARCHIVE_SAVEDATA_AND_CONTENT,
+		(FS_Path){ PATH_BINARY, sizeof(archPath), archPath });
 	if (R_FAILED(res)) {
-		res = FSUSER_OpenArchive(
-			&archive,
-			ARCHIVE_SAVEDATA_AND_CONTENT,
-			(FS_Path){ PATH_BINARY, sizeof(archPath), archPath });
-		if (R_FAILED(res))
-			return res;
-
-		res = FSUSER_OpenFile(
-			&handle,
-			archive,
-			(FS_Path){ PATH_BINARY, sizeof(filePath), filePath },
-			FS_OPEN_READ,
-			0);
-		if (R_FAILED(res)) {
-			FSUSER_CloseArchive(archive);
-			return res;
-		}
+		*outArchive = 0;
+		return res;
 	}
 
-	res = read_icon_into_buffer(handle, iconData);
+	res = FSUSER_OpenFile(
+		outHandle,
+		*outArchive,
+		(FS_Path){ PATH_BINARY, sizeof(filePath), filePath },
+		FS_OPEN_READ,
+		0);
+	if (R_FAILED(res)) {
+		FSUSER_CloseArchive(*outArchive);
+		*outArchive = 0;
+	}
+
+	return res;
+}
+
+void title_exefs_close(Handle handle, FS_Archive archive)
+{
 	FSFILE_Close(handle);
 	if (archive != 0)
 		FSUSER_CloseArchive(archive);
+}
+
+static Result read_icon_file(u64 titleId, FS_MediaType media, u8 *iconData)
+{
+	Handle handle;
+	FS_Archive archive;
+	Result res;
+
+	res = title_exefs_open(titleId, media, "icon", &handle, &archive);
+	if (R_FAILED(res))
+		return res;
+
+	res = read_icon_into_buffer(handle, iconData);
+	title_exefs_close(handle, archive);
 
 	return res;
 }
 
-typedef enum {
-	SMDH_FIELD_SHORT,
-	SMDH_FIELD_LONG,
-	SMDH_FIELD_PUBLISHER,
-} smdh_field_t;
-
-static const u16 *pick_utf16_field(const SMDH_Header *smdh, u8 lang, smdh_field_t field)
+static const u16 *pick_utf16_field(const SMDH_Header *smdh, u8 lang, title_smdh_field_t field)
 {
 	const SMDH_ApplicationTitle *slot = &smdh->titles[lang];
 	const SMDH_ApplicationTitle *english = &smdh->titles[1];
@@ -369,15 +304,15 @@ static const u16 *pick_utf16_field(const SMDH_Header *smdh, u8 lang, smdh_field_
 	const u16 *fallback;
 
 	switch (field) {
-	case SMDH_FIELD_SHORT:
+	case TITLE_SMDH_FIELD_SHORT_NAME:
 		primary = slot->short_desc;
 		fallback = english->short_desc;
 		break;
-	case SMDH_FIELD_LONG:
+	case TITLE_SMDH_FIELD_LONG_NAME:
 		primary = slot->long_desc;
 		fallback = english->long_desc;
 		break;
-	case SMDH_FIELD_PUBLISHER:
+	case TITLE_SMDH_FIELD_PUBLISHER:
 		primary = slot->publisher;
 		fallback = english->publisher;
 		break;
@@ -392,6 +327,28 @@ static const u16 *pick_utf16_field(const SMDH_Header *smdh, u8 lang, smdh_field_
 	return NULL;
 }
 
+static void copy_utf16_field(const SMDH_Header *smdh, u8 lang, title_smdh_field_t field, u16 *out,
+	size_t outChars)
+{
+	const u16 *raw = pick_utf16_field(smdh, lang, field);
+
+	if (raw != NULL)
+		memcpy(out, raw, outChars * sizeof(u16));
+}
+
+/* True if any code unit survives console sanitizing (same outcome as a full decode). */
+static bool utf16_field_has_text(const u16 *in, size_t inMaxChars)
+{
+	size_t i;
+
+	for (i = 0; i < inMaxChars && in[i] != 0; i++) {
+		if (title_text_codepoint_class(in[i]) != TITLE_TEXT_CLASS_DROP)
+			return true;
+	}
+
+	return false;
+}
+
 static void append_text(char *buf, size_t bufSize, const char *text)
 {
 	size_t used;
@@ -523,29 +480,43 @@ void title_smdh_format_flags(u32 flags, char *buf, size_t bufSize)
 		snprintf(buf, bufSize, "0x%08lX", (unsigned long)flags);
 }
 
-title_smdh_result_t title_smdh_load(u64 titleId, FS_MediaType media, title_smdh_info_t *info)
+title_smdh_result_t title_smdh_load(u64 titleId, FS_MediaType media, title_smdh_info_t *info,
+	title_smdh_icon_t *icon)
+{
+	title_smdh_result_t result;
+	Result res = 0;
+
+	result = title_smdh_load_ex(titleId, media, info, icon, &res);
+	g_lastSmdhResult = res;
+	return result;
+}
+
+title_smdh_result_t title_smdh_load_ex(u64 titleId, FS_MediaType media, title_smdh_info_t *info,
+	title_smdh_icon_t *icon, Result *outResult)
 {
 	SMDH_Header *smdh;
 	u8 *iconData;
 	u8 lang;
-	const u16 *field;
 	Result res;
-	bool hasText = false;
 
-	g_lastSmdhResult = 0;
+	if (outResult != NULL)
+		*outResult = 0;
 
 	if (info == NULL)
 		return TITLE_SMDH_ERR_FORMAT;
 
 	memset(info, 0, sizeof(*info));
 	info->result = TITLE_SMDH_ERR_OPEN;
+	if (icon != NULL)
+		icon->loaded = false;
 
 	iconData = (u8 *)malloc(TITLE_ICON_SIZE);
 	if (iconData == NULL)
 		return TITLE_SMDH_ERR_READ;
 
 	res = read_icon_file(titleId, media, iconData);
-	g_lastSmdhResult = res;
+	if (outResult != NULL)
+		*outResult = res;
 	if (R_FAILED(res)) {
 		free(iconData);
 		return TITLE_SMDH_ERR_OPEN;
@@ -560,17 +531,9 @@ title_smdh_result_t title_smdh_load(u64 titleId, FS_MediaType media, title_smdh_
 
 	lang = get_smdh_language_index();
 
-	field = pick_utf16_field(smdh, lang, SMDH_FIELD_SHORT);
-	if (field != NULL && utf16_field_to_utf8(field, 0x40, info->short_name, sizeof(info->short_name)))
-		hasText = true;
-
-	field = pick_utf16_field(smdh, lang, SMDH_FIELD_LONG);
-	if (field != NULL)
-		utf16_field_to_utf8(field, 0x80, info->long_name, sizeof(info->long_name));
-
-	field = pick_utf16_field(smdh, lang, SMDH_FIELD_PUBLISHER);
-	if (field != NULL)
-		utf16_field_to_utf8(field, 0x40, info->publisher, sizeof(info->publisher));
+	copy_utf16_field(smdh, lang, TITLE_SMDH_FIELD_SHORT_NAME, info->raw_short_name, 0x40);
+	copy_utf16_field(smdh, lang, TITLE_SMDH_FIELD_LONG_NAME, info->raw_long_name, 0x80);
+	copy_utf16_field(smdh, lang, TITLE_SMDH_FIELD_PUBLISHER, info->raw_publisher, 0x40);
 
 	memcpy(info->ratings, iconData + 0x2008, sizeof(info->ratings));
 	memcpy(&info->region_lock, iconData + 0x2018, sizeof(info->region_lock));
@@ -578,22 +541,58 @@ title_smdh_result_t title_smdh_load(u64 titleId, FS_MediaType media, title_smdh_
 	info->eula_minor = iconData[0x202C];
 	info->eula_major = iconData[0x202D];
 	memcpy(&info->cec_id, iconData + 0x2034, sizeof(info->cec_id));
+	if (icon != NULL) {
+		memcpy(icon->large, iconData + TITLE_ICON_LARGE_OFFSET, sizeof(icon->large));
+		icon->loaded = true;
+	}
 
 	free(iconData);
 
-	if (!hasText) {
+	if (!utf16_field_has_text(info->raw_short_name, 0x40)) {
 		info->result = TITLE_SMDH_ERR_EMPTY;
 		return TITLE_SMDH_ERR_EMPTY;
 	}
 
-	title_text_sanitize_utf8_for_console(info->short_name, sizeof(info->short_name));
-	title_text_sanitize_utf8_for_console(info->long_name, sizeof(info->long_name));
-	title_text_sanitize_utf8_for_console(info->publisher, sizeof(info->publisher));
-
 	info->result = TITLE_SMDH_OK;
 	return TITLE_SMDH_OK;
 }
 
+const char *title_smdh_field(const title_smdh_info_t *info, title_smdh_field_t field, char *out,
+	size_t outSize)
+{
+	const u16 *raw;
+	size_t rawChars;
+
+	if (out == NULL || outSize == 0)
+		return "";
+
+	out[0] = '\0';
+	if (info == NULL)
+		return out;
+
+	switch (field) {
+	case TITLE_SMDH_FIELD_SHORT_NAME:
+		raw = info->raw_short_name;
+		rawChars = 0x40;
+		break;
+	case TITLE_SMDH_FIELD_LONG_NAME:
+		raw = info->raw_long_name;
+		rawChars = 0x80;
+		break;
+	case TITLE_SMDH_FIELD_PUBLISHER:
+		raw = info->raw_publisher;
+		rawChars = 0x40;
+		break;
+	default:
+		return out;
+	}
+
+	if (utf16_field_to_utf8(raw, rawChars, out, outSize))
+		title_text_sanitize_utf8_for_console(out, outSize);
+
+	return out;
+}
+
 title_smdh_result_t title_smdh_get_short_name(u64 titleId, FS_MediaType media, char *out, size_t outSize)
 {
 	title_smdh_info_t info;
@@ -603,11 +602,10 @@ title_smdh_result_t title_smdh_get_short_name(u64 titleId, FS_MediaType media, c
 		return TITLE_SMDH_ERR_FORMAT;
 
 	out[0] = '\0';
-	result = title_smdh_load(titleId, media, &info);
+	result = title_smdh_load(titleId, media, &info, NULL);
 	if (result != TITLE_SMDH_OK)
 		return result;
 
-	strncpy(out, info.short_name, outSize - 1);
-	out[outSize - 1] = '\0';
+	title_smdh_field(&info, TITLE_SMDH_FIELD_SHORT_NAME, out, outSize);
 	return TITLE_SMDH_OK;
 }
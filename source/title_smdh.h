@@ -7,6 +7,8 @@
 #include <3ds.h>
 #include <stddef.h>
 
+#include "title_icon.h"
+
 /* Short desc is 64 UTF-16 code units; UTF-8 can exceed 128 bytes (JP/CJK titles). */
 #define TITLE_SMDH_SHORT_NAME_UTF8_MAX 192
 /* Long desc is 128 UTF-16 code units. */
@@ -22,11 +24,19 @@ typedef enum {
 	TITLE_SMDH_ERR_EMPTY,
 } title_smdh_result_t;
 
+typedef enum {
+	TITLE_SMDH_FIELD_SHORT_NAME = 0,
+	TITLE_SMDH_FIELD_LONG_NAME,
+	TITLE_SMDH_FIELD_PUBLISHER,
+	TITLE_SMDH_FIELD_COUNT,
+} title_smdh_field_t;
+
 typedef struct {
 	title_smdh_result_t result;
-	char short_name[TITLE_SMDH_SHORT_NAME_UTF8_MAX];
-	char long_name[TITLE_SMDH_LONG_NAME_UTF8_MAX];
-	char publisher[TITLE_SMDH_PUBLISHER_UTF8_MAX];
+	/* Raw UTF-16 text (system language, English fallback per field); decoded on request. */
+	u16 raw_short_name[0x40];
+	u16 raw_long_name[0x80];
+	u16 raw_publisher[0x40];
 	u8 ratings[16];
 	u32 region_lock;
 	u32 flags;
@@ -35,12 +45,36 @@ typedef struct {
 	u32 cec_id;
 } title_smdh_info_t;
 
-/// Read installed title SMDH text fields and application settings (not icon pixels).
-title_smdh_result_t title_smdh_load(u64 titleId, FS_MediaType media, title_smdh_info_t *info);
+/* Kept apart from title_smdh_info_t: only the pick shown on screen needs pixels. */
+typedef struct {
+	bool loaded;
+	/* Large icon pixels as stored in the SMDH (tiled RGB565); see title_icon_decode_rgb565. */
+	u16 large[TITLE_ICON_LARGE_DIM * TITLE_ICON_LARGE_DIM];
+} title_smdh_icon_t;
+
+/// Read installed title SMDH text fields and application settings, plus the large icon when
+/// icon is not NULL. Text stays raw UTF-16 until requested through title_smdh_field().
+title_smdh_result_t title_smdh_load(u64 titleId, FS_MediaType media, title_smdh_info_t *info,
+	title_smdh_icon_t *icon);
+
+/// Same as title_smdh_load, but reports the FS result through outResult instead of
+/// title_smdh_get_last_result(), so it is safe to call from a worker thread.
+title_smdh_result_t title_smdh_load_ex(u64 titleId, FS_MediaType media, title_smdh_info_t *info,
+	title_smdh_icon_t *icon, Result *outResult);
+
+/// Decode one text field into out as console-sanitized UTF-8 (empty when the SMDH has none).
+/// Returns out. Callers that show a field repeatedly keep the result (the page cache does).
+const char *title_smdh_field(const title_smdh_info_t *info, title_smdh_field_t field, char *out,
+	size_t outSize);
 
 /// Read only the short name (wraps title_smdh_load).
 title_smdh_result_t title_smdh_get_short_name(u64 titleId, FS_MediaType media, char *out, size_t outSize);
 
+/// Open an ExeFS file ("icon", "banner") of an installed title; close with title_exefs_close.
+Result title_exefs_open(u64 titleId, FS_MediaType media, const char *name, Handle *outHandle,
+	FS_Archive *outArchive);
+void title_exefs_close(Handle handle, FS_Archive archive);
+
 /// FS/AM result from the most recent title_smdh_load/get_short_name call (0 on success).
 Result title_smdh_get_last_result(void);
 
@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_snapshot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define SNAPSHOT_MAGIC 0x534C4752u /* 'RGLS' little-endian */
+#define SNAPSHOT_VERSION 3u
+#define SNAPSHOT_DIR "sdmc:/3ds/3DS-Random-Game-Launcher"
+#define FNV32_OFFSET 0x811C9DC5u
+#define FNV32_PRIME 0x01000193u
+
+#ifndef APP_VERSION
+#define APP_VERSION "0.0.0"
+#endif
+
+typedef struct {
+	u32 magic;
+	u16 version;
+	u16 header_size;
+	/* Hash of the APP_VERSION that wrote the file: names and eligibility depend on its title database. */
+	u32 app_hash;
+	u32 media_mask;
+	u32 sd_count;
+	u32 nand_count;
+	u64 sd_hash;
+	u64 nand_hash;
+	u32 settings_hash;
+	u32 active_count;
+	u32 pool_count;
+	u32 entry_count;
+	/* Guards against layout changes of the in-memory structs stored below. */
+	u32 entry_size;
+	u32 stats_size;
+	u32 payload_size;
+	u32 checksum;
+} __attribute__((packed)) snapshot_header_t;
+
+static u32 payload_checksum(const u8 *data, size_t size)
+{
+	u32 hash = FNV32_OFFSET;
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		hash ^= data[i];
+		hash *= FNV32_PRIME;
+	}
+
+	return hash;
+}
+
+static u32 app_version_hash(void)
+{
+	return payload_checksum((const u8 *)APP_VERSION, sizeof(APP_VERSION) - 1);
+}
+
+static size_t scan_bytes(u32 count)
+{
+	const title_scan_t *scan = NULL;
+
+	return count * (sizeof(scan->titles[0]) + sizeof(scan->sizes[0]) + sizeof(scan->versions[0]) +
+		sizeof(scan->info_results[0]));
+}
+
+static size_t payload_bytes(const snapshot_header_t *header)
+{
+	return scan_bytes(header->sd_count) + scan_bytes(header->nand_count) +
+		header->active_count * sizeof(title_source_t) + sizeof(title_stats_t) +
+		header->pool_count * sizeof(u32) + header->entry_count * sizeof(title_index_entry_t);
+}
+
+static u8 *take(u8 *cursor, void *dst, size_t size)
+{
+	memcpy(dst, cursor, size);
+	return cursor + size;
+}
+
+static u8 *take_scan(u8 *cursor, title_scan_t *scan, u32 count)
+{
+	scan->count = count;
+	cursor = take(cursor, scan->titles, count * sizeof(scan->titles[0]));
+	cursor = take(cursor, scan->sizes, count * sizeof(scan->sizes[0]));
+	cursor = take(cursor, scan->versions, count * sizeof(scan->versions[0]));
+	return take(cursor, scan->info_results, count * sizeof(scan->info_results[0]));
+}
+
+static bool header_valid(const snapshot_header_t *header)
+{
+	return header->magic == SNAPSHOT_MAGIC && header->version == SNAPSHOT_VERSION &&
+		header->header_size == sizeof(snapshot_header_t) && header->app_hash == app_version_hash() &&
+		header->entry_size == sizeof(title_index_entry_t) && header->stats_size == sizeof(title_stats_t) &&
+		header->sd_count <= TITLE_SCAN_MAX && header->nand_count <= TITLE_SCAN_MAX &&
+		header->active_count <= TITLE_PICKER_POOL_MAX && header->pool_count <= header->active_count &&
+		header->entry_count <= header->active_count && header->payload_size == payload_bytes(header);
+}
+
+title_snapshot_result_t title_snapshot_load(title_snapshot_t *snapshot, u32 sdCount, u32 nandCount)
+{
+	snapshot_header_t header;
+	title_snapshot_result_t result;
+	FILE *file;
+	u8 *payload;
+	u8 *cursor;
+
+	if (snapshot == NULL || snapshot->sd == NULL || snapshot->nand == NULL)
+		return TITLE_SNAPSHOT_MISSING;
+
+	snapshot->entries = NULL;
+	snapshot->entry_count = 0;
+
+	file = fopen(TITLE_SNAPSHOT_PATH, "rb");
+	if (file == NULL)
+		return TITLE_SNAPSHOT_MISSING;
+
+	if (fread(&header, sizeof(header), 1, file) != 1 || !header_valid(&header)) {
+		fclose(file);
+		return TITLE_SNAPSHOT_MISSING;
+	}
+
+	if (((header.media_mask & TITLE_SNAPSHOT_MEDIA_BIT(MEDIATYPE_SD)) && header.sd_count != sdCount) ||
+	    ((header.media_mask & TITLE_SNAPSHOT_MEDIA_BIT(MEDIATYPE_NAND)) && header.nand_count != nandCount)) {
+		fclose(file);
+		return TITLE_SNAPSHOT_STALE;
+	}
+
+	payload = (u8 *)malloc(header.payload_size);
+	if (payload == NULL) {
+		fclose(file);
+		return TITLE_SNAPSHOT_MISSING;
+	}
+
+	if (fread(payload, 1, header.payload_size, file) != header.payload_size ||
+	    payload_checksum(payload, header.payload_size) != header.checksum) {
+		fclose(file);
+		free(payload);
+		return TITLE_SNAPSHOT_MISSING;
+	}
+	fclose(file);
+
+	cursor = take_scan(payload, snapshot->sd, header.sd_count);
+	cursor = take_scan(cursor, snapshot->nand, header.nand_count);
+
+	/* Same counts but a different list (e.g. one title swapped for another): stale. */
+	if (title_scan_hash(snapshot->sd) != header.sd_hash ||
+	    title_scan_hash(snapshot->nand) != header.nand_hash) {
+		free(payload);
+		return TITLE_SNAPSHOT_MISSING;
+	}
+
+	snapshot->media_mask = header.media_mask;
+	result = TITLE_SNAPSHOT_LISTS_ONLY;
+	if (header.settings_hash == snapshot->settings_hash && snapshot->active != NULL &&
+	    snapshot->active_count != NULL && snapshot->stats != NULL && snapshot->pool != NULL) {
+		cursor = take(cursor, snapshot->active, header.active_count * sizeof(title_source_t));
+		*snapshot->active_count = header.active_count;
+		cursor = take(cursor, snapshot->stats, sizeof(title_stats_t));
+		cursor = take(cursor, snapshot->pool->indices, header.pool_count * sizeof(u32));
+		snapshot->pool->count = header.pool_count;
+		result = TITLE_SNAPSHOT_OK;
+	} else {
+		cursor += header.active_count * sizeof(title_source_t) + sizeof(title_stats_t) +
+			header.pool_count * sizeof(u32);
+	}
+
+	if (header.entry_count > 0) {
+		snapshot->entries = (title_index_entry_t *)malloc(header.entry_count * sizeof(title_index_entry_t));
+		if (snapshot->entries != NULL) {
+			memcpy(snapshot->entries, cursor, header.entry_count * sizeof(title_index_entry_t));
+			snapshot->entry_count = header.entry_count;
+		}
+	}
+
+	free(payload);
+	return result;
+}
+
+static bool write_block(FILE *file, const void *data, size_t size, u32 *checksum)
+{
+	const u8 *bytes = (const u8 *)data;
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		*checksum ^= bytes[i];
+		*checksum *= FNV32_PRIME;
+	}
+
+	return size == 0 || fwrite(data, 1, size, file) == size;
+}
+
+static bool write_scan(FILE *file, const title_scan_t *scan, u32 *checksum)
+{
+	return write_block(file, scan->titles, scan->count * sizeof(scan->titles[0]), checksum) &&
+		write_block(file, scan->sizes, scan->count * sizeof(scan->sizes[0]), checksum) &&
+		write_block(file, scan->versions, scan->count * sizeof(scan->versions[0]), checksum) &&
+		write_block(file, scan->info_results, scan->count * sizeof(scan->info_results[0]), checksum);
+}
+
+bool title_snapshot_save(const title_snapshot_t *snapshot)
+{
+	snapshot_header_t header;
+	u32 checksum = FNV32_OFFSET;
+	bool ok;
+	FILE *file;
+
+	if (snapshot == NULL || snapshot->sd == NULL || snapshot->nand == NULL || snapshot->active == NULL ||
+	    snapshot->active_count == NULL || snapshot->stats == NULL || snapshot->pool == NULL)
+		return false;
+
+	memset(&header, 0, sizeof(header));
+	header.magic = SNAPSHOT_MAGIC;
+	header.version = SNAPSHOT_VERSION;
+	header.header_size = (u16)sizeof(snapshot_header_t);
+	header.app_hash = app_version_hash();
+	header.media_mask = snapshot->media_mask;
+	header.sd_count = snapshot->sd->count;
+	header.nand_count = snapshot->nand->count;
+	header.sd_hash = title_scan_hash(snapshot->sd);
+	header.nand_hash = title_scan_hash(snapshot->nand);
+	header.settings_hash = snapshot->settings_hash;
+	header.active_count = *snapshot->active_count;
+	header.pool_count = snapshot->pool->count;
+	header.entry_count = snapshot->entries != NULL ? snapshot->entry_count : 0;
+	header.entry_size = sizeof(title_index_entry_t);
+	header.stats_size = sizeof(title_stats_t);
+	header.payload_size = (u32)payload_bytes(&header);
+
+	mkdir("sdmc:/3ds", 0777);
+	mkdir(SNAPSHOT_DIR, 0777);
+
+	file = fopen(TITLE_SNAPSHOT_PATH, "wb");
+	if (file == NULL)
+		return false;
+
+	/* Header goes first with a zero checksum and is rewritten once the payload is hashed. */
+	ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+		write_scan(file, snapshot->sd, &checksum) &&
+		write_scan(file, snapshot->nand, &checksum) &&
+		write_block(file, snapshot->active, header.active_count * sizeof(title_source_t), &checksum) &&
+		write_block(file, snapshot->stats, sizeof(title_stats_t), &checksum) &&
+		write_block(file, snapshot->pool->indices, header.pool_count * sizeof(u32), &checksum) &&
+		write_block(file, snapshot->entries, header.entry_count * sizeof(title_index_entry_t), &checksum);
+
+	if (ok) {
+		header.checksum = checksum;
+		ok = fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1;
+	}
+
+	if (fclose(file) != 0)
+		ok = false;
+	if (!ok)
+		remove(TITLE_SNAPSHOT_PATH);
+	return ok;
+}
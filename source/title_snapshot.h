@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_SNAPSHOT_H
+#define TITLE_SNAPSHOT_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+#include "title_index.h"
+#include "title_picker.h"
+#include "title_scan.h"
+#include "title_stats.h"
+
+#define TITLE_SNAPSHOT_PATH "sdmc:/3ds/3DS-Random-Game-Launcher/library.bin"
+
+/* Bit (1 << FS_MediaType) set for each media whose list the snapshot holds. */
+#define TITLE_SNAPSHOT_MEDIA_BIT(media) (1u << (media))
+
+/*
+ * Everything startup derives from the AM scans: both title lists with their title
+ * info, the active list and its statistics, the eligible pool, and the resolved SMDH
+ * names. Pointers refer to the caller's live state; load writes straight into it.
+ */
+typedef struct {
+	title_scan_t *sd;
+	title_scan_t *nand;
+	title_source_t *active;
+	u32 *active_count;
+	title_stats_t *stats;
+	/* NULL on load restores the lists only (TITLE_SNAPSHOT_LISTS_ONLY at best). */
+	title_picker_pool_t *pool;
+	/* Which of sd/nand were actually scanned; an unscanned list is stored empty and never validated. */
+	u32 media_mask;
+	/* Fingerprint of the settings the active list and pool were built with. */
+	u32 settings_hash;
+	/* Load: malloc'd copy of the saved index entries (caller frees). Save: entries to write. */
+	title_index_entry_t *entries;
+	u32 entry_count;
+} title_snapshot_t;
+
+typedef enum {
+	TITLE_SNAPSHOT_MISSING = 0,
+	/* Title counts differ from AM: the library changed, rescan. */
+	TITLE_SNAPSHOT_STALE,
+	/* Lists restored; the settings changed since, so the active list and pool must be rebuilt. */
+	TITLE_SNAPSHOT_LISTS_ONLY,
+	TITLE_SNAPSHOT_OK,
+} title_snapshot_result_t;
+
+/// Read the snapshot in one pass if it was written by this APP_VERSION and its header matches the
+/// current title counts of the media it holds (media_mask is set from the file). settings_hash selects whether the saved active
+/// list and pool are still usable.
+title_snapshot_result_t title_snapshot_load(title_snapshot_t *snapshot, u32 sdCount, u32 nandCount);
+
+/// Write the snapshot (header, then each array back to back). Returns false on I/O error.
+bool title_snapshot_save(const title_snapshot_t *snapshot);
+
+#endif
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "title_stats.h"
+
+#include <string.h>
+
+#include "title_database.h"
+
+void title_stats_reset(title_stats_t *stats)
+{
+	if (stats != NULL)
+		memset(stats, 0, sizeof(*stats));
+}
+
+void title_stats_add(title_stats_t *stats, u64 titleId, FS_MediaType media, u64 installedSize)
+{
+	u32 cls;
+	u32 slot;
+	u16 platform;
+
+	if (stats == NULL)
+		return;
+
+	cls = title_meta_category_class(title_meta_decode_category(titleId));
+	slot = title_meta_class_index(cls);
+	platform = (u16)(titleId >> 48);
+
+	stats->total++;
+	stats->total_size += installedSize;
+	stats->class_counts[slot]++;
+	stats->class_sizes[slot] += installedSize;
+	stats->platform_counts[platform < TITLE_STATS_PLATFORM_MAX ? platform : 0]++;
+
+	if (media == MEDIATYPE_NAND)
+		stats->nand_count++;
+	else if (media == MEDIATYPE_GAME_CARD)
+		stats->card_count++;
+	else
+		stats->sd_count++;
+
+	if (title_database_contains(titleId))
+		stats->catalog_count++;
+
+	if (cls == TITLE_CLASS_APPLICATION) {
+		if (title_database_is_virtual_console(titleId))
+			stats->vc_count++;
+		else
+			stats->native_count++;
+	}
+}
+
+u32 title_stats_catalog_permille(const title_stats_t *stats)
+{
+	if (stats == NULL || stats->total == 0)
+		return 0;
+
+	return (u32)(((u64)stats->catalog_count * 1000 + stats->total / 2) / stats->total);
+}
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_STATS_H
+#define TITLE_STATS_H
+
+#include <3ds.h>
+
+#include "title_meta.h"
+
+#define TITLE_STATS_PLATFORM_MAX 6
+
+/* Library-wide aggregates, updated per title as the active list is built. */
+typedef struct {
+	u32 total;
+	u32 sd_count;
+	u32 nand_count;
+	u32 card_count;
+	u32 catalog_count;
+	u32 native_count;
+	u32 vc_count;
+	u64 total_size;
+	u32 class_counts[TITLE_CLASS_COUNT];
+	u64 class_sizes[TITLE_CLASS_COUNT];
+	/* Indexed by platform code; slot 0 collects unknown platforms. */
+	u32 platform_counts[TITLE_STATS_PLATFORM_MAX];
+} title_stats_t;
+
+void title_stats_reset(title_stats_t *stats);
+
+/// Fold one title into the aggregates (O(1) apart from the catalog lookup).
+void title_stats_add(title_stats_t *stats, u64 titleId, FS_MediaType media, u64 installedSize);
+
+/// Catalog coverage in tenths of a percent (0..1000).
+u32 title_stats_catalog_permille(const title_stats_t *stats);
+
+#endif
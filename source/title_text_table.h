@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TITLE_TEXT_TABLE_H
+#define TITLE_TEXT_TABLE_H
+
+#include <3ds.h>
+
+/* Console codepoint classes; tables generated from scripts/console_codepoints.txt. */
+#define TITLE_TEXT_CLASS_KEEP 0
+#define TITLE_TEXT_CLASS_DROP 1
+/* Classes >= REPLACE index title_text_replacements[class - TITLE_TEXT_CLASS_REPLACE]. */
+#define TITLE_TEXT_CLASS_REPLACE 2
+
+extern const u8 title_text_page_index[256];
+extern const u8 title_text_page_classes[][256];
+extern const char *const title_text_replacements[];
+
+/// Two-level lookup: BMP page -> shared 256-entry class page. Non-BMP code points are dropped.
+static inline u8 title_text_codepoint_class(u32 cp)
+{
+	if (cp > 0xFFFF)
+		return TITLE_TEXT_CLASS_DROP;
+
+	return title_text_page_classes[title_text_page_index[cp >> 8]][cp & 0xFF];
+}
+
+#endif
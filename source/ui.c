@@ -6,6 +6,12 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "frame.h"
+#include "perf.h"
+#include "ui_font.h"
+#include "ui_grid.h"
+#include "ui_text.h"
+
 #ifndef APP_VERSION
 #define APP_VERSION "0.0.0"
 #endif
@@ -19,43 +25,89 @@
 #define UI_CONTROLS_ROW_FILTER_ACTIONS 26
 #define UI_CONTROLS_ROW_FOOTER_GAP 27
 #define UI_CONTENT_ROW_TITLE 6
-#define UI_CONTENT_ROW_PUBLISHER 7
+/* The title may take rows 6-7; the publisher goes on the row after it. */
+#define UI_TITLE_LINES_MAX 2
 #define UI_CONTENT_ROW_GAP 9
 #define UI_CONTENT_ROW_ACTIONS 10
 #define UI_DETAILS_CONTENT_ROW 10
 #define UI_FIELD_LABEL_COLS 14
 #define UI_TECH_LABEL_COLS 18
 #define UI_FILTER_LABEL_COLS 16
+/* Fits the longest options label, "Log startup times". */
+#define UI_MENU_LABEL_COLS 18
 #define UI_FILTER_STATE_COLS 3
+#define UI_ICON_SCALE 2
+#define UI_BOTTOM_WIDTH 320
+#define UI_BOTTOM_HEIGHT 240
+#define UI_SGR_RESET 0
+#define UI_SGR_WHITE 37
+#define UI_SGR_GREY 90
+
+/*
+ * The helpers below cover most of what a page prints and append through ui_text's formatters;
+ * ui_printf (vsnprintf) is left for the one-off lines.
+ */
+static void print_colored(u32 sgr, const char *text)
+{
+	ui_text_t *out = ui_grid_text();
+
+	ui_text_put_sgr(out, sgr);
+	ui_text_put(out, text);
+	ui_text_put_sgr(out, UI_SGR_RESET);
+}
+
+static void print_padded_label(u32 cols, const char *label)
+{
+	ui_text_t *out = ui_grid_text();
+
+	ui_text_put_sgr(out, UI_SGR_GREY);
+	ui_text_put_padded(out, label, cols);
+	ui_text_put_sgr(out, UI_SGR_RESET);
+}
+
+/* Move to the start of a (1-based) row and erase it. */
+static void print_blank_row(u32 row)
+{
+	ui_text_t *out = ui_grid_text();
+
+	ui_text_put_move(out, row, 1);
+	ui_text_put(out, "\x1b[K");
+}
 
 static void print_page_tab(u32 page, u32 active_page)
 {
 	if (page == active_page) {
 		switch (page) {
-		case 0:
-			printf("\x1b[37mGAME\x1b[0m");
+		case UI_PAGE_GAME:
+			ui_puts("\x1b[37mGAME\x1b[0m");
+			break;
+		case UI_PAGE_DETAILS:
+			ui_puts("\x1b[37mDETAILS\x1b[0m");
 			break;
-		case 1:
-			printf("\x1b[37mDETAILS\x1b[0m");
+		case UI_PAGE_TECHNICAL:
+			ui_puts("\x1b[37mTECHNICAL\x1b[0m");
 			break;
 		default:
-			printf("\x1b[37mTECHNICAL\x1b[0m");
+			ui_puts("\x1b[37mLIBRARY\x1b[0m");
 			break;
 		}
 	} else {
-		printf("\x1b[90m");
+		ui_puts("\x1b[90m");
 		switch (page) {
-		case 0:
-			printf("game");
+		case UI_PAGE_GAME:
+			ui_puts("game");
+			break;
+		case UI_PAGE_DETAILS:
+			ui_puts("details");
 			break;
-		case 1:
-			printf("details");
+		case UI_PAGE_TECHNICAL:
+			ui_puts("technical");
 			break;
 		default:
-			printf("technical");
+			ui_puts("library");
 			break;
 		}
-		printf("\x1b[0m");
+		ui_puts("\x1b[0m");
 	}
 }
 
@@ -63,13 +115,13 @@ static void print_page_tabs(u32 active_page)
 {
 	u32 page;
 
-	printf("\x1b[90m< \x1b[0m");
+	ui_puts("\x1b[90m< \x1b[0m");
 	for (page = 0; page < UI_PAGE_COUNT; page++) {
 		if (page > 0)
-			printf("\x1b[90m | \x1b[0m");
+			ui_puts("\x1b[90m | \x1b[0m");
 		print_page_tab(page, active_page);
 	}
-	printf("\x1b[90m >\x1b[0m\n\n");
+	ui_puts("\x1b[90m >\x1b[0m\n\n");
 }
 
 static const char *media_inclusion_status(bool included)
@@ -77,22 +129,65 @@ static const char *media_inclusion_status(bool included)
 	return included ? "on" : "off";
 }
 
+static void print_source_count(const char *label, const ui_source_t *source)
+{
+	ui_text_t *out = ui_grid_text();
+
+	ui_text_put_sgr(out, UI_SGR_GREY);
+	ui_text_put(out, label);
+	ui_text_put_char(out, ':');
+	ui_text_put_sgr(out, UI_SGR_RESET);
+	ui_text_put_char(out, ' ');
+	if (source->scanned)
+		ui_text_put_u32(out, source->title_count);
+	else
+		ui_text_put_char(out, '-');
+	ui_text_put(out, " (");
+	ui_text_put(out, media_inclusion_status(source->included));
+	ui_text_put_char(out, ')');
+}
+
+/* "SD: n (on)  NAND: - (off)", plus the game card once it has been read. */
+static void print_source_counts(const ui_source_t *sources)
+{
+	print_source_count("SD", &sources[MEDIATYPE_SD]);
+	ui_puts("  ");
+	print_source_count("NAND", &sources[MEDIATYPE_NAND]);
+	if (sources[MEDIATYPE_GAME_CARD].scanned || sources[MEDIATYPE_GAME_CARD].included) {
+		ui_puts("  ");
+		print_source_count("Card", &sources[MEDIATYPE_GAME_CARD]);
+	}
+	ui_puts("\n");
+}
+
+static const char *media_name(FS_MediaType media)
+{
+	switch (media) {
+	case MEDIATYPE_NAND:
+		return "NAND";
+	case MEDIATYPE_GAME_CARD:
+		return "Game card";
+	default:
+		return "SD";
+	}
+}
+
 static void print_section_header(const char *title, bool first)
 {
 	if (!first)
-		printf("\n");
-	printf("\x1b[90m%s\x1b[0m\n", title);
+		ui_puts("\n");
+	print_colored(UI_SGR_GREY, title);
+	ui_puts("\n");
 }
 
 static void print_field_inline_cols(u32 labelCols, const char *label, const char *value, bool dim_value)
 {
-	printf("\x1b[90m%-*s\x1b[0m", (int)labelCols, label);
+	print_padded_label(labelCols, label);
 	if (value == NULL || value[0] == '\0')
-		printf("\x1b[90m(unavailable)\x1b[0m\n");
-	else if (dim_value)
-		printf("\x1b[90m%s\x1b[0m\n", value);
+		print_colored(UI_SGR_GREY, "(unavailable)");
 	else
-		printf("\x1b[37m%s\x1b[0m\n", value);
+		print_colored(dim_value ? UI_SGR_GREY : UI_SGR_WHITE, value);
+	ui_puts("\n");
 }
 
 static void print_field_inline_ex(const char *label, const char *value, bool dim_value)
@@ -117,126 +212,74 @@ static void print_tech_field_inline_dim(const char *label, const char *value)
 
 static void print_toggle_state(bool enabled)
 {
-	if (enabled)
-		printf("\x1b[37m%-*s\x1b[0m", UI_FILTER_STATE_COLS, "ON");
-	else
-		printf("\x1b[90m%-*s\x1b[0m", UI_FILTER_STATE_COLS, "OFF");
+	ui_text_t *out = ui_grid_text();
+
+	ui_text_put_sgr(out, enabled ? UI_SGR_WHITE : UI_SGR_GREY);
+	ui_text_put_padded(out, enabled ? "ON" : "OFF", UI_FILTER_STATE_COLS);
+	ui_text_put_sgr(out, UI_SGR_RESET);
 }
 
 static void print_filter_row2(const char *label1, bool state1, const char *label2, bool state2)
 {
-	printf("\x1b[90m%-*s\x1b[0m", UI_FILTER_LABEL_COLS, label1);
+	print_padded_label(UI_FILTER_LABEL_COLS, label1);
 	print_toggle_state(state1);
 	if (label2 != NULL && label2[0] != '\0') {
-		printf("  \x1b[90m%-*s\x1b[0m", UI_FILTER_LABEL_COLS, label2);
+		ui_puts("  ");
+		print_padded_label(UI_FILTER_LABEL_COLS, label2);
 		print_toggle_state(state2);
 	}
-	printf("\n");
+	ui_puts("\n");
 }
 
-static u32 wrap_segment_length(const char *text, u32 maxCols, const char **outNext)
+/* One laid-out line; newlines inside it render as the spaces they were measured as. */
+static void print_layout_line(const char *text, const title_layout_line_t *line)
 {
-	const char *lastBreak = NULL;
-	u32 len = 0;
-	u32 segmentLen;
-
-	if (text == NULL || text[0] == '\0') {
-		*outNext = text;
-		return 0;
+	const char *cursor = text + line->offset;
+	const char *end = cursor + line->length;
+
+	while (cursor < end) {
+		const char *stop = cursor;
+
+		while (stop < end && *stop != '\n' && *stop != '\r')
+			stop++;
+		ui_grid_write(cursor, (size_t)(stop - cursor));
+		if (stop < end)
+			ui_grid_write(" ", 1);
+		cursor = stop < end ? stop + 1 : end;
 	}
-
-	while (text[len] != '\0' && len < maxCols) {
-		if (text[len] == ' ' || text[len] == ';' || text[len] == '\n' || text[len] == '\r')
-			lastBreak = text + len;
-		len++;
-	}
-
-	if (text[len] == '\0') {
-		*outNext = text + len;
-		return len;
-	}
-
-	if (lastBreak != NULL) {
-		if (*lastBreak == ';')
-			segmentLen = (u32)(lastBreak - text) + 1;
-		else
-			segmentLen = (u32)(lastBreak - text);
-		*outNext = text + segmentLen;
-		while (**outNext == ' ' || **outNext == '\n' || **outNext == '\r')
-			(*outNext)++;
-		return segmentLen;
-	}
-
-	segmentLen = maxCols;
-	while (segmentLen > 0 && ((const unsigned char)text[segmentLen] & 0xC0) == 0x80)
-		segmentLen--;
-	if (segmentLen == 0)
-		segmentLen = maxCols;
-
-	*outNext = text + segmentLen;
-	return segmentLen;
-}
-
-static void collapse_title_newlines(const char *display_name, char *out, size_t outSize)
-{
-	size_t i = 0;
-	size_t j = 0;
-
-	if (out == NULL || outSize == 0)
-		return;
-
-	out[0] = '\0';
-	if (display_name == NULL)
-		return;
-
-	while (display_name[i] != '\0' && j + 1 < outSize) {
-		if (display_name[i] == '\n' || display_name[i] == '\r')
-			out[j++] = ' ';
-		else
-			out[j++] = display_name[i];
-		i++;
-	}
-	out[j] = '\0';
 }
 
 static void print_value_column_indent(u32 cols)
 {
-	u32 i;
-
-	for (i = 0; i < cols; i++)
-		putchar(' ');
+	ui_text_put_padded(ui_grid_text(), "", cols);
 }
 
-static void print_field_inline_wrap(const char *label, const char *value)
+/* layout caches the breaks across draws; pass NULL for values formatted per draw. */
+static void print_field_inline_wrap(const char *label, const char *value, title_layout_t *layout)
 {
-	char flattened[TITLE_SMDH_LONG_NAME_UTF8_MAX];
-	const char *cursor;
-	u32 valueCols;
-	bool first = true;
+	title_layout_t scratch;
+	u32 i;
 
 	if (value == NULL || value[0] == '\0') {
-		printf("\x1b[90m%-*s\x1b[0m", (int)UI_FIELD_LABEL_COLS, label);
-		printf("\x1b[90m(unavailable)\x1b[0m\n");
+		print_padded_label(UI_FIELD_LABEL_COLS, label);
+		ui_puts("\x1b[90m(unavailable)\x1b[0m\n");
 		return;
 	}
 
-	collapse_title_newlines(value, flattened, sizeof(flattened));
-	valueCols = UI_CONSOLE_COLS - UI_FIELD_LABEL_COLS;
-	cursor = flattened;
-	while (cursor[0] != '\0') {
-		u32 take;
-		const char *next;
-
-		take = wrap_segment_length(cursor, valueCols, &next);
-		if (first) {
-			printf("\x1b[90m%-*s\x1b[0m", (int)UI_FIELD_LABEL_COLS, label);
-			printf("\x1b[37m%.*s\x1b[0m\n", (int)take, cursor);
-			first = false;
-		} else {
+	if (layout == NULL) {
+		scratch.width = 0;
+		layout = &scratch;
+	}
+	title_layout_wrap(layout, value, UI_CONSOLE_COLS - UI_FIELD_LABEL_COLS);
+
+	for (i = 0; i < layout->line_count; i++) {
+		if (i == 0)
+			print_padded_label(UI_FIELD_LABEL_COLS, label);
+		else
 			print_value_column_indent(UI_FIELD_LABEL_COLS);
-			printf("\x1b[37m%.*s\x1b[0m\n", (int)take, cursor);
-		}
-		cursor = next;
+		ui_puts("\x1b[37m");
+		print_layout_line(value, &layout->lines[i]);
+		ui_puts("\x1b[0m\n");
 	}
 }
 
@@ -278,31 +321,40 @@ static void print_smdh_status(const title_smdh_info_t *smdh)
 	print_field_inline("SMDH read", status);
 }
 
-static void print_user_page(const title_pick_t *pick)
+static void print_user_page(title_pick_t *pick)
 {
-	char title[TITLE_SMDH_LONG_NAME_UTF8_MAX];
-
-	collapse_title_newlines(pick->display_name, title, sizeof(title));
+	char publisher[TITLE_SMDH_PUBLISHER_UTF8_MAX];
+	const title_layout_t *layout = title_layout_wrap(&pick->name_layout, pick->display_name, UI_CONSOLE_COLS);
+	u32 row = UI_CONTENT_ROW_TITLE;
+	u32 i;
 
-	printf("\x1b[%d;1H\x1b[K", UI_CONTENT_ROW_TITLE);
-	printf("\x1b[37m%s\x1b[0m", title);
+	title_smdh_field(&pick->smdh, TITLE_SMDH_FIELD_PUBLISHER, publisher, sizeof(publisher));
+	for (i = 0; i < layout->line_count && i < UI_TITLE_LINES_MAX; i++) {
+		print_blank_row(row++);
+		ui_puts("\x1b[37m");
+		print_layout_line(pick->display_name, &layout->lines[i]);
+		ui_puts("\x1b[0m");
+	}
 
-	printf("\x1b[%d;1H\x1b[K", UI_CONTENT_ROW_PUBLISHER);
-	if (pick->smdh.publisher[0] != '\0')
-		printf("\x1b[90m%s\x1b[0m", pick->smdh.publisher);
+	print_blank_row(row);
+	if (publisher[0] != '\0')
+		print_colored(UI_SGR_GREY, publisher);
 
-	printf("\x1b[%d;1H\x1b[K", UI_CONTENT_ROW_GAP);
+	print_blank_row(UI_CONTENT_ROW_GAP);
 
-	printf("\x1b[%d;1H\x1b[K", UI_CONTENT_ROW_ACTIONS);
-	printf("\x1b[37mA\x1b[0m Launch   \x1b[37mY\x1b[0m Reroll");
+	print_blank_row(UI_CONTENT_ROW_ACTIONS);
+	ui_puts("\x1b[37mA\x1b[0m Launch   \x1b[37mY\x1b[0m Reroll   \x1b[37mB\x1b[0m Browse");
 
-	printf("\x1b[11;1H\x1b[K");
-	printf("\x1b[12;1H\x1b[K");
+	ui_puts("\x1b[11;1H\x1b[K");
+	ui_puts("\x1b[12;1H\x1b[K");
 }
 
 static void print_dev_details_page(const ui_view_t *view)
 {
-	const title_pick_t *pick = view->pick;
+	title_pick_t *pick = view->pick;
+	char shortName[TITLE_SMDH_SHORT_NAME_UTF8_MAX];
+	char longName[TITLE_SMDH_LONG_NAME_UTF8_MAX];
+	char publisher[TITLE_SMDH_PUBLISHER_UTF8_MAX];
 	char ratings[TITLE_SMDH_LINE_UTF8_MAX];
 	char region[TITLE_SMDH_LINE_UTF8_MAX];
 	char flags[TITLE_SMDH_LINE_UTF8_MAX];
@@ -313,35 +365,130 @@ static void print_dev_details_page(const ui_view_t *view)
 	title_smdh_format_region_lock(pick->smdh.region_lock, region, sizeof(region));
 	title_smdh_format_flags(pick->smdh.flags, flags, sizeof(flags));
 	snprintf(eula, sizeof(eula), "%u.%u", pick->smdh.eula_major, pick->smdh.eula_minor);
-	snprintf(streetpass, sizeof(streetpass), "%08lX", pick->smdh.cec_id);
+	ui_text_hex_string(streetpass, sizeof(streetpass), NULL, pick->smdh.cec_id, 8, true);
 
-	printf("\x1b[%d;1H", UI_DETAILS_CONTENT_ROW);
+	ui_text_put_move(ui_grid_text(), UI_DETAILS_CONTENT_ROW, 1);
 	print_section_header("Names", true);
 	print_field_inline("Source", name_source_label(pick->name_source));
 	if (pick->name_source == TITLE_NAME_SOURCE_CATALOG && pick->catalog_name != NULL)
 		print_field_inline("Catalog", pick->catalog_name);
-	print_field_inline("Short", pick->smdh.short_name);
-	print_field_inline_wrap("Long", pick->smdh.long_name);
-	print_field_inline("Publisher", pick->smdh.publisher);
+	print_field_inline("Short",
+		title_smdh_field(&pick->smdh, TITLE_SMDH_FIELD_SHORT_NAME, shortName, sizeof(shortName)));
+	print_field_inline_wrap("Long",
+		title_smdh_field(&pick->smdh, TITLE_SMDH_FIELD_LONG_NAME, longName, sizeof(longName)),
+		&pick->long_name_layout);
+	print_field_inline("Publisher",
+		title_smdh_field(&pick->smdh, TITLE_SMDH_FIELD_PUBLISHER, publisher, sizeof(publisher)));
 	print_smdh_status(&pick->smdh);
 
 	print_section_header("Restrictions", false);
-	print_field_inline_wrap("Ratings", ratings);
+	print_field_inline_wrap("Ratings", ratings, NULL);
 	print_field_inline("Region", region);
-	print_field_inline_wrap("Flags", flags);
+	print_field_inline_wrap("Flags", flags, NULL);
 
 	print_section_header("Other", false);
 	print_field_inline("EULA", eula);
 	print_field_inline("StreetPass ID", streetpass);
 }
 
+static const char *banner_result_label(title_banner_result_t result)
+{
+	switch (result) {
+	case TITLE_BANNER_ERR_OPEN:
+		return "no banner";
+	case TITLE_BANNER_ERR_READ:
+		return "read failed";
+	case TITLE_BANNER_ERR_NO_TEXTURE:
+		return "no texture";
+	case TITLE_BANNER_ERR_UNSUPPORTED:
+		return "unsupported texture";
+	case TITLE_BANNER_ERR_MEMORY:
+		return "out of memory";
+	default:
+		return "bad format";
+	}
+}
+
+static void print_banner_field(const title_banner_t *banner)
+{
+	char value[48];
+
+	if (banner == NULL) {
+		print_tech_field_inline_dim("Banner", "(not loaded)");
+		return;
+	}
+
+	if (banner->result != TITLE_BANNER_OK) {
+		print_tech_field_inline_dim("Banner", banner_result_label(banner->result));
+		return;
+	}
+
+	snprintf(value, sizeof(value), "%lux%lu %s, %.1f MB/s", banner->width, banner->height,
+		title_banner_format_name(banner->texture_format), (double)title_banner_decode_rate(banner));
+	print_tech_field_inline("Banner", value);
+}
+
+/* Main-loop activity over the last second: swapped frames, VBlanks skipped, CPU share. */
+static void print_frame_stats(void)
+{
+	const frame_stats_t *stats = frame_stats();
+
+	ui_printf("\x1b[90mFrames/s:\x1b[0m %lu drawn, %lu skipped  \x1b[90mCPU:\x1b[0m %lu.%lu%%\n",
+		stats->rendered, stats->skipped, stats->cpu_permille / 10, stats->cpu_permille % 10);
+}
+
+/* Startup phases as "name:ms" items after the time to first pick, on one row: the page has no
+ * row to spare, so the longest phases go first and whatever does not fit is left out. */
+static void print_startup_timings(void)
+{
+	const perf_span_t *spans[PERF_SPAN_MAX];
+	char totalText[16];
+	u32 col = UI_TECH_LABEL_COLS;
+	u32 spanCount = 0;
+	u32 total = 0;
+	u32 i;
+
+	for (i = 0; i < perf_span_count(); i++) {
+		const perf_span_t *span = perf_span_at(i);
+		u32 j;
+
+		if (span->is_mark) {
+			total = perf_span_us(span) / 1000;
+			continue;
+		}
+		if (span->end_ticks == 0)
+			continue;
+
+		/* Insertion sort by duration, longest first; equal spans keep recording order. */
+		for (j = spanCount; j > 0 && perf_span_us(spans[j - 1]) < perf_span_us(span); j--)
+			spans[j] = spans[j - 1];
+		spans[j] = span;
+		spanCount++;
+	}
+
+	col += (u32)snprintf(totalText, sizeof(totalText), "%lums", total);
+	print_padded_label(UI_TECH_LABEL_COLS, "Startup");
+	print_colored(UI_SGR_WHITE, totalText);
+
+	for (i = 0; i < spanCount; i++) {
+		char item[32];
+		u32 len = (u32)snprintf(item, sizeof(item), " %s:%lu", spans[i]->name, perf_span_us(spans[i]) / 1000);
+
+		if (col + len > UI_CONSOLE_COLS)
+			continue;
+		print_colored(UI_SGR_GREY, item);
+		col += len;
+	}
+	ui_puts("\n");
+}
+
 static void print_dev_technical_page(const ui_view_t *view)
 {
 	const title_pick_t *pick = view->pick;
 	const title_filter_options_t *filters = view->filters;
 	char titleId[32];
-	char platformCode[16];
-	char categoryCode[16];
+	char platformCode[48];
+	char categoryCode[48];
 	char uniqueId[16];
 	char variation[8];
 	char new3ds[8];
@@ -350,31 +497,31 @@ static void print_dev_technical_page(const ui_view_t *view)
 	char extdata[32];
 	char status[48];
 
-	snprintf(titleId, sizeof(titleId), "%016llx", pick->titleId);
-	snprintf(platformCode, sizeof(platformCode), "0x%04X", pick->meta.platform);
-	snprintf(categoryCode, sizeof(categoryCode), "0x%04X", pick->meta.content_category);
-	snprintf(uniqueId, sizeof(uniqueId), "0x%06lX", pick->meta.unique_id);
-	snprintf(variation, sizeof(variation), "0x%02X", pick->meta.variation);
+	ui_text_hex_string(titleId, sizeof(titleId), NULL, pick->titleId, 16, false);
+	snprintf(platformCode, sizeof(platformCode), "%s (0x%04X)", title_meta_platform_name(pick->meta.platform),
+		pick->meta.platform);
+	snprintf(categoryCode, sizeof(categoryCode), "%s (0x%04X)",
+		title_meta_category_name(pick->meta.content_category), pick->meta.content_category);
+	ui_text_hex_string(uniqueId, sizeof(uniqueId), "0x", pick->meta.unique_id, 6, true);
+	ui_text_hex_string(variation, sizeof(variation), "0x", pick->meta.variation, 2, true);
 	snprintf(new3ds, sizeof(new3ds), "%s", pick->meta.new3ds_only ? "Yes" : "No");
 
 	print_tech_field_inline("Title ID", titleId);
-	print_tech_field_inline("Platform", title_meta_platform_name(pick->meta.platform));
-	print_tech_field_inline("Platform code", platformCode);
-	print_tech_field_inline("Category", title_meta_category_name(pick->meta.content_category));
-	print_tech_field_inline("Category code", categoryCode);
+	print_tech_field_inline("Platform", platformCode);
+	print_tech_field_inline("Category", categoryCode);
 	print_tech_field_inline("Unique ID", uniqueId);
 	print_tech_field_inline("Variation", variation);
 	print_tech_field_inline("New 3DS only", new3ds);
 
-	if (pick->meta.product_code[0] != '\0')
-		print_tech_field_inline("Product code", pick->meta.product_code);
-	else if (R_FAILED(pick->meta.product_code_result)) {
-		snprintf(status, sizeof(status), "unavailable %08lX",
-			(unsigned long)pick->meta.product_code_result);
+	if (pick->meta.lazy.product_code[0] != '\0')
+		print_tech_field_inline("Product code", pick->meta.lazy.product_code);
+	else if (R_FAILED(pick->meta.lazy.product_code_result)) {
+		ui_text_hex_string(status, sizeof(status), "unavailable ", (u32)pick->meta.lazy.product_code_result, 8,
+			true);
 		print_tech_field_inline_dim("Product code", status);
 	}
 
-	printf("\n");
+	ui_puts("\n");
 
 	if (R_SUCCEEDED(pick->meta.title_info_result)) {
 		title_meta_format_version(pick->meta.version_major, pick->meta.version_minor, version, sizeof(version));
@@ -382,33 +529,34 @@ static void print_dev_technical_page(const ui_view_t *view)
 		print_tech_field_inline("Version", version);
 		print_tech_field_inline("Installed size", size);
 	} else {
-		snprintf(status, sizeof(status), "unavailable %08lX",
-			(unsigned long)pick->meta.title_info_result);
+		ui_text_hex_string(status, sizeof(status), "unavailable ", (u32)pick->meta.title_info_result, 8, true);
 		print_tech_field_inline_dim("Title info", status);
 	}
 
-	if (pick->meta.has_extdata) {
-		snprintf(extdata, sizeof(extdata), "%011llX", pick->meta.extdata_id);
+	if (pick->meta.lazy.has_extdata) {
+		ui_text_hex_string(extdata, sizeof(extdata), NULL, pick->meta.lazy.extdata_id, 11, true);
 		print_tech_field_inline("Extdata ID", extdata);
-	} else if (R_FAILED(pick->meta.extdata_result)) {
-		snprintf(status, sizeof(status), "unavailable %08lX",
-			(unsigned long)pick->meta.extdata_result);
+	} else if (R_FAILED(pick->meta.lazy.extdata_result)) {
+		ui_text_hex_string(status, sizeof(status), "unavailable ", (u32)pick->meta.lazy.extdata_result, 8, true);
 		print_tech_field_inline_dim("Extdata ID", status);
 	} else {
 		print_tech_field_inline("Extdata ID", NULL);
 	}
 
-	print_tech_field_inline("Media", pick->media == MEDIATYPE_NAND ? "NAND" : "SD");
+	print_tech_field_inline("Media", media_name(pick->media));
+	print_banner_field(view->banner);
 
-	printf("\n");
-	printf("\x1b[90mSD:\x1b[0m %lu (%s)  \x1b[90mNAND:\x1b[0m %lu (%s)\n",
-		view->sd_title_count, media_inclusion_status(view->include_sd),
-		view->nand_title_count, media_inclusion_status(view->include_nand));
-	printf("\x1b[90mScanned:\x1b[0m %lu  \x1b[90mEligible:\x1b[0m %lu\n",
+	ui_puts("\n");
+	print_source_counts(view->sources);
+	ui_printf("\x1b[90mScanned:\x1b[0m %lu  \x1b[90mEligible:\x1b[0m %lu\n",
 		view->active_title_count, view->eligible_title_count);
+	ui_printf("\x1b[90mIndexed:\x1b[0m %lu/%lu  \x1b[90mAM calls:\x1b[0m %lu\n", view->index_done_count,
+		view->index_total_count, view->am_call_count);
+	print_frame_stats();
+	print_startup_timings();
 
 	if (filters != NULL) {
-		printf("\n");
+		ui_puts("\n");
 		print_filter_row2("Native apps", filters->include_native_apps,
 			"Virtual Console", filters->include_virtual_console);
 		print_filter_row2("DSiWare", filters->include_dsiware,
@@ -417,14 +565,16 @@ static void print_dev_technical_page(const ui_view_t *view)
 			"DLC", filters->include_dlc);
 		print_filter_row2("Patches", filters->include_patches,
 			"System", filters->include_system);
-		print_filter_row2("SD titles", view->include_sd,
-			"NAND titles", view->include_nand);
-		print_filter_row2("Unlisted only", view->include_homebrew, NULL, false);
+		print_filter_row2("SD titles", view->sources[MEDIATYPE_SD].included,
+			"NAND titles", view->sources[MEDIATYPE_NAND].included);
+		print_filter_row2("Unlisted only", view->include_homebrew,
+			"Game card", view->sources[MEDIATYPE_GAME_CARD].included);
 	}
 }
 
 static void ui_draw_nav_footer(const char *nav_label)
 {
+	ui_text_t *out = ui_grid_text();
 	u32 middleLen;
 	u32 middleCol;
 	u32 versionLen;
@@ -435,120 +585,333 @@ static void ui_draw_nav_footer(const char *nav_label)
 	versionLen = 1 + (u32)strlen(APP_VERSION);
 	versionCol = UI_CONSOLE_COLS - versionLen + 1;
 
-	printf("\x1b[%d;1H" UI_INVERTED_BAR "\x1b[K", UI_CONSOLE_ROWS);
-	printf(UI_BAR_MAIN "START" UI_BAR_DIM " Exit");
-	printf("\x1b[%d;%dH" UI_INVERTED_BAR "\x1b[K", UI_CONSOLE_ROWS, (int)middleCol);
-	printf(UI_BAR_MAIN "L/R" UI_BAR_DIM " %s", nav_label);
-	printf("\x1b[%d;%dH" UI_INVERTED_BAR UI_BAR_DIM "v%s\x1b[0m", UI_CONSOLE_ROWS, (int)versionCol,
-		APP_VERSION);
+	ui_text_put_move(out, UI_CONSOLE_ROWS, 1);
+	ui_text_put(out, UI_INVERTED_BAR "\x1b[K" UI_BAR_MAIN "START" UI_BAR_DIM " Exit");
+	ui_text_put_move(out, UI_CONSOLE_ROWS, middleCol);
+	ui_text_put(out, UI_INVERTED_BAR "\x1b[K" UI_BAR_MAIN "L/R" UI_BAR_DIM " ");
+	ui_text_put(out, nav_label);
+	ui_text_put_move(out, UI_CONSOLE_ROWS, versionCol);
+	ui_text_put(out, UI_INVERTED_BAR UI_BAR_DIM "v" APP_VERSION "\x1b[0m");
 }
 
 static void print_user_controls(u32 eligible_title_count, u32 active_title_count, bool homebrew_only)
 {
-	printf("\x1b[%d;1H\x1b[K", UI_CONTROLS_ROW_FILTER_STATUS);
-	printf("\x1b[37m%lu\x1b[0m \x1b[90mof\x1b[0m \x1b[37m%lu\x1b[0m \x1b[90mtitles filtered\x1b[0m",
-		eligible_title_count, active_title_count);
+	ui_text_t *out = ui_grid_text();
+
+	print_blank_row(UI_CONTROLS_ROW_FILTER_STATUS);
+	ui_text_put(out, "\x1b[37m");
+	ui_text_put_u32(out, eligible_title_count);
+	ui_text_put(out, "\x1b[0m \x1b[90mof\x1b[0m \x1b[37m");
+	ui_text_put_u32(out, active_title_count);
+	ui_text_put(out, "\x1b[0m \x1b[90mtitles filtered\x1b[0m");
 
-	printf("\x1b[%d;1H\x1b[K", UI_CONTROLS_ROW_FILTER_ACTIONS);
-	printf("\x1b[37mSELECT\x1b[90m filters   \x1b[37mX\x1b[0m ");
+	print_blank_row(UI_CONTROLS_ROW_FILTER_ACTIONS);
+	ui_puts("\x1b[37mSELECT\x1b[90m filters   \x1b[37mX\x1b[0m ");
 	if (homebrew_only)
-		printf("\x1b[37mhomebrew only *\x1b[0m");
+		ui_puts("\x1b[37mhomebrew only *\x1b[0m");
 	else
-		printf("\x1b[90mhomebrew only\x1b[0m");
+		ui_puts("\x1b[90mhomebrew only\x1b[0m");
 
-	printf("\x1b[%d;1H\x1b[K", UI_CONTROLS_ROW_FOOTER_GAP);
+	print_blank_row(UI_CONTROLS_ROW_FOOTER_GAP);
 
-	printf("\x1b[28;1H\x1b[K");
-	printf("\x1b[29;1H\x1b[K");
+	print_blank_row(28);
+	print_blank_row(29);
 
 	ui_draw_nav_footer("Details");
 }
 
+static void print_library_page(const ui_view_t *view)
+{
+	const title_stats_t *stats = view->stats;
+	char size[32];
+	u32 coverage;
+	u32 i;
+
+	if (stats == NULL)
+		return;
+
+	coverage = title_stats_catalog_permille(stats);
+	title_meta_format_size(stats->total_size, size, sizeof(size));
+
+	ui_printf("\x1b[90mTitles:\x1b[0m \x1b[37m%lu\x1b[0m  \x1b[90mSD\x1b[0m %lu  \x1b[90mNAND\x1b[0m %lu",
+		stats->total, stats->sd_count, stats->nand_count);
+	if (stats->card_count > 0)
+		ui_printf("  \x1b[90mCard\x1b[0m %lu", stats->card_count);
+	ui_puts("\n");
+	ui_printf("\x1b[90mInstalled:\x1b[0m \x1b[37m%s\x1b[0m\n", size);
+	ui_printf("\x1b[90mCatalog coverage:\x1b[0m %lu.%lu%% (%lu of %lu)\n", coverage / 10, coverage % 10,
+		stats->catalog_count, stats->total);
+	ui_printf("\x1b[90mEligible now:\x1b[0m \x1b[37m%lu\x1b[0m of %lu\n", view->eligible_title_count,
+		view->active_title_count);
+	ui_printf("\x1b[90mApplications:\x1b[0m %lu native, %lu VC\n", stats->native_count, stats->vc_count);
+
+	ui_printf("\n\x1b[90m%-*s%7s  %s\x1b[0m\n", (int)UI_TECH_LABEL_COLS, "Category", "Titles", "Size");
+	for (i = 0; i < TITLE_CLASS_COUNT; i++) {
+		u32 cls = 1u << i;
+
+		if (stats->class_counts[i] == 0)
+			continue;
+
+		title_meta_format_size(stats->class_sizes[i], size, sizeof(size));
+		ui_printf("\x1b[90m%-*s\x1b[37m%7lu\x1b[0m  %s\n", (int)UI_TECH_LABEL_COLS,
+			title_meta_class_name(cls), stats->class_counts[i], size);
+	}
+
+	ui_puts("\n\x1b[90mPlatforms:\x1b[0m");
+	for (i = 0; i < TITLE_STATS_PLATFORM_MAX; i++) {
+		if (stats->platform_counts[i] == 0)
+			continue;
+		ui_printf(" %s \x1b[37m%lu\x1b[0m", title_meta_platform_name((u16)i), stats->platform_counts[i]);
+	}
+	ui_puts("\n");
+}
+
+static bool ui_banner_drawable(const title_banner_t *banner)
+{
+	return banner != NULL && banner->result == TITLE_BANNER_OK && banner->pixels != NULL &&
+		banner->width <= UI_BOTTOM_WIDTH && banner->height <= UI_BOTTOM_HEIGHT;
+}
+
+/* What the bottom screen shows, so a present only redraws it when the image changes. */
+static bool g_pickImageDrawn = false;
+static u64 g_pickImageTitleId = 0;
+static bool g_pickImageBanner = false;
+
+static void ui_draw_pick_image(const ui_view_t *view)
+{
+	static u16 pixels[TITLE_ICON_LARGE_DIM * TITLE_ICON_LARGE_DIM];
+	const title_pick_t *pick = view->pick;
+	const title_banner_t *banner = view->banner;
+	bool showBanner = ui_banner_drawable(banner);
+	u32 outDim = TITLE_ICON_LARGE_DIM * UI_ICON_SCALE;
+
+	if (g_pickImageDrawn && g_pickImageTitleId == pick->titleId && g_pickImageBanner == showBanner)
+		return;
+
+	g_pickImageDrawn = true;
+	g_pickImageTitleId = pick->titleId;
+	g_pickImageBanner = showBanner;
+	title_icon_clear_bottom(0x0000);
+
+	if (showBanner) {
+		title_icon_draw_bottom(banner->pixels, banner->width, banner->height,
+			(UI_BOTTOM_WIDTH - banner->width) / 2, (UI_BOTTOM_HEIGHT - banner->height) / 2, 1);
+		return;
+	}
+
+	if (!pick->icon.loaded)
+		return;
+
+	title_icon_decode_rgb565(pick->icon.large, TITLE_ICON_LARGE_DIM, pixels);
+	title_icon_draw_bottom(pixels, TITLE_ICON_LARGE_DIM, TITLE_ICON_LARGE_DIM,
+		(UI_BOTTOM_WIDTH - outDim) / 2, (UI_BOTTOM_HEIGHT - outDim) / 2, UI_ICON_SCALE);
+}
+
+void ui_invalidate_pick_image(void)
+{
+	g_pickImageDrawn = false;
+}
+
+void ui_draw_browser(const char *const *names, u32 name_count, u32 first, u32 cursor, u32 total, u32 draw_us,
+	const char *query, s32 wheel)
+{
+	u16 *fb = (u16 *)gfxGetFramebuffer(GFX_BOTTOM, GFX_LEFT, NULL, NULL);
+	u32 cols = UI_BOTTOM_WIDTH / UI_FONT_CELL_PX;
+	u32 wheelLength = (u32)strlen(UI_BROWSER_WHEEL);
+	char title[48];
+	char text[48];
+	u32 row;
+	u32 i;
+
+	if (fb == NULL)
+		return;
+
+	snprintf(text, sizeof(text), "%lu/%lu", total > 0 ? cursor + 1 : 0, total);
+	if (query != NULL)
+		snprintf(title, sizeof(title), " Find: %s%s", query, wheel >= 0 ? "_" : "");
+	else
+		snprintf(title, sizeof(title), " Browse");
+	ui_font_draw_text(fb, UI_BOTTOM_WIDTH, 0, 0, cols - (u32)strlen(text) - 1, title, 0, 7);
+	ui_font_draw_text(fb, UI_BOTTOM_WIDTH, 0, cols - (u32)strlen(text) - 1, (u32)strlen(text) + 1, text, 0, 7);
+
+	for (row = 0; row < UI_BROWSER_ROWS; row++) {
+		bool selected = first + row == cursor;
+		const char *name = row < name_count ? names[row] : "";
+
+		ui_font_draw_text(fb, UI_BOTTOM_WIDTH, row + 1, 0, 1, "", 7, selected ? 7 : 0);
+		ui_font_draw_text(fb, UI_BOTTOM_WIDTH, row + 1, 1, cols - 1, name, selected ? 0 : 7, selected ? 7 : 0);
+	}
+
+	if (wheel >= 0) {
+		/* Space shows as '_' so it can be seen and tapped. */
+		for (i = 0; i < wheelLength && i < cols; i++) {
+			char c[2] = { UI_BROWSER_WHEEL[i] == ' ' ? '_' : UI_BROWSER_WHEEL[i], '\0' };
+
+			ui_font_draw_text(fb, UI_BOTTOM_WIDTH, UI_BROWSER_ROWS + 1, i, 1, c, i == (u32)wheel ? 0 : 7,
+				i == (u32)wheel ? 14 : 0);
+		}
+		if (wheelLength < cols)
+			ui_font_draw_text(fb, UI_BOTTOM_WIDTH, UI_BROWSER_ROWS + 1, wheelLength, cols - wheelLength, "", 8, 0);
+	} else {
+		snprintf(text, sizeof(text), "%lu.%lums", draw_us / 1000, (draw_us / 100) % 10);
+		ui_font_draw_text(fb, UI_BOTTOM_WIDTH, UI_BROWSER_ROWS + 1, 0, cols - (u32)strlen(text),
+			" A Pick  B Back  Y Find", 8, 0);
+		ui_font_draw_text(fb, UI_BOTTOM_WIDTH, UI_BROWSER_ROWS + 1, cols - (u32)strlen(text), (u32)strlen(text),
+			text, 8, 0);
+	}
+
+	gfxFlushBuffers();
+	g_pickImageDrawn = false;
+}
+
 void ui_draw_header(void)
 {
 	const char *byline = "by selloa";
 	u32 bylineCol = UI_CONSOLE_COLS - (u32)strlen(byline) + 1;
 
-	consoleClear();
-	printf("\x1b[1;1H" UI_INVERTED_BAR "\x1b[K");
-	printf(UI_BAR_MAIN "RANDOM GAME LAUNCHER (2026)");
-	printf("\x1b[1;%dH" UI_INVERTED_BAR UI_BAR_DIM "%s\x1b[0m\n", (int)bylineCol, byline);
+	ui_text_t *out;
+
+	ui_grid_clear();
+	out = ui_grid_text();
+	ui_text_put(out, "\x1b[1;1H" UI_INVERTED_BAR "\x1b[K" UI_BAR_MAIN "RANDOM GAME LAUNCHER (2026)");
+	ui_text_put_move(out, 1, bylineCol);
+	ui_text_put(out, UI_INVERTED_BAR UI_BAR_DIM);
+	ui_text_put(out, byline);
+	ui_text_put(out, "\x1b[0m\n");
 }
 
-void ui_draw_main_screen(const ui_view_t *view)
+static void print_main_screen(const ui_view_t *view)
 {
-	if (view == NULL || view->pick == NULL)
-		return;
-
 	ui_draw_header();
 	print_page_tabs(view->page);
 
 	switch (view->page) {
-	case 0:
+	case UI_PAGE_GAME:
 		print_user_page(view->pick);
 		break;
-	case 1:
+	case UI_PAGE_DETAILS:
 		print_dev_details_page(view);
 		break;
-	case 2:
+	case UI_PAGE_TECHNICAL:
 		print_dev_technical_page(view);
 		break;
+	case UI_PAGE_LIBRARY:
+		print_library_page(view);
+		break;
 	default:
 		break;
 	}
 
-	if (view->page == 0)
+	if (view->page == UI_PAGE_GAME)
 		print_user_controls(view->eligible_title_count, view->active_title_count,
 			view->include_homebrew);
 	else
 		ui_draw_nav_footer("Change page");
 }
 
-void ui_draw_filter_menu(u32 cursor, u32 row_count, u32 eligible_count,
+void ui_layout_main_screen(const ui_view_t *view, ui_grid_t *grid)
+{
+	if (view == NULL || view->pick == NULL || grid == NULL)
+		return;
+
+	ui_grid_set_target(grid);
+	print_main_screen(view);
+	ui_grid_set_target(NULL);
+}
+
+void ui_present_main_screen(const ui_view_t *view, const ui_grid_t *grid)
+{
+	if (view == NULL || view->pick == NULL || grid == NULL)
+		return;
+
+	ui_grid_show(grid);
+	ui_draw_pick_image(view);
+}
+
+void ui_draw_filter_menu(u32 cursor, u32 row_count, u32 eligible_count, bool eligible_known,
 	ui_filter_row_enabled_fn row_enabled, ui_filter_row_label_fn row_label,
-	ui_filter_row_is_action_fn row_is_action)
+	ui_filter_row_is_action_fn row_is_action, ui_filter_row_delta_fn row_delta)
 {
+	ui_text_t *out;
 	u32 row;
 
-	consoleClear();
-	printf("\n\x1b[37mOptions\x1b[0m\n");
-	printf("\x1b[90mPool:\x1b[0m \x1b[37m%lu pickable titles\x1b[0m\n\n", eligible_count);
+	ui_grid_clear();
+	ui_puts("\n\x1b[37mOptions\x1b[0m\n");
+	ui_printf("\x1b[90mPool:\x1b[0m \x1b[37m%lu%s pickable titles\x1b[0m\n\n", eligible_count,
+		eligible_known ? "" : "+");
+	out = ui_grid_text();
 
 	for (row = 0; row < row_count; row++) {
 		if (row == 0)
-			printf("\x1b[90mContent types\x1b[0m\n");
+			ui_puts("\x1b[90mContent types\x1b[0m\n");
 		else if (row == 8)
-			printf("\n\x1b[90mSources\x1b[0m\n");
-		else if (row == 10)
-			printf("\n\x1b[90mOther\x1b[0m\n");
+			ui_puts("\n\x1b[90mSources\x1b[0m\n");
+		else if (row == 11)
+			ui_puts("\n\x1b[90mOther\x1b[0m\n");
 
 		if (row == cursor)
-			printf("\x1b[37m> ");
+			ui_puts("\x1b[37m> ");
 		else
-			printf("  ");
+			ui_puts("  ");
 
 		if (row_is_action != NULL && row_is_action(row)) {
-			printf("%s\x1b[0m\n", row_label(row));
+			ui_text_put(out, row_label(row));
 		} else {
-			printf("%-16s %s\x1b[0m\n", row_label(row),
-				row_enabled(row) ? "\x1b[37mON" : "\x1b[90mOFF");
+			s32 delta;
+
+			ui_text_put_padded(out, row_label(row), UI_MENU_LABEL_COLS);
+			ui_text_put(out, row_enabled(row) ? " \x1b[37mON " : " \x1b[90mOFF");
+			/* What pressing A here would do to the pool. */
+			if (row_delta != NULL && row_delta(row, &delta)) {
+				ui_text_put(out, "  \x1b[90m");
+				if (delta == UI_FILTER_DELTA_UNKNOWN) {
+					ui_text_put_char(out, '?');
+				} else {
+					ui_text_put_char(out, delta < 0 ? '-' : '+');
+					ui_text_put_u32(out, delta < 0 ? (u32)-delta : (u32)delta);
+				}
+			}
 		}
+		ui_text_put(out, "\x1b[0m\n");
 	}
 
-	printf("\n\x1b[90mUp/Down  A toggle/apply  B/SELECT close\x1b[0m\n");
+	ui_puts("\n\x1b[90mUp/Down  A toggle/apply  B/SELECT close\x1b[0m\n");
+}
+
+void ui_draw_scan_progress(const title_scan_job_t *jobs, u32 job_count)
+{
+	u32 i;
+
+	ui_draw_header();
+	ui_puts("\nScanning library...\n\n");
+
+	for (i = 0; i < job_count; i++) {
+		const title_scan_job_t *job = &jobs[i];
+
+		ui_printf("\x1b[90m%-10s\x1b[0m ", media_name(job->media));
+		switch (job->stage) {
+		case TITLE_SCAN_JOB_LISTING:
+			ui_puts("listing titles\n");
+			break;
+		case TITLE_SCAN_JOB_INFO:
+			ui_printf("%lu/%lu titles\n", job->info_done, job->scan->count);
+			break;
+		default:
+			ui_printf("\x1b[37m%lu titles\x1b[0m\n", job->scan->count);
+			break;
+		}
+	}
 }
 
-void ui_draw_empty_pool_message(u32 sd_count, u32 nand_count, bool include_sd, bool include_nand,
-	bool suggest_sources)
+void ui_draw_empty_pool_message(const ui_source_t *sources, bool suggest_sources)
 {
 	ui_draw_header();
-	printf("\nNo titles match these filters.\n\n");
-	printf("\x1b[90mSD:\x1b[0m %lu (%s)  \x1b[90mNAND:\x1b[0m %lu (%s)\n\n",
-		sd_count, media_inclusion_status(include_sd),
-		nand_count, media_inclusion_status(include_nand));
-	printf("Try \x1b[90mSELECT\x1b[0m Options");
+	ui_puts("\nNo titles match these filters.\n\n");
+	print_source_counts(sources);
+	ui_puts("\n");
+	ui_puts("Try \x1b[90mSELECT\x1b[0m Options");
 	if (suggest_sources)
-		printf(" and enable SD or NAND sources");
-	printf(".\n\n");
-	printf("\x1b[90mSELECT\x1b[0m Options   \x1b[90mSTART\x1b[0m Exit\n");
+		ui_puts(" and enable SD or NAND sources");
+	ui_puts(".\n\n");
+	ui_puts("\x1b[90mSELECT\x1b[0m Options   \x1b[90mSTART\x1b[0m Exit\n");
 }
@@ -6,36 +6,89 @@
 
 #include <3ds.h>
 
+#include "title_banner.h"
 #include "title_meta.h"
 #include "title_picker.h"
+#include "title_scan.h"
+#include "title_stats.h"
+#include "ui_grid.h"
 
-#define UI_PAGE_COUNT 3
+/* Pages L/R cycles through, in tab order. */
+typedef enum {
+	UI_PAGE_GAME = 0,
+	UI_PAGE_DETAILS,
+	UI_PAGE_TECHNICAL,
+	UI_PAGE_LIBRARY,
+	UI_PAGE_COUNT,
+} ui_page_t;
+
+/* Title sources, indexed by FS_MediaType (NAND, SD, game card). */
+#define UI_SOURCE_COUNT 3
+
+typedef struct {
+	u32 title_count;
+	bool included;
+	/* False until the media has been listed; its title count is unknown until then. */
+	bool scanned;
+} ui_source_t;
 
 typedef struct {
-	const title_pick_t *pick;
+	/* Non-const: the GAME and DETAILS pages cache their name layouts on the pick. */
+	title_pick_t *pick;
 	u32 page;
-	u32 sd_title_count;
-	u32 nand_title_count;
+	ui_source_t sources[UI_SOURCE_COUNT];
 	u32 active_title_count;
 	u32 eligible_title_count;
-	bool include_sd;
-	bool include_nand;
 	bool include_homebrew;
 	const title_filter_options_t *filters;
+	u32 index_done_count;
+	u32 index_total_count;
+	u32 am_call_count;
+	/* NULL until the banner is loaded (DETAILS/TECHNICAL pages only). */
+	const title_banner_t *banner;
+	const title_stats_t *stats;
 } ui_view_t;
 
+/* Bottom-screen browser: 40x30 cells, a header row, the list, a footer row. */
+#define UI_BROWSER_ROWS 28
+#define UI_BROWSER_ROW_PX 8
+/* Letter wheel shown on the footer row while searching; one cell per character. */
+#define UI_BROWSER_WHEEL "abcdefghijklmnopqrstuvwxyz0123456789 "
+
 typedef bool (*ui_filter_row_enabled_fn)(u32 row);
 typedef const char *(*ui_filter_row_label_fn)(u32 row);
 typedef bool (*ui_filter_row_is_action_fn)(u32 row);
+/// How many titles toggling the row would add (positive) or remove; false for rows that do not
+/// change the pool. UI_FILTER_DELTA_UNKNOWN when a media would have to be listed first.
+typedef bool (*ui_filter_row_delta_fn)(u32 row, s32 *delta);
+
+#define UI_FILTER_DELTA_UNKNOWN INT32_MIN
 
 void ui_draw_header(void);
-void ui_draw_main_screen(const ui_view_t *view);
+/// Lay out view->page's text into grid without touching the console or the bottom screen.
+void ui_layout_main_screen(const ui_view_t *view, ui_grid_t *grid);
 
-void ui_draw_filter_menu(u32 cursor, u32 row_count, u32 eligible_count,
+/// Show a laid-out page (copied to the console at the next flush) and the pick's bottom-screen image.
+void ui_present_main_screen(const ui_view_t *view, const ui_grid_t *grid);
+
+/// eligible_known is false while an included media has not been listed (the count is a lower bound).
+void ui_draw_filter_menu(u32 cursor, u32 row_count, u32 eligible_count, bool eligible_known,
 	ui_filter_row_enabled_fn row_enabled, ui_filter_row_label_fn row_label,
-	ui_filter_row_is_action_fn row_is_action);
+	ui_filter_row_is_action_fn row_is_action, ui_filter_row_delta_fn row_delta);
+
+/// Pool browser on the bottom screen. names is the visible window only (name_count <= UI_BROWSER_ROWS),
+/// starting at list position first; draw_us is the previous draw's cost, shown in the footer.
+/// A non-NULL query (the list is filtered) shows in the header; while typing (wheel >= 0) the footer
+/// shows the letter wheel with UI_BROWSER_WHEEL[wheel] highlighted.
+void ui_draw_browser(const char *const *names, u32 name_count, u32 first, u32 cursor, u32 total, u32 draw_us,
+	const char *query, s32 wheel);
+
+/// Something else drew on the bottom screen: the next present redraws the pick's image.
+void ui_invalidate_pick_image(void);
+
+/// Cold-start progress, one line per media being scanned.
+void ui_draw_scan_progress(const title_scan_job_t *jobs, u32 job_count);
 
-void ui_draw_empty_pool_message(u32 sd_count, u32 nand_count, bool include_sd, bool include_nand,
-	bool suggest_sources);
+void ui_draw_empty_pool_message(const ui_source_t *sources, bool suggest_sources);
 
 #endif
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "ui_capture.h"
+
+#include <string.h>
+
+#include "ui_text.h"
+
+static ui_grid_t g_screen;
+/* The same parser the grid draws with, so the screen reads the stream like the pages wrote it. */
+static ui_grid_parser_t g_parser;
+static ui_capture_counters_t g_counters;
+
+static void capture_sink(const char *data, size_t size)
+{
+	ui_grid_parser_feed(&g_parser, data, size);
+}
+
+void ui_capture_begin(void)
+{
+	ui_grid_parser_reset(&g_parser, &g_screen);
+	ui_grid_parser_clear(&g_parser);
+	memset(&g_counters, 0, sizeof(g_counters));
+	ui_grid_set_sink(capture_sink);
+	ui_grid_invalidate();
+}
+
+void ui_capture_end(void)
+{
+	ui_grid_set_sink(NULL);
+	ui_grid_invalidate();
+}
+
+void ui_capture_flush(void)
+{
+	const ui_grid_stats_t *flush;
+
+	ui_grid_flush();
+	flush = ui_grid_last_flush();
+
+	g_counters.flushes++;
+	if (flush->cells > 0)
+		g_counters.redraws++;
+	g_counters.cells += flush->cells;
+	g_counters.bytes += flush->bytes;
+	g_counters.writes += flush->writes;
+	g_counters.clears += flush->clears;
+	g_counters.moves += g_parser.moves;
+	g_parser.moves = 0;
+}
+
+void ui_capture_reset_counters(void)
+{
+	memset(&g_counters, 0, sizeof(g_counters));
+	g_parser.moves = 0;
+}
+
+const ui_capture_counters_t *ui_capture_counters(void)
+{
+	return &g_counters;
+}
+
+const ui_grid_t *ui_capture_screen(void)
+{
+	return &g_screen;
+}
+
+u32 ui_capture_hash(void)
+{
+	u32 hash = 2166136261u;
+	u32 r;
+	u32 c;
+
+	for (r = 0; r < UI_GRID_ROWS; r++) {
+		for (c = 0; c < UI_GRID_COLS; c++) {
+			const ui_grid_cell_t *cell = &g_screen.cells[r][c];
+
+			hash = (hash ^ (cell->glyph & 0xFF)) * 16777619u;
+			hash = (hash ^ (cell->glyph >> 8)) * 16777619u;
+			hash = (hash ^ cell->fg) * 16777619u;
+			hash = (hash ^ cell->bg) * 16777619u;
+		}
+	}
+	return hash;
+}
+
+static void dump_glyph(ui_text_t *text, u16 cp)
+{
+	if (cp == UI_GRID_WIDE_TAIL)
+		return;
+
+	if (cp < 0x80) {
+		ui_text_put_char(text, (char)cp);
+	} else if (cp < 0x800) {
+		ui_text_put_char(text, (char)(0xC0 | (cp >> 6)));
+		ui_text_put_char(text, (char)(0x80 | (cp & 0x3F)));
+	} else {
+		ui_text_put_char(text, (char)(0xE0 | (cp >> 12)));
+		ui_text_put_char(text, (char)(0x80 | ((cp >> 6) & 0x3F)));
+		ui_text_put_char(text, (char)(0x80 | (cp & 0x3F)));
+	}
+}
+
+size_t ui_capture_dump(char *out, size_t size, bool colors)
+{
+	ui_text_t text;
+	u32 r;
+	u32 c;
+
+	if (out == NULL || size == 0)
+		return 0;
+
+	ui_text_init(&text, out, size - 1, NULL);
+	for (r = 0; r < UI_GRID_ROWS; r++) {
+		for (c = 0; c < UI_GRID_COLS; c++)
+			dump_glyph(&text, g_screen.cells[r][c].glyph);
+		ui_text_put_char(&text, '\n');
+	}
+
+	if (colors) {
+		ui_text_put_char(&text, '\n');
+		for (r = 0; r < UI_GRID_ROWS; r++) {
+			for (c = 0; c < UI_GRID_COLS; c++)
+				ui_text_put_hex(&text, g_screen.cells[r][c].fg, 1, false);
+			ui_text_put_char(&text, ' ');
+			for (c = 0; c < UI_GRID_COLS; c++)
+				ui_text_put_hex(&text, g_screen.cells[r][c].bg, 1, false);
+			ui_text_put_char(&text, '\n');
+		}
+	}
+
+	out[text.length] = '\0';
+	return text.length;
+}
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef UI_CAPTURE_H
+#define UI_CAPTURE_H
+
+#include <3ds.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ui_grid.h"
+
+/*
+ * Headless stand-in for the console: while capturing, flushes go to a sink that interprets the
+ * escape stream with ui_grid's parser into its own 30x50 cell screen instead of the libctru
+ * console. Lets a host build check every page against a golden dump and count what each
+ * interaction costs, without hardware.
+ */
+
+/// Totals since ui_capture_begin() or the last ui_capture_reset_counters().
+typedef struct {
+	u32 flushes;
+	/* Flushes that changed at least one cell. */
+	u32 redraws;
+	/* Cells overwritten on the screen. */
+	u32 cells;
+	u32 bytes;
+	u32 writes;
+	u32 clears;
+	/* Cursor moves in the flushed stream: one per run of changed cells. */
+	u32 moves;
+} ui_capture_counters_t;
+
+/// Route flushes into the capture screen (blank, default colors) and zero the counters. The
+/// grid is invalidated, so the next flush repaints every cell.
+void ui_capture_begin(void);
+
+/// Back to the console; the grid is invalidated so the next flush repaints it.
+void ui_capture_end(void);
+
+/// ui_grid_flush() plus counting. Use it in place of frame_next() when driving the UI headless.
+void ui_capture_flush(void);
+
+/// Start a new interaction (e.g. one key press).
+void ui_capture_reset_counters(void);
+
+const ui_capture_counters_t *ui_capture_counters(void);
+
+/// What the console would show after the last flush.
+const ui_grid_t *ui_capture_screen(void);
+
+/// FNV-1a over every cell (glyph and colors); equal screens hash equal.
+u32 ui_capture_hash(void);
+
+/// Screen as text for golden files: UI_GRID_ROWS lines of UTF-8, then, with colors, a blank line
+/// and one line per row of fg and bg as hex digits ("<fg x50> <bg x50>"). NUL-terminated and
+/// truncated to fit; returns the length.
+size_t ui_capture_dump(char *out, size_t size, bool colors);
+
+#endif
@@ -0,0 +1,283 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "ui_font.h"
+
+#include <3ds/util/utf.h>
+#include <string.h>
+
+#include "title_layout.h"
+
+#define FONT_FB_ROWS (UI_FONT_FB_HEIGHT / UI_FONT_CELL_PX)
+/* Set in every stored key so a zeroed slot never matches. */
+#define FONT_KEY_VALID 0x80000000u
+/* GPU_A4: the shared font's sheets are 4-bit alpha. */
+#define FONT_SHEET_FORMAT_A4 0xB
+
+typedef struct {
+	u32 key;
+	bool drawn;
+	u8 columns;
+	/* One run per screen column, already in framebuffer order (bottom pixel first). */
+	u16 pixels[UI_FONT_WIDE_PX][UI_FONT_CELL_PX];
+} font_slot_t;
+
+/* libctru console palette (colorTable in console.c), RGB565. */
+static const u16 s_palette[16] = {
+	0x0000, 0x8000, 0x0400, 0x8400, 0x0010, 0x8010, 0x0410, 0xC618,
+	0x8410, 0xF800, 0x07E0, 0xFFE0, 0x001F, 0xF81F, 0x07FF, 0xFFFF,
+};
+
+static font_slot_t g_cache[UI_FONT_CACHE_SETS][UI_FONT_CACHE_WAYS];
+/* Way to replace next in each set: the one used least recently. */
+static u8 g_victim[UI_FONT_CACHE_SETS];
+static ui_font_raster_fn g_raster = NULL;
+static ui_font_stats_t g_stats;
+/* -1 until fontEnsureMapped() has been tried, then 0 or 1. */
+static s8 g_systemFont = -1;
+
+u32 ui_font_columns(u32 cp)
+{
+	return title_layout_codepoint_columns(cp) == 2 ? 2 : 1;
+}
+
+static bool system_font_ready(void)
+{
+	if (g_systemFont < 0)
+		g_systemFont = R_SUCCEEDED(fontEnsureMapped()) && fontGetSystemFont() != NULL ? 1 : 0;
+	return g_systemFont > 0;
+}
+
+/* One 4-bit texel of a tiled sheet; textures are stored bottom row first, Morton order per 8x8 tile. */
+static u8 sheet_alpha(const u8 *sheet, u32 sheetWidth, u32 sheetHeight, u32 x, u32 y)
+{
+	u32 ty = sheetHeight - 1 - y;
+	u32 tx = x & 7;
+	u32 iy = ty & 7;
+	u32 morton = (tx & 1) | ((iy & 1) << 1) | ((tx & 2) << 1) | ((iy & 2) << 2) | ((tx & 4) << 2) |
+		((iy & 4) << 3);
+	u32 texel = ((ty >> 3) * (sheetWidth >> 3) + (x >> 3)) * 64 + morton;
+	u8 byte = sheet[texel >> 1];
+
+	return (texel & 1) ? (u8)(byte >> 4) : (u8)(byte & 0x0F);
+}
+
+static bool raster_system(u32 codepoint, u8 *coverage, u32 width, u32 height)
+{
+	CFNT_s *font;
+	TGLP_s *tglp;
+	charWidthInfo_s *cwi;
+	const u8 *sheet;
+	int index;
+	u32 perSheet;
+	u32 slot;
+	u32 cellX;
+	u32 cellY;
+	s32 boxX;
+	u32 boxW;
+	u32 ox;
+	u32 oy;
+
+	if (!system_font_ready())
+		return false;
+
+	font = fontGetSystemFont();
+	index = fontGlyphIndexFromCodePoint(font, codepoint);
+	if (index < 0 || index == font->finf.alterCharIndex)
+		return false;
+
+	tglp = fontGetGlyphInfo(font);
+	cwi = fontGetCharWidthInfo(font, index);
+	if (tglp == NULL || cwi == NULL || tglp->sheetFmt != FONT_SHEET_FORMAT_A4)
+		return false;
+
+	perSheet = (u32)tglp->nRows * tglp->nLines;
+	sheet = (const u8 *)fontGetGlyphSheetTex(font, index / (int)perSheet);
+	if (sheet == NULL)
+		return false;
+
+	/* Glyph cells sit on a grid with a one-pixel border (see fontCalcGlyphPos). */
+	slot = (u32)index % perSheet;
+	cellX = (slot % tglp->nRows) * (tglp->cellWidth + 1u) + 1;
+	cellY = (slot / tglp->nRows) * (tglp->cellHeight + 1u) + 1;
+	/* Scale the advance box (bearing included) so narrow glyphs keep their spacing. */
+	boxX = -(s32)cwi->left;
+	boxW = cwi->charWidth > 0 ? cwi->charWidth : tglp->cellWidth;
+
+	for (oy = 0; oy < height; oy++) {
+		u32 y0 = oy * tglp->cellHeight / height;
+		u32 y1 = (oy + 1) * tglp->cellHeight / height;
+
+		if (y1 <= y0)
+			y1 = y0 + 1;
+
+		for (ox = 0; ox < width; ox++) {
+			s32 x0 = boxX + (s32)(ox * boxW / width);
+			s32 x1 = boxX + (s32)((ox + 1) * boxW / width);
+			u32 sum = 0;
+			u32 count = 0;
+			u32 y;
+			s32 x;
+
+			if (x1 <= x0)
+				x1 = x0 + 1;
+
+			for (y = y0; y < y1; y++) {
+				for (x = x0; x < x1; x++) {
+					count++;
+					if (x >= 0 && x < cwi->glyphWidth)
+						sum += sheet_alpha(sheet, tglp->sheetWidth, tglp->sheetHeight,
+							cellX + (u32)x, cellY + y);
+				}
+			}
+
+			/* A4 to 0-255, doubled: one-pixel strokes would otherwise fade to grey at this scale. */
+			sum = sum * 17 * 2 / count;
+			coverage[oy * width + ox] = (u8)(sum > 255 ? 255 : sum);
+		}
+	}
+
+	return true;
+}
+
+static u16 blend_rgb565(u16 bg, u16 fg, u32 alpha)
+{
+	u32 r = ((bg >> 11) * (255 - alpha) + (fg >> 11) * alpha) / 255;
+	u32 g = (((bg >> 5) & 0x3F) * (255 - alpha) + ((fg >> 5) & 0x3F) * alpha) / 255;
+	u32 b = ((bg & 0x1F) * (255 - alpha) + (fg & 0x1F) * alpha) / 255;
+
+	return (u16)((r << 11) | (g << 5) | b);
+}
+
+static void slot_fill(font_slot_t *slot, u32 key, u32 codepoint, u8 fg, u8 bg)
+{
+	u8 coverage[UI_FONT_CELL_PX * UI_FONT_WIDE_PX];
+	ui_font_raster_fn raster = g_raster != NULL ? g_raster : raster_system;
+	u32 width;
+	u32 x;
+	u32 y;
+
+	slot->key = key;
+	slot->columns = (u8)ui_font_columns(codepoint);
+	width = slot->columns * UI_FONT_CELL_PX;
+
+	memset(coverage, 0, sizeof(coverage));
+	slot->drawn = raster(codepoint, coverage, width, UI_FONT_CELL_PX);
+	if (!slot->drawn)
+		g_stats.missing++;
+
+	for (x = 0; x < width; x++) {
+		for (y = 0; y < UI_FONT_CELL_PX; y++) {
+			slot->pixels[x][UI_FONT_CELL_PX - 1 - y] = blend_rgb565(s_palette[bg & 15], s_palette[fg & 15],
+				coverage[y * width + x]);
+		}
+	}
+}
+
+static const font_slot_t *cache_lookup(u32 codepoint, u8 fg, u8 bg)
+{
+	u32 key = FONT_KEY_VALID | (codepoint & 0x1FFFFF) | ((u32)(fg & 15) << 21) | ((u32)(bg & 15) << 25);
+	u32 set = (codepoint ^ (codepoint >> 7) ^ ((u32)fg * 5) ^ ((u32)bg * 11)) % UI_FONT_CACHE_SETS;
+	font_slot_t *ways = g_cache[set];
+	u32 way;
+
+	for (way = 0; way < UI_FONT_CACHE_WAYS; way++) {
+		if (ways[way].key == key) {
+			g_stats.hits++;
+			g_victim[set] = (u8)((way + 1) % UI_FONT_CACHE_WAYS);
+			return &ways[way];
+		}
+	}
+
+	g_stats.misses++;
+	way = g_victim[set];
+	g_victim[set] = (u8)((way + 1) % UI_FONT_CACHE_WAYS);
+	slot_fill(&ways[way], key, codepoint, fg, bg);
+	return &ways[way];
+}
+
+void ui_font_set_raster(ui_font_raster_fn raster)
+{
+	g_raster = raster;
+	memset(g_cache, 0, sizeof(g_cache));
+	memset(g_victim, 0, sizeof(g_victim));
+}
+
+/* Top-left pixel run of cell (row, col): screen column x is a run of UI_FONT_FB_HEIGHT pixels. */
+static u16 *cell_origin(u16 *fb, u32 row, u32 col)
+{
+	return fb + col * UI_FONT_CELL_PX * UI_FONT_FB_HEIGHT + (UI_FONT_FB_HEIGHT - (row + 1) * UI_FONT_CELL_PX);
+}
+
+static void fill_cells(u16 *fb, u32 row, u32 col, u32 cells, u8 bg)
+{
+	u16 *dst = cell_origin(fb, row, col);
+	u16 color = s_palette[bg & 15];
+	u32 x;
+	u32 y;
+
+	for (x = 0; x < cells * UI_FONT_CELL_PX; x++) {
+		for (y = 0; y < UI_FONT_CELL_PX; y++)
+			dst[y] = color;
+		dst += UI_FONT_FB_HEIGHT;
+	}
+}
+
+bool ui_font_draw(u16 *fb, u32 fbWidth, u32 row, u32 col, u32 codepoint, u8 fg, u8 bg)
+{
+	const font_slot_t *slot;
+	u32 x;
+	u16 *dst;
+
+	if (fb == NULL || row >= FONT_FB_ROWS || (col + ui_font_columns(codepoint)) * UI_FONT_CELL_PX > fbWidth)
+		return false;
+
+	slot = cache_lookup(codepoint, fg, bg);
+	if (!slot->drawn)
+		return false;
+
+	dst = cell_origin(fb, row, col);
+	for (x = 0; x < slot->columns * UI_FONT_CELL_PX; x++) {
+		memcpy(dst, slot->pixels[x], sizeof(slot->pixels[x]));
+		dst += UI_FONT_FB_HEIGHT;
+	}
+
+	return true;
+}
+
+u32 ui_font_draw_text(u16 *fb, u32 fbWidth, u32 row, u32 col, u32 cols, const char *text, u8 fg, u8 bg)
+{
+	const u8 *in = (const u8 *)text;
+	u32 used = 0;
+
+	if (fb == NULL || row >= FONT_FB_ROWS || (col + cols) * UI_FONT_CELL_PX > fbWidth)
+		return 0;
+
+	while (in != NULL && *in != '\0') {
+		uint32_t cp;
+		ssize_t consumed = decode_utf8(&cp, in);
+		u32 width;
+
+		if (consumed <= 0) {
+			cp = '?';
+			consumed = 1;
+		}
+		width = ui_font_columns(cp);
+		if (used + width > cols)
+			break;
+
+		if (cp == ' ' || !ui_font_draw(fb, fbWidth, row, col + used, cp, fg, bg))
+			fill_cells(fb, row, col + used, width, bg);
+		used += width;
+		in += consumed;
+	}
+
+	if (used < cols)
+		fill_cells(fb, row, col + used, cols - used, bg);
+	return used;
+}
+
+const ui_font_stats_t *ui_font_stats(void)
+{
+	return &g_stats;
+}
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef UI_FONT_H
+#define UI_FONT_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+/* Console cells are 8x8; wide (CJK) glyphs span two cells. */
+#define UI_FONT_CELL_PX 8
+#define UI_FONT_WIDE_PX (2 * UI_FONT_CELL_PX)
+/* Top-screen framebuffer height: the framebuffer is rotated, so each screen column is a
+ * contiguous run of this many pixels, bottom to top. */
+#define UI_FONT_FB_HEIGHT 240
+/* Two-way set-associative cache of pre-blitted glyphs, keyed by code point and colors; sized for a
+ * full bottom-screen list (printable ASCII in two color pairs) plus the names' kana/kanji. */
+#define UI_FONT_CACHE_SETS 256
+#define UI_FONT_CACHE_WAYS 2
+
+/// Fills width x height coverage (0 = background, 255 = ink), row-major, top row first.
+/// Return false when the font has no glyph for the code point.
+typedef bool (*ui_font_raster_fn)(u32 codepoint, u8 *coverage, u32 width, u32 height);
+
+typedef struct {
+	u32 hits;
+	u32 misses;
+	/* Misses the raster could not draw (no glyph, or no font). */
+	u32 missing;
+} ui_font_stats_t;
+
+/// Where glyphs come from; NULL (the default) rasterizes from the system shared font, which
+/// covers Latin, kana and CJK. Changing the raster empties the cache.
+void ui_font_set_raster(ui_font_raster_fn raster);
+
+/// Display columns for a code point: 2 for East Asian wide/fullwidth characters, else 1.
+u32 ui_font_columns(u32 codepoint);
+
+/// Draw a code point at cell (row, col) of a rotated 16-bit framebuffer fbWidth pixels wide (400
+/// top, 320 bottom), ui_font_columns() cells wide. fg and bg are console palette indices (0-15).
+/// Cached glyphs are copied column by column; the first use rasterizes and converts the glyph.
+/// Returns false if nothing was drawn.
+bool ui_font_draw(u16 *fb, u32 fbWidth, u32 row, u32 col, u32 codepoint, u8 fg, u8 bg);
+
+/// Draw UTF-8 text into cols cells starting at (row, col), clipped at a whole character and
+/// padded with background. Returns the columns the text used.
+u32 ui_font_draw_text(u16 *fb, u32 fbWidth, u32 row, u32 col, u32 cols, const char *text, u8 fg, u8 bg);
+
+/// Cache activity since start-up.
+const ui_font_stats_t *ui_font_stats(void);
+
+#endif
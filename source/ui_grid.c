@@ -0,0 +1,560 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "ui_grid.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ui_font.h"
+#include "ui_text.h"
+
+#define GRID_TAB_SIZE 3
+/* Unchanged cells shorter than this between two changes are rewritten rather than skipped with a
+ * cursor move, which costs at least six bytes. */
+#define GRID_GAP_MAX 4
+/* Sized so a typical full repaint reaches the console in one write. */
+#define GRID_OUT_SIZE 8192
+/* Text drawn since the last grid operation; parsed into the target in one pass. */
+#define GRID_TEXT_SIZE 4096
+/* A glyph no real cell holds, so every invalidated cell compares as changed. */
+#define GRID_GLYPH_UNKNOWN 0xFFFF
+#define GRID_COLOR_UNKNOWN 0xFF
+
+typedef enum {
+	GRID_PARSE_TEXT = 0,
+	GRID_PARSE_ESC,
+	GRID_PARSE_CSI,
+} grid_parse_t;
+
+static ui_grid_t g_back;
+/* What the console currently shows, as of the last flush. */
+static ui_grid_t g_front;
+/* Draws into g_back, or a caller's grid while laying out off-screen. */
+static ui_grid_parser_t g_parser;
+static bool g_initialized = false;
+
+/* Colors last emitted to the console, so runs only switch colors when they change. */
+static u8 g_emitFg = GRID_COLOR_UNKNOWN;
+static u8 g_emitBg = GRID_COLOR_UNKNOWN;
+
+static char g_textData[GRID_TEXT_SIZE];
+static ui_text_t g_text;
+
+static ui_grid_sink_fn g_sink = NULL;
+static char g_outData[GRID_OUT_SIZE];
+static ui_text_t g_out;
+static ui_grid_stats_t g_lastFlush;
+/* Cells (row * UI_GRID_COLS + col) whose glyph ui_font draws once the console text is out. */
+static u16 g_fontCells[UI_GRID_ROWS * UI_GRID_COLS];
+static u32 g_fontCellCount = 0;
+
+static void grid_fill(ui_grid_t *grid, u16 glyph, u8 fg, u8 bg)
+{
+	u32 r;
+	u32 c;
+
+	for (r = 0; r < UI_GRID_ROWS; r++) {
+		for (c = 0; c < UI_GRID_COLS; c++) {
+			grid->cells[r][c].glyph = glyph;
+			grid->cells[r][c].fg = fg;
+			grid->cells[r][c].bg = bg;
+		}
+	}
+}
+
+/* Parse the pending text into the target; every other grid operation does this first. */
+static void grid_commit(ui_text_t *text)
+{
+	ui_grid_parser_feed(&g_parser, text->data, text->length);
+	text->length = 0;
+}
+
+static void out_spill(ui_text_t *out);
+
+static void grid_init(void)
+{
+	if (g_initialized)
+		return;
+
+	ui_text_init(&g_text, g_textData, sizeof(g_textData), grid_commit);
+	ui_text_init(&g_out, g_outData, sizeof(g_outData), out_spill);
+	grid_fill(&g_back, ' ', UI_GRID_DEFAULT_FG, UI_GRID_DEFAULT_BG);
+	grid_fill(&g_front, GRID_GLYPH_UNKNOWN, GRID_COLOR_UNKNOWN, GRID_COLOR_UNKNOWN);
+	ui_grid_parser_reset(&g_parser, &g_back);
+	g_initialized = true;
+}
+
+static void grid_new_row(ui_grid_parser_t *p)
+{
+	ui_grid_t *grid = p->grid;
+	u32 c;
+
+	p->col = 0;
+	if (p->row + 1 < UI_GRID_ROWS) {
+		p->row++;
+		return;
+	}
+
+	/* Same as the console: scroll up and start a blank bottom row. */
+	memmove(grid->cells[0], grid->cells[1], sizeof(grid->cells[0]) * (UI_GRID_ROWS - 1));
+	for (c = 0; c < UI_GRID_COLS; c++) {
+		grid->cells[UI_GRID_ROWS - 1][c].glyph = ' ';
+		grid->cells[UI_GRID_ROWS - 1][c].fg = p->fg;
+		grid->cells[UI_GRID_ROWS - 1][c].bg = p->bg;
+	}
+}
+
+/* Blank the other half of a wide glyph that (row, col) is about to stop being part of. */
+static void grid_unpair(ui_grid_parser_t *p, u32 col)
+{
+	ui_grid_cell_t *cells = p->grid->cells[p->row];
+
+	if (cells[col].glyph == UI_GRID_WIDE_TAIL && col > 0)
+		cells[col - 1].glyph = ' ';
+	else if (col + 1 < UI_GRID_COLS && cells[col + 1].glyph == UI_GRID_WIDE_TAIL)
+		cells[col + 1].glyph = ' ';
+}
+
+static void grid_set(ui_grid_parser_t *p, u32 col, u16 glyph)
+{
+	ui_grid_cell_t *cell = &p->grid->cells[p->row][col];
+
+	cell->glyph = glyph;
+	cell->fg = p->fg;
+	cell->bg = p->bg;
+}
+
+static void grid_put(ui_grid_parser_t *p, u32 codepoint)
+{
+	u32 columns = ui_font_columns(codepoint);
+
+	/* Wrapping is deferred until the next glyph, so a full-width line plus \n is one line. */
+	if (p->col >= UI_GRID_COLS)
+		grid_new_row(p);
+	if (columns == 2 && p->col + 1 >= UI_GRID_COLS) {
+		grid_unpair(p, p->col);
+		grid_set(p, p->col, ' ');
+		grid_new_row(p);
+	}
+
+	grid_unpair(p, p->col);
+	grid_set(p, p->col, codepoint > 0xFFFF || codepoint >= UI_GRID_WIDE_TAIL ? '?' : (u16)codepoint);
+	p->col++;
+
+	if (columns == 2) {
+		grid_unpair(p, p->col);
+		grid_set(p, p->col, UI_GRID_WIDE_TAIL);
+		p->col++;
+	}
+}
+
+static void grid_erase_line(ui_grid_parser_t *p)
+{
+	u32 c;
+
+	grid_unpair(p, p->col);
+	for (c = p->col; c < UI_GRID_COLS; c++)
+		grid_set(p, c, ' ');
+}
+
+static void grid_apply_sgr(ui_grid_parser_t *p)
+{
+	u32 i;
+
+	if (p->param_count == 0) {
+		p->fg = UI_GRID_DEFAULT_FG;
+		p->bg = UI_GRID_DEFAULT_BG;
+		return;
+	}
+
+	for (i = 0; i < p->param_count; i++) {
+		u32 param = p->params[i];
+
+		if (param == 0) {
+			p->fg = UI_GRID_DEFAULT_FG;
+			p->bg = UI_GRID_DEFAULT_BG;
+		} else if (param >= 30 && param <= 37) {
+			p->fg = (u8)(param - 30);
+		} else if (param == 39) {
+			p->fg = UI_GRID_DEFAULT_FG;
+		} else if (param >= 40 && param <= 47) {
+			p->bg = (u8)(param - 40);
+		} else if (param == 49) {
+			p->bg = UI_GRID_DEFAULT_BG;
+		} else if (param >= 90 && param <= 97) {
+			p->fg = (u8)(param - 90 + 8);
+		}
+	}
+}
+
+static u32 grid_param(const ui_grid_parser_t *p, u32 index, u32 fallback)
+{
+	if (index >= p->param_count || p->params[index] == 0)
+		return fallback;
+	return p->params[index];
+}
+
+static void grid_apply_csi(ui_grid_parser_t *p, char command)
+{
+	u32 n;
+
+	switch (command) {
+	case 'H':
+	case 'f':
+		p->moves++;
+		p->row = grid_param(p, 0, 1) - 1;
+		p->col = grid_param(p, 1, 1) - 1;
+		if (p->row >= UI_GRID_ROWS)
+			p->row = UI_GRID_ROWS - 1;
+		if (p->col >= UI_GRID_COLS)
+			p->col = UI_GRID_COLS - 1;
+		break;
+	case 'A':
+		p->moves++;
+		n = grid_param(p, 0, 1);
+		p->row = n > p->row ? 0 : p->row - n;
+		break;
+	case 'B':
+		p->moves++;
+		n = grid_param(p, 0, 1);
+		p->row = p->row + n >= UI_GRID_ROWS ? UI_GRID_ROWS - 1 : p->row + n;
+		break;
+	case 'C':
+		p->moves++;
+		n = grid_param(p, 0, 1);
+		p->col = p->col + n >= UI_GRID_COLS ? UI_GRID_COLS - 1 : p->col + n;
+		break;
+	case 'D':
+		p->moves++;
+		n = grid_param(p, 0, 1);
+		p->col = n > p->col ? 0 : p->col - n;
+		break;
+	case 'K':
+		if (p->col < UI_GRID_COLS)
+			grid_erase_line(p);
+		break;
+	case 'J':
+		if (grid_param(p, 0, 0) == 2)
+			ui_grid_parser_clear(p);
+		break;
+	case 'm':
+		grid_apply_sgr(p);
+		break;
+	default:
+		break;
+	}
+}
+
+static void grid_text_byte(ui_grid_parser_t *p, u8 byte)
+{
+	if (p->utf8_pending > 0) {
+		if ((byte & 0xC0) == 0x80) {
+			p->utf8_codepoint = (p->utf8_codepoint << 6) | (byte & 0x3F);
+			if (--p->utf8_pending == 0)
+				grid_put(p, p->utf8_codepoint);
+			return;
+		}
+		/* Truncated sequence: drop it and treat this byte on its own. */
+		p->utf8_pending = 0;
+	}
+
+	if (byte >= 0xF0 && byte < 0xF8) {
+		p->utf8_codepoint = byte & 0x07;
+		p->utf8_pending = 3;
+	} else if (byte >= 0xE0) {
+		p->utf8_codepoint = byte & 0x0F;
+		p->utf8_pending = 2;
+	} else if (byte >= 0xC0) {
+		p->utf8_codepoint = byte & 0x1F;
+		p->utf8_pending = 1;
+	} else if (byte == '\n') {
+		grid_new_row(p);
+	} else if (byte == '\r') {
+		p->col = 0;
+	} else if (byte == '\t') {
+		u32 spaces = GRID_TAB_SIZE - (p->col % GRID_TAB_SIZE);
+
+		while (spaces-- > 0 && p->col < UI_GRID_COLS)
+			grid_put(p, ' ');
+	} else if (byte == 0x1B) {
+		p->state = GRID_PARSE_ESC;
+	} else if (byte >= 0x20) {
+		grid_put(p, byte);
+	}
+}
+
+void ui_grid_parser_reset(ui_grid_parser_t *parser, ui_grid_t *grid)
+{
+	if (parser == NULL)
+		return;
+
+	memset(parser, 0, sizeof(*parser));
+	parser->grid = grid;
+	parser->fg = UI_GRID_DEFAULT_FG;
+	parser->bg = UI_GRID_DEFAULT_BG;
+	parser->state = GRID_PARSE_TEXT;
+}
+
+void ui_grid_parser_clear(ui_grid_parser_t *parser)
+{
+	if (parser == NULL || parser->grid == NULL)
+		return;
+
+	parser->clears++;
+	parser->fg = UI_GRID_DEFAULT_FG;
+	parser->bg = UI_GRID_DEFAULT_BG;
+	grid_fill(parser->grid, ' ', parser->fg, parser->bg);
+	parser->row = 0;
+	parser->col = 0;
+}
+
+void ui_grid_parser_feed(ui_grid_parser_t *parser, const char *text, size_t size)
+{
+	size_t i;
+
+	if (parser == NULL || parser->grid == NULL)
+		return;
+
+	for (i = 0; i < size; i++) {
+		u8 byte = (u8)text[i];
+
+		switch (parser->state) {
+		case GRID_PARSE_ESC:
+			parser->state = byte == '[' ? GRID_PARSE_CSI : GRID_PARSE_TEXT;
+			parser->param_count = 0;
+			memset(parser->params, 0, sizeof(parser->params));
+			break;
+		case GRID_PARSE_CSI:
+			if (byte >= '0' && byte <= '9') {
+				if (parser->param_count == 0)
+					parser->param_count = 1;
+				if (parser->param_count <= UI_GRID_PARAM_MAX)
+					parser->params[parser->param_count - 1] = parser->params[parser->param_count - 1] * 10 + (byte - '0');
+			} else if (byte == ';') {
+				if (parser->param_count == 0)
+					parser->param_count = 1;
+				if (parser->param_count < UI_GRID_PARAM_MAX)
+					parser->param_count++;
+			} else {
+				parser->state = GRID_PARSE_TEXT;
+				grid_apply_csi(parser, (char)byte);
+			}
+			break;
+		default:
+			grid_text_byte(parser, byte);
+			break;
+		}
+	}
+}
+
+void ui_grid_write(const char *text, size_t size)
+{
+	grid_init();
+	ui_text_put_bytes(&g_text, text, size);
+}
+
+void ui_puts(const char *text)
+{
+	grid_init();
+	ui_text_put(&g_text, text);
+}
+
+ui_text_t *ui_grid_text(void)
+{
+	grid_init();
+	return &g_text;
+}
+
+int ui_printf(const char *format, ...)
+{
+	size_t before;
+	va_list args;
+
+	grid_init();
+	before = g_text.length;
+	va_start(args, format);
+	ui_text_vprintf(&g_text, format, args);
+	va_end(args);
+
+	/* Only meaningful when nothing spilled; callers ignore it. */
+	return g_text.length >= before ? (int)(g_text.length - before) : 0;
+}
+
+void ui_grid_clear(void)
+{
+	grid_init();
+	grid_commit(&g_text);
+	ui_grid_parser_clear(&g_parser);
+}
+
+void ui_grid_set_target(ui_grid_t *grid)
+{
+	u32 clears;
+
+	grid_init();
+	grid_commit(&g_text);
+	clears = g_parser.clears;
+	ui_grid_parser_reset(&g_parser, grid != NULL ? grid : &g_back);
+	g_parser.clears = clears;
+}
+
+void ui_grid_show(const ui_grid_t *grid)
+{
+	grid_init();
+	grid_commit(&g_text);
+	if (grid != NULL)
+		memcpy(&g_back, grid, sizeof(g_back));
+}
+
+void ui_grid_invalidate(void)
+{
+	grid_init();
+	grid_fill(&g_front, GRID_GLYPH_UNKNOWN, GRID_COLOR_UNKNOWN, GRID_COLOR_UNKNOWN);
+	g_emitFg = GRID_COLOR_UNKNOWN;
+	g_emitBg = GRID_COLOR_UNKNOWN;
+}
+
+void ui_grid_set_sink(ui_grid_sink_fn sink)
+{
+	g_sink = sink;
+}
+
+/* Hand the escape stream to the sink; normally once per flush. */
+static void out_spill(ui_text_t *out)
+{
+	if (out->length == 0)
+		return;
+
+	if (g_sink != NULL)
+		g_sink(out->data, out->length);
+	else
+		fwrite(out->data, 1, out->length, stdout);
+
+	g_lastFlush.bytes += (u32)out->length;
+	g_lastFlush.writes++;
+	out->length = 0;
+}
+
+static void out_cell(const ui_grid_cell_t *cell, u32 row, u32 col)
+{
+	char utf8[3];
+	size_t len;
+	u16 cp = cell->glyph;
+
+	if (cell->fg != g_emitFg) {
+		ui_text_put_sgr(&g_out, cell->fg < 8 ? 30u + cell->fg : 90u + (cell->fg - 8u));
+		g_emitFg = cell->fg;
+	}
+	if (cell->bg != g_emitBg) {
+		ui_text_put_sgr(&g_out, 40u + (cell->bg & 7u));
+		g_emitBg = cell->bg;
+	}
+
+	if (cp < 0x80) {
+		utf8[0] = (char)cp;
+		len = 1;
+	} else if (g_sink == NULL) {
+		/* The console font is ASCII only: clear the cell(s) and let ui_font draw over them. */
+		if (cp != UI_GRID_WIDE_TAIL)
+			g_fontCells[g_fontCellCount++] = (u16)(row * UI_GRID_COLS + col);
+		utf8[0] = ' ';
+		len = 1;
+	} else if (cp == UI_GRID_WIDE_TAIL) {
+		len = 0;
+	} else if (cp < 0x800) {
+		utf8[0] = (char)(0xC0 | (cp >> 6));
+		utf8[1] = (char)(0x80 | (cp & 0x3F));
+		len = 2;
+	} else {
+		utf8[0] = (char)(0xE0 | (cp >> 12));
+		utf8[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+		utf8[2] = (char)(0x80 | (cp & 0x3F));
+		len = 3;
+	}
+	ui_text_put_bytes(&g_out, utf8, len);
+	g_lastFlush.cells++;
+}
+
+static void draw_font_cells(void)
+{
+	u16 *fb;
+	u32 i;
+
+	if (g_fontCellCount == 0)
+		return;
+
+	fb = (u16 *)gfxGetFramebuffer(GFX_TOP, GFX_LEFT, NULL, NULL);
+	for (i = 0; i < g_fontCellCount; i++) {
+		u32 row = g_fontCells[i] / UI_GRID_COLS;
+		u32 col = g_fontCells[i] % UI_GRID_COLS;
+		const ui_grid_cell_t *cell = &g_front.cells[row][col];
+
+		ui_font_draw(fb, UI_GRID_COLS * UI_FONT_CELL_PX, row, col, cell->glyph, cell->fg, cell->bg);
+	}
+	g_fontCellCount = 0;
+}
+
+static bool cell_changed(u32 r, u32 c)
+{
+	return memcmp(&g_back.cells[r][c], &g_front.cells[r][c], sizeof(ui_grid_cell_t)) != 0;
+}
+
+/* Column of the next changed cell at or after c, or UI_GRID_COLS. */
+static u32 next_change(u32 r, u32 c)
+{
+	while (c < UI_GRID_COLS && !cell_changed(r, c))
+		c++;
+	return c;
+}
+
+void ui_grid_flush(void)
+{
+	u32 r;
+
+	grid_init();
+	grid_commit(&g_text);
+	memset(&g_lastFlush, 0, sizeof(g_lastFlush));
+	g_lastFlush.clears = g_parser.clears;
+	g_parser.clears = 0;
+
+	for (r = 0; r < UI_GRID_ROWS; r++) {
+		u32 c = next_change(r, 0);
+
+		while (c < UI_GRID_COLS) {
+			u32 end = c;
+
+			/* Extend the run over short unchanged gaps; a cursor move would cost more. */
+			for (;;) {
+				u32 next;
+
+				while (end < UI_GRID_COLS && cell_changed(r, end))
+					end++;
+				next = next_change(r, end);
+				if (next >= UI_GRID_COLS || next - end >= GRID_GAP_MAX)
+					break;
+				end = next;
+			}
+
+			ui_text_put_move(&g_out, r + 1, c + 1);
+			for (; c < end; c++) {
+				out_cell(&g_back.cells[r][c], r, c);
+				g_front.cells[r][c] = g_back.cells[r][c];
+			}
+
+			c = next_change(r, end);
+		}
+	}
+
+	out_spill(&g_out);
+	if (g_sink == NULL) {
+		fflush(stdout);
+		draw_font_cells();
+	}
+}
+
+const ui_grid_stats_t *ui_grid_last_flush(void)
+{
+	return &g_lastFlush;
+}
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef UI_GRID_H
+#define UI_GRID_H
+
+#include <3ds.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ui_text.h"
+
+/* Top-screen console size in cells. */
+#define UI_GRID_ROWS 30
+#define UI_GRID_COLS 50
+/* Right half of a wide (two-column) glyph that starts in the previous cell. */
+#define UI_GRID_WIDE_TAIL 0xFFFE
+/* libctru console defaults after "\x1b[0m": white on black. */
+#define UI_GRID_DEFAULT_FG 7
+#define UI_GRID_DEFAULT_BG 0
+#define UI_GRID_PARAM_MAX 4
+
+typedef struct {
+	u16 glyph;
+	u8 fg;
+	u8 bg;
+} ui_grid_cell_t;
+
+/* A full screen of cells; the console back grid or an off-screen page. */
+typedef struct {
+	ui_grid_cell_t cells[UI_GRID_ROWS][UI_GRID_COLS];
+} ui_grid_t;
+
+typedef struct {
+	u32 cells;
+	u32 bytes;
+	/* Writes to the sink; one unless the repaint overflowed the output buffer. */
+	u32 writes;
+	/* Grid clears (ui_grid_clear or CSI 2J, any target) since the previous flush. */
+	u32 clears;
+} ui_grid_stats_t;
+
+/*
+ * Interpreter for the console subset the UI writes (see ui_grid_write). The grid draws its text
+ * with one; ui_capture replays flush output into a screen of its own with another, so what the
+ * tests see is parsed exactly like what the pages drew.
+ */
+typedef struct {
+	ui_grid_t *grid;
+	u32 row;
+	u32 col;
+	u8 fg;
+	u8 bg;
+	u8 state;
+	u8 param_count;
+	u32 params[UI_GRID_PARAM_MAX];
+	u32 utf8_pending;
+	u32 utf8_codepoint;
+	/* Clears (CSI 2J or ui_grid_parser_clear) and cursor moves (CSI H, f, A-D) since the reset;
+	 * the owner zeroes them as it counts. */
+	u32 clears;
+	u32 moves;
+} ui_grid_parser_t;
+
+/// Parse into grid from the top-left corner with default colors; grid is left as it is.
+void ui_grid_parser_reset(ui_grid_parser_t *parser, ui_grid_t *grid);
+
+/// Blank the parser's grid with default colors and home the cursor.
+void ui_grid_parser_clear(ui_grid_parser_t *parser);
+
+/// Parse text into the parser's grid. Sequences split across calls carry over.
+void ui_grid_parser_feed(ui_grid_parser_t *parser, const char *text, size_t size);
+
+/// Receives the escape-sequence stream produced by a flush.
+typedef void (*ui_grid_sink_fn)(const char *data, size_t size);
+
+/// Where flushes go; NULL (the default) writes to stdout, i.e. the libctru console.
+void ui_grid_set_sink(ui_grid_sink_fn sink);
+
+/// Draw into the target grid. Text is buffered and parsed in one pass before the next clear,
+/// target switch, show or flush. Understands the console subset the UI uses: UTF-8 text, \n, \r,
+/// \t, and CSI H/f (position), K (erase to end of line), J (2J clears), m (colors), A-D.
+/// Wide characters take two cells; one that would straddle the right edge wraps first.
+void ui_grid_write(const char *text, size_t size);
+
+/// printf into the target grid (formatted straight into the pending text).
+int ui_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+/// Write a string as is (no formatting).
+void ui_puts(const char *text);
+
+/// The pending text, for the non-varargs ui_text formatters; same stream as ui_grid_write.
+ui_text_t *ui_grid_text(void);
+
+/// Blank the target grid and home the cursor (replaces consoleClear()).
+void ui_grid_clear(void);
+
+/// Draw into grid instead of the back grid (NULL switches back). Resets cursor and colors.
+void ui_grid_set_target(ui_grid_t *grid);
+
+/// Copy a prepared grid into the back grid; it reaches the console at the next flush.
+void ui_grid_show(const ui_grid_t *grid);
+
+/// Emit only the cells that differ from what the console already shows. Non-ASCII glyphs are
+/// sent as blanks and then drawn over the console with ui_font (stdout sink only).
+void ui_grid_flush(void);
+
+/// The console was reset (consoleInit): repaint every cell on the next flush.
+void ui_grid_invalidate(void);
+
+/// Cost of the most recent flush.
+const ui_grid_stats_t *ui_grid_last_flush(void);
+
+#endif
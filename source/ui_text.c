@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "ui_text.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Longest ui_text_vprintf result kept when it has to bypass a full buffer. */
+#define UI_TEXT_FORMAT_MAX 1024
+
+static const char s_hexUpper[] = "0123456789ABCDEF";
+static const char s_hexLower[] = "0123456789abcdef";
+
+void ui_text_init(ui_text_t *text, char *buffer, size_t size, ui_text_spill_fn spill)
+{
+	text->data = buffer;
+	text->size = size;
+	text->length = 0;
+	text->spill = spill;
+	text->dropped = 0;
+}
+
+void ui_text_put_bytes(ui_text_t *text, const char *data, size_t size)
+{
+	if (size <= text->size - text->length) {
+		memcpy(text->data + text->length, data, size);
+		text->length += size;
+		return;
+	}
+
+	while (size > 0) {
+		size_t room = text->size - text->length;
+		size_t n;
+
+		if (room == 0) {
+			if (text->spill != NULL)
+				text->spill(text);
+			room = text->size - text->length;
+			if (room == 0) {
+				text->dropped += (u32)size;
+				return;
+			}
+		}
+
+		n = size < room ? size : room;
+		memcpy(text->data + text->length, data, n);
+		text->length += n;
+		data += n;
+		size -= n;
+	}
+}
+
+void ui_text_put(ui_text_t *text, const char *s)
+{
+	if (s != NULL)
+		ui_text_put_bytes(text, s, strlen(s));
+}
+
+void ui_text_put_char(ui_text_t *text, char c)
+{
+	if (text->length < text->size)
+		text->data[text->length++] = c;
+	else
+		ui_text_put_bytes(text, &c, 1);
+}
+
+void ui_text_put_padded(ui_text_t *text, const char *s, u32 width)
+{
+	size_t len = s != NULL ? strlen(s) : 0;
+
+	ui_text_put_bytes(text, s, len);
+	while (len++ < width)
+		ui_text_put_char(text, ' ');
+}
+
+/* Decimal digits of value into the end of out; returns where they start. */
+static char *format_u32(char *end, u32 value)
+{
+	do {
+		*--end = (char)('0' + value % 10);
+		value /= 10;
+	} while (value != 0);
+	return end;
+}
+
+void ui_text_put_u32(ui_text_t *text, u32 value)
+{
+	char digits[10];
+	char *start = format_u32(digits + sizeof(digits), value);
+
+	ui_text_put_bytes(text, start, (size_t)(digits + sizeof(digits) - start));
+}
+
+/* Escape sequences are built on the stack so each costs one copy into the buffer. */
+void ui_text_put_sgr(ui_text_t *text, u32 code)
+{
+	char seq[16];
+	char *start = format_u32(seq + sizeof(seq) - 1, code);
+
+	seq[sizeof(seq) - 1] = 'm';
+	*--start = '[';
+	*--start = '\x1b';
+	ui_text_put_bytes(text, start, (size_t)(seq + sizeof(seq) - start));
+}
+
+void ui_text_put_move(ui_text_t *text, u32 row, u32 col)
+{
+	char seq[28];
+	char *start = format_u32(seq + sizeof(seq) - 1, col);
+
+	seq[sizeof(seq) - 1] = 'H';
+	*--start = ';';
+	start = format_u32(start, row);
+	*--start = '[';
+	*--start = '\x1b';
+	ui_text_put_bytes(text, start, (size_t)(seq + sizeof(seq) - start));
+}
+
+void ui_text_put_hex(ui_text_t *text, u64 value, u32 digits, bool upper)
+{
+	const char *hex = upper ? s_hexUpper : s_hexLower;
+	char out[16];
+	u32 i;
+
+	if (digits > sizeof(out))
+		digits = sizeof(out);
+
+	for (i = 0; i < digits; i++)
+		out[digits - 1 - i] = hex[(value >> (4 * i)) & 0xF];
+	ui_text_put_bytes(text, out, digits);
+}
+
+void ui_text_vprintf(ui_text_t *text, const char *format, va_list args)
+{
+	char buffer[UI_TEXT_FORMAT_MAX];
+	size_t room = text->size - text->length;
+	va_list copy;
+	int len;
+
+	/* Format in place when it fits; otherwise through a bounded stack buffer. */
+	va_copy(copy, args);
+	len = vsnprintf(text->data + text->length, room, format, copy);
+	va_end(copy);
+	if (len < 0)
+		return;
+	if ((size_t)len < room) {
+		text->length += (size_t)len;
+		return;
+	}
+
+	len = vsnprintf(buffer, sizeof(buffer), format, args);
+	if (len < 0)
+		return;
+	ui_text_put_bytes(text, buffer, (size_t)len < sizeof(buffer) ? (size_t)len : sizeof(buffer) - 1);
+}
+
+const char *ui_text_hex_string(char *out, size_t outSize, const char *prefix, u64 value, u32 digits, bool upper)
+{
+	ui_text_t text;
+
+	if (out == NULL || outSize == 0)
+		return "";
+
+	ui_text_init(&text, out, outSize - 1, NULL);
+	ui_text_put(&text, prefix);
+	ui_text_put_hex(&text, value, digits, upper);
+	out[text.length] = '\0';
+	return out;
+}
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef UI_TEXT_H
+#define UI_TEXT_H
+
+#include <3ds.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct ui_text ui_text_t;
+
+/// Called when a put does not fit: consume data[0..length) and reset length to 0.
+typedef void (*ui_text_spill_fn)(ui_text_t *text);
+
+/*
+ * Append-only text in a caller-owned buffer, with small formatters for what the UI prints most
+ * (padded labels, colors, cursor moves, decimal and hex numbers) so those skip vsnprintf. When
+ * the buffer fills, spill hands the text on and the put continues; without one it is truncated.
+ * The text is not NUL-terminated.
+ */
+struct ui_text {
+	char *data;
+	size_t size;
+	size_t length;
+	ui_text_spill_fn spill;
+	/* Bytes dropped because nothing could take them. */
+	u32 dropped;
+};
+
+void ui_text_init(ui_text_t *text, char *buffer, size_t size, ui_text_spill_fn spill);
+
+void ui_text_put_bytes(ui_text_t *text, const char *data, size_t size);
+void ui_text_put(ui_text_t *text, const char *s);
+void ui_text_put_char(ui_text_t *text, char c);
+
+/// s left-aligned in width bytes (the "%-*s" of ASCII labels); longer strings are not cut.
+void ui_text_put_padded(ui_text_t *text, const char *s, u32 width);
+
+/// "\x1b[<code>m".
+void ui_text_put_sgr(ui_text_t *text, u32 code);
+
+/// "\x1b[<row>;<col>H", 1-based.
+void ui_text_put_move(ui_text_t *text, u32 row, u32 col);
+
+void ui_text_put_u32(ui_text_t *text, u32 value);
+
+/// Hex zero-padded to digits (at most 16).
+void ui_text_put_hex(ui_text_t *text, u64 value, u32 digits, bool upper);
+
+/// General fallback for anything else.
+void ui_text_vprintf(ui_text_t *text, const char *format, va_list args);
+
+/// prefix plus ui_text_put_hex into a char array (NUL-terminated, truncated to fit); returns out.
+const char *ui_text_hex_string(char *out, size_t outSize, const char *prefix, u64 value, u32 digits, bool upper);
+
+#endif
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Throughput in MB/s of decoded bytes: raw LZ11 streaming, and a full 256x128 ETC1 banner parse. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fixtures.h"
+#include "title_banner.h"
+#include "title_lz11.h"
+
+#define RAW_SIZE (256 * 1024)
+#define BANNER_W 256
+#define BANNER_H 128
+#define BANNER_TEX_SIZE (BANNER_W * BANNER_H / 2)
+/* Model, animation and sound sections that precede or follow the texture in a real CGFX. */
+#define BANNER_PADDING (48 * 1024)
+#define ROUNDS 50
+
+static bool discard(void *ctx, const u8 *data, size_t size)
+{
+	*(u32 *)ctx += data[size - 1];
+	return true;
+}
+
+static void fill(u8 *data, u32 size)
+{
+	u32 seed = 7;
+	u32 n = 0;
+
+	/* Short literal runs between copies of recent data: roughly the 2-3x ratio of banner payloads. */
+	while (n < size) {
+		u32 run;
+
+		seed = seed * 1103515245 + 12345;
+		run = (seed >> 16) & 7;
+		while (run-- > 0 && n < size) {
+			seed = seed * 1103515245 + 12345;
+			data[n++] = (u8)(seed >> 24);
+		}
+		if (n > 2048) {
+			u32 from = n - 1 - (seed >> 5) % 2048;
+
+			run = 3 + (seed >> 24) % 40;
+			while (run-- > 0 && n < size)
+				data[n++] = data[from++];
+		}
+	}
+}
+
+static double mb_per_s(u64 bytes, u64 us)
+{
+	return us == 0 ? 0.0 : (double)bytes / (1024.0 * 1024.0) / ((double)us / 1000000.0);
+}
+
+int main(void)
+{
+	u8 *raw = (u8 *)malloc(RAW_SIZE);
+	u8 *packed = (u8 *)malloc(RAW_SIZE * 2);
+	u8 *cbmd = (u8 *)malloc(RAW_SIZE * 2);
+	title_lz11_stream_t *stream = (title_lz11_stream_t *)malloc(sizeof(*stream));
+	title_banner_t banner;
+	u32 packedSize;
+	u32 cbmdSize;
+	u32 sink = 0;
+	u64 decoded = 0;
+	u64 decodeUs = 0;
+	u64 start;
+	u32 r;
+
+	fill(raw, RAW_SIZE);
+	packedSize = fixture_lz11_compress(raw, RAW_SIZE, packed, RAW_SIZE * 2, false);
+	start = fixture_now_us();
+	for (r = 0; r < ROUNDS; r++) {
+		title_lz11_init(stream, discard, &sink);
+		title_lz11_feed(stream, packed, packedSize);
+	}
+	printf("lz11 stream    %7.1f MB/s  (%u -> %u bytes)\n",
+		mb_per_s((u64)RAW_SIZE * ROUNDS, fixture_now_us() - start), (unsigned)packedSize, RAW_SIZE);
+
+	fill(raw, BANNER_TEX_SIZE);
+	cbmdSize = fixture_cbmd(cbmd, RAW_SIZE * 2, 12, BANNER_W, BANNER_H, raw, BANNER_TEX_SIZE,
+		BANNER_PADDING, true);
+	start = fixture_now_us();
+	for (r = 0; r < ROUNDS; r++) {
+		title_banner_parse(cbmd, cbmdSize, &banner);
+		decoded += banner.decoded_size;
+		decodeUs += banner.decode_us;
+	}
+	printf("banner parse   %7.1f MB/s  (ETC1 %ux%u, %u of %u bytes decoded; reported %.1f MB/s)\n",
+		mb_per_s(decoded, fixture_now_us() - start), BANNER_W, BANNER_H, (unsigned)banner.decoded_size,
+		(unsigned)banner.decompressed_size, mb_per_s(decoded, decodeUs));
+
+	free(stream);
+	free(cbmd);
+	free(packed);
+	free(raw);
+	return sink == 0xFFFFFFFF;
+}
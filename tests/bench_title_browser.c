@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Pool browser over a full pool (TITLE_PICKER_POOL_MAX titles): the cost of opening it (one key
+ * lookup per title and the sort) and of scrolling it top to bottom a row at a time, resolving the
+ * visible window the way draw_browser does. A third of the titles have no cheap name: each pass
+ * reads every one of those once, since the name ring only holds the last TITLE_BROWSER_NAME_CACHE. */
+
+#include <stdio.h>
+
+#include "fixtures.h"
+#include "title_browser.h"
+#include "ui.h"
+
+#define OPEN_ROUNDS 50
+#define SCROLL_PASSES 4
+
+static title_browser_t g_browser;
+static title_picker_pool_t g_pool;
+static title_source_t g_titles[TITLE_PICKER_POOL_MAX];
+static char g_keys[TITLE_PICKER_POOL_MAX][24];
+
+static const char *key_name(u32 activeIndex, u64 titleId)
+{
+	return activeIndex % 3 == 2 ? NULL : g_keys[activeIndex];
+}
+
+static bool resolve_name(u64 titleId, FS_MediaType media, char *out, size_t outSize)
+{
+	snprintf(out, outSize, "Unindexed %llx", titleId & 0xFFFFF);
+	return true;
+}
+
+/* Microseconds per scroll step, over one pass from the top to the last full window. */
+static double scroll_pass(u32 *reads)
+{
+	u32 before = g_browser.resolve_count;
+	u32 steps = g_browser.count - UI_BROWSER_ROWS + 1;
+	volatile u32 sink = 0;
+	u64 start = fixture_now_us();
+	u32 first;
+	u32 row;
+
+	for (first = 0; first < steps; first++) {
+		for (row = 0; row < UI_BROWSER_ROWS; row++)
+			sink += (u32)title_browser_name(&g_browser, first + row, g_titles, resolve_name)[0];
+	}
+	(void)sink;
+	*reads = g_browser.resolve_count - before;
+	return (double)(fixture_now_us() - start) / steps;
+}
+
+int main(void)
+{
+	u64 start;
+	u32 reads;
+	u32 pass;
+	u32 i;
+
+	for (i = 0; i < TITLE_PICKER_POOL_MAX; i++) {
+		/* Spread the names so the sort has real work; IDs ascend, names do not. */
+		g_titles[i].titleId = 0x0004000000100000ULL + ((u64)i << 8);
+		g_titles[i].media = MEDIATYPE_SD;
+		snprintf(g_keys[i], sizeof(g_keys[i]), "%c%s Title %u", 'A' + (i * 7919) % 26, i % 2 ? "" : "the",
+			(unsigned)((i * 104729) % TITLE_PICKER_POOL_MAX));
+		g_pool.indices[i] = i;
+	}
+	g_pool.count = TITLE_PICKER_POOL_MAX;
+
+	start = fixture_now_us();
+	for (i = 0; i < OPEN_ROUNDS; i++)
+		title_browser_open(&g_browser, &g_pool, g_titles, TITLE_PICKER_POOL_MAX, key_name);
+	printf("open %u titles:   %8.1f us\n", (unsigned)g_browser.count,
+		(double)(fixture_now_us() - start) / OPEN_ROUNDS);
+
+	for (pass = 0; pass < SCROLL_PASSES; pass++) {
+		double us = scroll_pass(&reads);
+
+		printf("scroll pass %u:    %8.2f us/step (%u reads)\n", (unsigned)pass, us, (unsigned)reads);
+	}
+	return 0;
+}
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Decode time per 48x48 icon: the pair-table kernel against a per-pixel Morton walk. */
+
+#include <stdio.h>
+
+#include "fixtures.h"
+#include "title_icon.h"
+
+#define DIM TITLE_ICON_LARGE_DIM
+#define ROUNDS 200000
+
+static u16 g_tiled[DIM * DIM];
+static u16 g_out[DIM * DIM];
+
+static void morton_decode(const u16 *tiled, u32 dim, u16 *out)
+{
+	u32 i;
+
+	for (i = 0; i < dim * dim; i++) {
+		u32 tile = i / 64;
+		u32 m = i % 64;
+		u32 x = (m & 1) | ((m >> 1) & 2) | ((m >> 2) & 4);
+		u32 y = ((m >> 1) & 1) | ((m >> 2) & 2) | ((m >> 3) & 4);
+
+		out[((tile / (dim / 8)) * 8 + y) * dim + (tile % (dim / 8)) * 8 + x] = tiled[i];
+	}
+}
+
+static void run(const char *label, void (*decode)(const u16 *, u32, u16 *))
+{
+	volatile u16 sink = 0;
+	u64 start = fixture_now_us();
+	u64 elapsed;
+	u32 r;
+
+	for (r = 0; r < ROUNDS; r++) {
+		g_tiled[0] = (u16)r;
+		decode(g_tiled, DIM, g_out);
+		sink ^= g_out[r % (DIM * DIM)];
+	}
+	elapsed = fixture_now_us() - start;
+	printf("%-14s %8.1f ns/icon\n", label, elapsed * 1000.0 / ROUNDS);
+	(void)sink;
+}
+
+int main(void)
+{
+	u32 i;
+
+	for (i = 0; i < DIM * DIM; i++)
+		g_tiled[i] = (u16)(i * 31);
+	run("pair table", title_icon_decode_rgb565);
+	run("morton walk", morton_decode);
+	return 0;
+}
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Layout cost per pick: the name at the full 50 columns plus the long name beside a 14-column
+ * label, laid out fresh (a new pick) and again from the cached breaks (a redraw). */
+
+#include <stdio.h>
+
+#include "fixtures.h"
+#include "title_layout.h"
+
+#define NAME_COLS 50
+#define LONG_NAME_COLS (50 - 14)
+#define ROUNDS 200000
+
+typedef struct {
+	const char *name;
+	const char *long_name;
+} bench_pick_t;
+
+static const bench_pick_t s_picks[] = {
+	{ "Mario Kart 7", "Mario Kart 7" },
+	{ "The Legend of Zelda: Ocarina of Time 3D", "The Legend of Zelda: Ocarina of Time 3D; Nintendo" },
+	/* ゼルダの伝説 時のオカリナ 3D */
+	{ "\xE3\x82\xBC\xE3\x83\xAB\xE3\x83\x80\xE3\x81\xAE\xE4\xBC\x9D\xE8\xAA\xAC \xE6\x99\x82\xE3\x81\xAE\xE3\x82\xAA\xE3\x82\xAB\xE3\x83\xAA\xE3\x83\x8A 3D",
+	  "\xE3\x82\xBC\xE3\x83\xAB\xE3\x83\x80\xE3\x81\xAE\xE4\xBC\x9D\xE8\xAA\xAC\n\xE6\x99\x82\xE3\x81\xAE\xE3\x82\xAA\xE3\x82\xAB\xE3\x83\xAA\xE3\x83\x8A 3D" },
+	/* ポケモン超不思議のダンジョン */
+	{ "\xE3\x83\x9D\xE3\x82\xB1\xE3\x83\xA2\xE3\x83\xB3\xE8\xB6\x85\xE4\xB8\x8D\xE6\x80\x9D\xE8\xAD\xB0\xE3\x81\xAE\xE3\x83\x80\xE3\x83\xB3\xE3\x82\xB8\xE3\x83\xA7\xE3\x83\xB3",
+	  "\xE3\x83\x9D\xE3\x82\xB1\xE3\x83\xA2\xE3\x83\xB3\xE8\xB6\x85\xE4\xB8\x8D\xE6\x80\x9D\xE8\xAD\xB0\xE3\x81\xAE\xE3\x83\x80\xE3\x83\xB3\xE3\x82\xB8\xE3\x83\xA7\xE3\x83\xB3" },
+	{ "Pok\xC3\xA9mon Alpha Sapphire", "Pok\xC3\xA9mon Alpha Sapphire;The Pok\xC3\xA9mon Company" },
+};
+
+#define PICK_COUNT (sizeof(s_picks) / sizeof(s_picks[0]))
+
+static void run(const char *label, bool fresh)
+{
+	title_layout_t name = { 0 };
+	title_layout_t longName = { 0 };
+	volatile u32 sink = 0;
+	u64 start = fixture_now_us();
+	u64 elapsed;
+	u32 r;
+
+	for (r = 0; r < ROUNDS; r++) {
+		const bench_pick_t *pick = &s_picks[fresh ? r % PICK_COUNT : 0];
+
+		if (fresh) {
+			name.width = 0;
+			longName.width = 0;
+		}
+		sink += title_layout_wrap(&name, pick->name, NAME_COLS)->line_count;
+		sink += title_layout_wrap(&longName, pick->long_name, LONG_NAME_COLS)->line_count;
+	}
+	elapsed = fixture_now_us() - start;
+	printf("%-14s %8.1f ns/pick\n", label, elapsed * 1000.0 / ROUNDS);
+	(void)sink;
+}
+
+int main(void)
+{
+	run("new pick", true);
+	run("redraw", false);
+	return 0;
+}
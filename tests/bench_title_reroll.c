@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* CPU per reroll: load a pick from the fake SD card (SMDH and AM info) and lay out the GAME page,
+ * which decodes the display name and the publisher. "Eager" adds the decode the lazy SMDH fields
+ * dropped (every text field decoded at load, as before); the CFG language query the old path also
+ * made per reroll is free against the stubs, so it is not in either figure. */
+
+#include <stdio.h>
+
+#include "fake_ctru.h"
+#include "fixtures.h"
+#include "title_picker.h"
+#include "ui_fixture.h"
+
+#define TITLE_COUNT 32
+#define ROUNDS 20000
+
+static u8 g_smdh[TITLE_COUNT][FIXTURE_SMDH_SIZE];
+static fake_am_title_t g_titles[TITLE_COUNT];
+static ui_fixture_t g_fixture;
+static ui_grid_t g_grid;
+
+static double run(bool eager)
+{
+	char scratch[TITLE_SMDH_LONG_NAME_UTF8_MAX];
+	volatile u32 sink = 0;
+	u64 start = fixture_now_us();
+	u32 r;
+
+	for (r = 0; r < ROUNDS; r++) {
+		title_pick_t *pick = &g_fixture.pick;
+
+		title_picker_load_pick(g_titles[r % TITLE_COUNT].title_id, MEDIATYPE_SD, false, false, pick);
+		if (eager)
+			sink += (u32)title_smdh_field(&pick->smdh, TITLE_SMDH_FIELD_LONG_NAME, scratch, sizeof(scratch))[0];
+		ui_layout_main_screen(&g_fixture.view, &g_grid);
+		sink += g_grid.cells[2][0].glyph;
+	}
+	(void)sink;
+	return (double)(fixture_now_us() - start) / ROUNDS;
+}
+
+static double run_decode(title_smdh_field_t field)
+{
+	char out[TITLE_SMDH_LONG_NAME_UTF8_MAX];
+	volatile u32 sink = 0;
+	u64 start = fixture_now_us();
+	u32 r;
+
+	for (r = 0; r < ROUNDS; r++)
+		sink += (u32)title_smdh_field(&g_fixture.pick.smdh, field, out, sizeof(out))[0];
+	(void)sink;
+	return (double)(fixture_now_us() - start) / ROUNDS;
+}
+
+int main(void)
+{
+	char name[48];
+	double lazy;
+	double eager;
+	u32 i;
+
+	fake_ctru_reset();
+	for (i = 0; i < TITLE_COUNT; i++) {
+		g_titles[i].title_id = 0x0004000000100000ULL + ((u64)i << 8);
+		g_titles[i].size = 512ULL * 1024 * 1024;
+		g_titles[i].version = (u16)i;
+		snprintf(name, sizeof(name), "The Legend of Zelda: Title %u", (unsigned)i);
+		fixture_smdh(g_smdh[i], name, "Nintendo", (u16)i);
+		fake_fs_add_file(g_titles[i].title_id, "icon", g_smdh[i], FIXTURE_SMDH_SIZE);
+	}
+	fake_am_set_titles(MEDIATYPE_SD, g_titles, TITLE_COUNT);
+	ui_fixture_init(&g_fixture);
+	g_fixture.view.page = UI_PAGE_GAME;
+
+	title_picker_load_pick(g_titles[0].title_id, MEDIATYPE_SD, false, false, &g_fixture.pick);
+	if (g_fixture.pick.smdh.result != TITLE_SMDH_OK || g_fixture.pick.name_source != TITLE_NAME_SOURCE_SMDH) {
+		fprintf(stderr, "fake SMDH not loaded\n");
+		return 1;
+	}
+
+	lazy = run(false);
+	eager = run(true);
+	printf("reroll lazy    %7.2f us  (load + GAME page: name and publisher decoded)\n", lazy);
+	printf("reroll eager   %7.2f us  (+ long name decoded at load)\n", eager);
+	printf("saved          %7.2f us  (%.1f%%)\n", eager - lazy, (eager - lazy) * 100.0 / eager);
+	printf("decode short   %7.2f us\n", run_decode(TITLE_SMDH_FIELD_SHORT_NAME));
+	printf("decode long    %7.2f us\n", run_decode(TITLE_SMDH_FIELD_LONG_NAME));
+	printf("decode pub     %7.2f us\n", run_decode(TITLE_SMDH_FIELD_PUBLISHER));
+	return 0;
+}
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Query latency over 9,000 catalog names (TITLE_SEARCH_MAX is raised for this program): index
+ * build, each keystroke of a typed query, a delete, and the full rescan the index avoids. */
+
+#include <stdio.h>
+
+#include "catalog_names.h"
+#include "fixtures.h"
+#include "title_search.h"
+
+#define RESCAN_ROUNDS 20
+
+static title_search_t g_search;
+
+/* What every keystroke would cost without the index: compare the query against every name. */
+static u32 full_rescan(const char *query)
+{
+	u32 length = (u32)strlen(query);
+	u32 count = 0;
+	u32 i;
+	u32 j;
+
+	for (i = 0; i < g_search.count; i++) {
+		const char *text = g_search.text + g_search.text_offset[i];
+
+		for (j = 0; j + length <= g_search.text_length[i]; j++) {
+			if (text[j] == query[0] && memcmp(text + j, query, length) == 0) {
+				count++;
+				break;
+			}
+		}
+	}
+	return count;
+}
+
+int main(void)
+{
+	static const char *const queries[] = { "mario kart", "zelda", "pokemon", "kingdom", "the ", "3d", "xyzzy",
+		"fire emblem" };
+	volatile u32 sink = 0;
+	u64 start;
+	u64 elapsed;
+	u32 i;
+	u32 k;
+
+	start = fixture_now_us();
+	title_search_reset(&g_search);
+	for (i = 0; i < TITLE_SEARCH_MAX; i++)
+		title_search_add(&g_search, catalog_name(i));
+	printf("build          %u names, %u bytes: %llu us\n", (unsigned)g_search.count, (unsigned)g_search.text_used,
+		(unsigned long long)(fixture_now_us() - start));
+
+	for (k = 0; k < sizeof(queries) / sizeof(queries[0]); k++) {
+		const char *query = queries[k];
+		u32 length = (u32)strlen(query);
+		u64 worst = 0;
+		u64 total = 0;
+		u64 pop;
+		u32 results;
+		u32 r;
+
+		title_search_set_query(&g_search, "");
+		for (i = 0; i < length; i++) {
+			start = fixture_now_us();
+			title_search_push(&g_search, query[i]);
+			elapsed = fixture_now_us() - start;
+			total += elapsed;
+			if (elapsed > worst)
+				worst = elapsed;
+		}
+		results = g_search.result_count;
+
+		start = fixture_now_us();
+		title_search_pop(&g_search);
+		pop = fixture_now_us() - start;
+
+		start = fixture_now_us();
+		for (r = 0; r < RESCAN_ROUNDS; r++)
+			sink += full_rescan(query);
+		elapsed = (fixture_now_us() - start) / RESCAN_ROUNDS;
+
+		printf("%-14s %4u results  keystroke %6.1f us avg %4llu us worst  delete %3llu us  rescan %4llu us\n",
+			query, (unsigned)results, (double)total / length, (unsigned long long)worst,
+			(unsigned long long)pop, (unsigned long long)elapsed);
+	}
+
+	/* Names resolved while a query is active. */
+	title_search_set_query(&g_search, "mar");
+	start = fixture_now_us();
+	for (i = 0; i < 1000; i++)
+		title_search_set_name(&g_search, i * 7 % g_search.count, "Mario Party");
+	printf("name update    %.2f us\n", (double)(fixture_now_us() - start) / 1000);
+	(void)sink;
+	return 0;
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Glyphs per millisecond on the 320x240 bottom framebuffer with the test raster: cached blits,
+ * cold draws (rasterize and convert every glyph), and a full list screen of mixed names. */
+
+#include <stdio.h>
+
+#include "fixtures.h"
+#include "ui_font.h"
+
+#define FB_WIDTH 320
+#define ROWS 29
+#define COLS 40
+#define ROUNDS 2000
+
+static u16 g_fb[FB_WIDTH * UI_FONT_FB_HEIGHT];
+
+static const char *const s_names[] = {
+	"Mario Kart 7",
+	"\xE3\x82\xBC\xE3\x83\xAB\xE3\x83\x80\xE3\x81\xAE\xE4\xBC\x9D\xE8\xAA\xAC \xE6\x99\x82\xE3\x81\xAE\xE3\x82\xAA\xE3\x82\xAB\xE3\x83\xAA\xE3\x83\x8A 3D",
+	"Pok\xC3\xA9mon Alpha Sapphire",
+	"\xE3\x81\xA9\xE3\x81\x86\xE3\x81\xB6\xE3\x81\xA4\xE3\x81\xAE\xE6\xA3\xAE \xE3\x81\xB5\xE3\x81\x8F\xE3\x81\x97\xE3\x81\xAE\xE3\x83\x9C\xE3\x83\xBC\xE3\x83\x89",
+};
+
+static void report(const char *label, u64 glyphs, u64 us)
+{
+	printf("%-14s %9.0f glyphs/ms\n", label, us == 0 ? 0.0 : (double)glyphs * 1000.0 / (double)us);
+}
+
+int main(void)
+{
+	const ui_font_stats_t *stats = ui_font_stats();
+	u64 glyphs = 0;
+	u64 start;
+	u64 elapsed;
+	u32 hits;
+	u32 misses;
+	u32 r;
+	u32 i;
+
+	ui_font_set_raster(fixture_font_raster);
+
+	ui_font_draw(g_fb, FB_WIDTH, 0, 0, 'A', 15, 0);
+	start = fixture_now_us();
+	for (r = 0; r < ROUNDS * 100; r++)
+		ui_font_draw(g_fb, FB_WIDTH, r % ROWS, r % COLS, 'A', 15, 0);
+	report("cached", (u64)ROUNDS * 100, fixture_now_us() - start);
+
+	/* Cycling through more code points than the cache holds: nearly every draw misses. */
+	misses = stats->misses;
+	start = fixture_now_us();
+	for (r = 0; r < ROUNDS * 10; r++)
+		ui_font_draw(g_fb, FB_WIDTH, 0, 0, 0x4E00 + r % (3 * UI_FONT_CACHE_SETS), 15, 0);
+	report("cold", (u64)ROUNDS * 10, fixture_now_us() - start);
+	printf("%-14s %9u of %u draws\n", "  misses", (unsigned)(stats->misses - misses), ROUNDS * 10);
+
+	/* A full list screen of mixed names with a highlighted row, redrawn every frame. */
+	hits = stats->hits;
+	misses = stats->misses;
+	start = fixture_now_us();
+	for (r = 0; r < ROUNDS; r++) {
+		for (i = 0; i < ROWS; i++)
+			ui_font_draw_text(g_fb, FB_WIDTH, i, 0, COLS, s_names[(i + r) % 4], i == 3 ? 0 : 7, i == 3 ? 7 : 0);
+	}
+	elapsed = fixture_now_us() - start;
+	glyphs = (u64)(stats->hits - hits) + (stats->misses - misses);
+	report("list screen", glyphs, elapsed);
+	printf("%-14s %9.1f us per screen\n", "", (double)elapsed / ROUNDS);
+	return 0;
+}
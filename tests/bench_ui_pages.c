@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Draw time per page with the worst-case fixture: layout alone, layout plus the diff flush while
+ * alternating between two picks (the LIBRARY page does not change with the pick), and a full repaint (after a console reset), with the bytes and
+ * sink writes each one emits. The flush goes to a counting sink, not the capture screen. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "fixtures.h"
+#include "ui_fixture.h"
+#include "ui_grid.h"
+
+#define ROUNDS 20000
+
+static u64 g_sinkBytes;
+static u64 g_sinkWrites;
+
+static void count_sink(const char *data, size_t size)
+{
+	g_sinkBytes += size;
+	g_sinkWrites++;
+}
+
+static void set_smdh_name(u16 *out, const char *text)
+{
+	while (*text != '\0')
+		*out++ = (u8)*text++;
+	*out = 0;
+}
+
+static ui_fixture_t g_fixtures[2];
+static ui_grid_t g_grid;
+
+/* Page 4 stands for the options menu, which draws straight into the back grid. */
+static void draw(u32 page, u32 i, bool show)
+{
+	if (page == 4) {
+		ui_fixture_draw_filter_menu(i % UI_FIXTURE_FILTER_ROWS);
+		return;
+	}
+
+	g_fixtures[i & 1].view.page = page;
+	ui_layout_main_screen(&g_fixtures[i & 1].view, &g_grid);
+	if (show)
+		ui_grid_show(&g_grid);
+}
+
+int main(void)
+{
+	static const char *const names[] = { "GAME", "DETAILS", "TECHNICAL", "LIBRARY", "OPTIONS" };
+	u32 page;
+	u32 i;
+
+	/* Two different picks, so every diff flush has something to send. */
+	ui_fixture_init(&g_fixtures[0]);
+	ui_fixture_worst_case(&g_fixtures[0]);
+	ui_fixture_init(&g_fixtures[1]);
+	strcpy(g_fixtures[1].pick.display_name, "Mario Kart 7");
+	set_smdh_name(g_fixtures[1].pick.smdh.raw_short_name, "Mario Kart 7");
+	set_smdh_name(g_fixtures[1].pick.smdh.raw_long_name, "Mario Kart 7");
+	g_fixtures[1].pick.titleId = 0x0004000000030700ULL;
+	g_fixtures[1].pick.meta.unique_id = 0x00307;
+	g_fixtures[1].pick.meta.installed_size = 1024ULL * 1024 * 1024;
+	ui_grid_set_sink(count_sink);
+
+	printf("%-10s %9s %22s %22s\n", "page", "layout", "+ diff flush", "full repaint");
+	for (page = 0; page < 5; page++) {
+		double layout;
+		double diff;
+		double full;
+		u64 diffBytes;
+		u64 diffWrites;
+		u64 start;
+
+		start = fixture_now_us();
+		for (i = 0; i < ROUNDS; i++)
+			draw(page, i, false);
+		layout = (double)(fixture_now_us() - start) / ROUNDS;
+
+		g_sinkBytes = g_sinkWrites = 0;
+		start = fixture_now_us();
+		for (i = 0; i < ROUNDS; i++) {
+			draw(page, i, true);
+			ui_grid_flush();
+		}
+		diff = (double)(fixture_now_us() - start) / ROUNDS;
+		diffBytes = g_sinkBytes / ROUNDS;
+		diffWrites = g_sinkWrites;
+
+		g_sinkBytes = g_sinkWrites = 0;
+		start = fixture_now_us();
+		for (i = 0; i < ROUNDS / 10; i++) {
+			ui_grid_invalidate();
+			ui_grid_flush();
+		}
+		full = (double)(fixture_now_us() - start) / (ROUNDS / 10);
+
+		printf("%-10s %6.2f us %6.2f us %5llu B %4.2f wr %6.2f us %5llu B %4.2f wr\n", names[page], layout, diff,
+			(unsigned long long)diffBytes, (double)diffWrites / ROUNDS, full,
+			(unsigned long long)(g_sinkBytes / (ROUNDS / 10)), (double)g_sinkWrites / (ROUNDS / 10));
+	}
+
+	ui_grid_set_sink(NULL);
+	return 0;
+}
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TESTS_CATALOG_NAMES_H
+#define TESTS_CATALOG_NAMES_H
+
+/*
+ * The offline catalog's names, for tests that need a realistic library. The table in
+ * title_database.c is static, so this includes it; programs using it must not also list
+ * title_database.c in their <name>_SOURCES.
+ */
+
+#include "../source/title_database.c"
+
+/* Wraps around, so callers can ask for more names than the catalog has. */
+static const char *catalog_name(u32 index)
+{
+	return title_database[index % get_database_size()].game_name;
+}
+
+#endif
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TESTS_CODEPOINT_CLASSES_H
+#define TESTS_CODEPOINT_CLASSES_H
+
+// Class of every BMP code point according to scripts/console_codepoint_table.py,
+// as runs starting at `first`. Regenerate via scripts/build_codepoint_table.py.
+
+typedef struct {
+	unsigned first;
+	unsigned char value;
+} codepoint_class_run_t;
+
+static const codepoint_class_run_t codepoint_class_runs[] = {
+	{ 0x0000, 1 },
+	{ 0x0009, 0 },
+	{ 0x000B, 1 },
+	{ 0x000D, 0 },
+	{ 0x000E, 1 },
+	{ 0x0020, 0 },
+	{ 0x007F, 1 },
+	{ 0x0080, 0 },
+	{ 0x00A0, 13 },
+	{ 0x00A1, 0 },
+	{ 0x00A9, 4 },
+	{ 0x00AA, 0 },
+	{ 0x00AE, 3 },
+	{ 0x00AF, 0 },
+	{ 0x00B7, 5 },
+	{ 0x00B8, 0 },
+	{ 0x00D7, 9 },
+	{ 0x00D8, 0 },
+	{ 0x00F7, 10 },
+	{ 0x00F8, 0 },
+	{ 0x2002, 13 },
+	{ 0x200B, 1 },
+	{ 0x200E, 0 },
+	{ 0x2013, 5 },
+	{ 0x2015, 0 },
+	{ 0x2018, 6 },
+	{ 0x201A, 0 },
+	{ 0x201C, 7 },
+	{ 0x201E, 0 },
+	{ 0x2022, 11 },
+	{ 0x2023, 0 },
+	{ 0x2026, 8 },
+	{ 0x2027, 0 },
+	{ 0x2032, 6 },
+	{ 0x2033, 7 },
+	{ 0x2034, 0 },
+	{ 0x2122, 2 },
+	{ 0x2123, 0 },
+	{ 0x2160, 14 },
+	{ 0x2161, 15 },
+	{ 0x2162, 16 },
+	{ 0x2163, 17 },
+	{ 0x2164, 18 },
+	{ 0x2165, 19 },
+	{ 0x2166, 20 },
+	{ 0x2167, 21 },
+	{ 0x2168, 22 },
+	{ 0x2169, 23 },
+	{ 0x216A, 24 },
+	{ 0x216B, 25 },
+	{ 0x216C, 26 },
+	{ 0x216D, 27 },
+	{ 0x216E, 28 },
+	{ 0x216F, 29 },
+	{ 0x2170, 14 },
+	{ 0x2171, 15 },
+	{ 0x2172, 16 },
+	{ 0x2173, 17 },
+	{ 0x2174, 18 },
+	{ 0x2175, 19 },
+	{ 0x2176, 20 },
+	{ 0x2177, 21 },
+	{ 0x2178, 22 },
+	{ 0x2179, 23 },
+	{ 0x217A, 24 },
+	{ 0x217B, 25 },
+	{ 0x217C, 26 },
+	{ 0x217D, 27 },
+	{ 0x217E, 28 },
+	{ 0x217F, 29 },
+	{ 0x2180, 0 },
+	{ 0x2190, 1 },
+	{ 0x2400, 0 },
+	{ 0x25CB, 12 },
+	{ 0x25CC, 0 },
+	{ 0x25CF, 11 },
+	{ 0x25D0, 0 },
+	{ 0x2600, 1 },
+	{ 0x2605, 11 },
+	{ 0x2607, 1 },
+	{ 0x2661, 11 },
+	{ 0x2662, 1 },
+	{ 0x2665, 11 },
+	{ 0x2666, 1 },
+	{ 0x266A, 11 },
+	{ 0x266C, 1 },
+	{ 0x27C0, 0 },
+	{ 0x30FB, 5 },
+	{ 0x30FC, 0 },
+	{ 0xE000, 1 },
+	{ 0xF900, 0 },
+	{ 0xFEFF, 1 },
+	{ 0xFF00, 0 },
+	{ 0xFF0A, 11 },
+	{ 0xFF0B, 0 },
+	{ 0xFF65, 5 },
+	{ 0xFF66, 0 },
+};
+
+static const char *const codepoint_replacements[] = {
+	"(TM)",
+	"(R)",
+	"(C)",
+	"-",
+	"'",
+	"\"",
+	"...",
+	"x",
+	"/",
+	"*",
+	"O",
+	" ",
+	"I",
+	"II",
+	"III",
+	"IV",
+	"V",
+	"VI",
+	"VII",
+	"VIII",
+	"IX",
+	"X",
+	"XI",
+	"XII",
+	"XIII",
+	"XIV",
+	"XV",
+	"XVI",
+};
+
+#endif
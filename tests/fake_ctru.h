@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TESTS_FAKE_CTRU_H
+#define TESTS_FAKE_CTRU_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+/*
+ * Controls for the host libctru stand-in (tests/stub/ctru.c). AM serves a per-media title list,
+ * FS serves ExeFS files registered per title, and both count the IPC calls the launcher makes.
+ */
+
+#define FAKE_AM_TITLES_MAX 4096
+#define FAKE_FS_FILES_MAX 64
+
+typedef struct {
+	u64 title_id;
+	u64 size;
+	u16 version;
+	/* NULL: AM_GetTitleProductCode fails for the title. */
+	const char *product_code;
+} fake_am_title_t;
+
+typedef struct {
+	/* Every AM_* call, and the ones that carry title IDs (list and info). */
+	u32 am_calls;
+	u32 am_list_calls;
+	u32 am_info_calls;
+	u32 fs_opens;
+	u32 fs_reads;
+	/* Most FSFILE_Read calls that were running at the same time. */
+	u32 fs_reads_peak;
+} fake_ctru_counters_t;
+
+/// Forget every title, file, failure and counter.
+void fake_ctru_reset(void);
+
+/// Titles AM reports for media (replaces the previous list).
+void fake_am_set_titles(FS_MediaType media, const fake_am_title_t *titles, u32 count);
+
+/// Make AM_GetTitleCount/AM_GetTitleList for media fail with result (0 to stop failing).
+void fake_am_fail(FS_MediaType media, Result result);
+
+/// Serve data as ExeFS file name ("icon", "banner") of titleId. data must outlive the test.
+void fake_fs_add_file(u64 titleId, const char *name, const void *data, u32 size);
+
+/// Every FSFILE_Read sleeps this long first (0 by default), like a slow SD card.
+void fake_fs_set_latency_us(u32 us);
+
+/// FSFILE_Read calls running right now.
+u32 fake_fs_reads_in_flight(void);
+
+const fake_ctru_counters_t *fake_ctru_counters(void);
+void fake_ctru_reset_counters(void);
+
+/// Keys reported by the next hidScanInput() (down = held this scan and not the previous one).
+void fake_hid_set_held(u32 keys);
+
+/// The framebuffer gfxGetFramebuffer() returns for screen (rotated RGB565, 240 pixels per column).
+u16 *fake_gfx_framebuffer(gfxScreen_t screen);
+
+#endif
@@ -0,0 +1,284 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "fixtures.h"
+
+#include <3ds/util/utf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "title_icon.h"
+
+/* SMDH layout: magic, version, then 16 application titles of short/long/publisher UTF-16. */
+#define SMDH_TITLES_OFFSET 0x08
+#define SMDH_TITLE_SIZE 0x200
+#define SMDH_LONG_OFFSET 0x80
+#define SMDH_PUBLISHER_OFFSET 0x180
+
+static void put_utf16(u8 *out, u32 maxUnits, const char *text)
+{
+	const uint8_t *in = (const uint8_t *)text;
+	u32 units = 0;
+
+	while (*in != 0 && units + 1 < maxUnits) {
+		uint32_t cp;
+		ssize_t used = decode_utf8(&cp, in);
+
+		if (used <= 0)
+			break;
+		out[units * 2] = (u8)cp;
+		out[units * 2 + 1] = (u8)(cp >> 8);
+		units++;
+		in += used;
+	}
+}
+
+void fixture_smdh(u8 *out, const char *shortName, const char *publisher, u16 seed)
+{
+	char longName[160];
+	u32 lang;
+	u32 i;
+
+	memset(out, 0, FIXTURE_SMDH_SIZE);
+	memcpy(out, "SMDH", 4);
+	snprintf(longName, sizeof(longName), "%s (long)", shortName);
+
+	for (lang = 0; lang < 16; lang++) {
+		u8 *slot = out + SMDH_TITLES_OFFSET + lang * SMDH_TITLE_SIZE;
+
+		put_utf16(slot, 0x40, shortName);
+		put_utf16(slot + SMDH_LONG_OFFSET, 0x80, longName);
+		put_utf16(slot + SMDH_PUBLISHER_OFFSET, 0x40, publisher);
+	}
+
+	for (i = 0; i < TITLE_ICON_LARGE_DIM * TITLE_ICON_LARGE_DIM; i++) {
+		u16 pixel = (u16)(i + seed);
+
+		memcpy(out + TITLE_ICON_LARGE_OFFSET + i * 2, &pixel, 2);
+	}
+}
+
+static void put_le32(u8 *p, u32 value)
+{
+	p[0] = (u8)value;
+	p[1] = (u8)(value >> 8);
+	p[2] = (u8)(value >> 16);
+	p[3] = (u8)(value >> 24);
+}
+
+u32 fixture_lz11_compress(const u8 *in, u32 size, u8 *out, u32 outMax, bool extHeader)
+{
+	u32 o = 0;
+	u32 i = 0;
+
+	if (outMax < 8)
+		return 0;
+	out[o++] = 0x11;
+	if (extHeader || size >= (1u << 24)) {
+		out[o++] = 0;
+		out[o++] = 0;
+		out[o++] = 0;
+		put_le32(out + o, size);
+		o += 4;
+	} else {
+		out[o++] = (u8)size;
+		out[o++] = (u8)(size >> 8);
+		out[o++] = (u8)(size >> 16);
+	}
+
+	while (i < size) {
+		u32 flagPos = o++;
+		u32 bit;
+
+		if (flagPos >= outMax)
+			return 0;
+		out[flagPos] = 0;
+		for (bit = 0; bit < 8 && i < size; bit++) {
+			u32 bestLen = 0;
+			u32 bestDist = 0;
+			u32 d;
+
+			if (o + 4 > outMax)
+				return 0;
+			for (d = 1; d <= i && d <= 0x1000; d++) {
+				u32 len = 0;
+
+				while (len < 0x10110 && i + len < size && in[i + len - d] == in[i + len])
+					len++;
+				if (len > bestLen) {
+					bestLen = len;
+					bestDist = d;
+				}
+				if (len >= 0x110)
+					break;
+			}
+
+			if (bestLen < 3) {
+				out[o++] = in[i++];
+				continue;
+			}
+			out[flagPos] |= (u8)(0x80 >> bit);
+			d = bestDist - 1;
+			if (bestLen <= 0x10) {
+				out[o++] = (u8)(((bestLen - 1) << 4) | (d >> 8));
+			} else if (bestLen <= 0x110) {
+				out[o++] = (u8)((bestLen - 0x11) >> 4);
+				out[o++] = (u8)((((bestLen - 0x11) & 0xF) << 4) | (d >> 8));
+			} else {
+				out[o++] = (u8)(0x10 | ((bestLen - 0x111) >> 12));
+				out[o++] = (u8)((bestLen - 0x111) >> 4);
+				out[o++] = (u8)((((bestLen - 0x111) & 0xF) << 4) | (d >> 8));
+			}
+			out[o++] = (u8)d;
+			i += bestLen;
+		}
+	}
+	return o;
+}
+
+/* CGFX fixture layout: header, DATA at 0x14, textures DICT at 0x40, TXOB at 0x80, image at 0x100,
+ * texture data at 0x200. Relative offsets count from the field that holds them. */
+#define CGFX_DATA 0x14
+#define CGFX_DICT 0x40
+#define CGFX_DICT_NODE (CGFX_DICT + 0x1C)
+#define CGFX_TXOB 0x80
+#define CGFX_IMAGE 0x100
+#define CGFX_TEXTURE 0x200
+#define CBMD_HEADER_SIZE 0x88
+
+u32 fixture_cbmd(u8 *out, u32 outMax, u32 format, u32 width, u32 height, const u8 *tex, u32 texSize,
+	u32 padding, bool compress)
+{
+	u32 cgfxSize = CGFX_TEXTURE + texSize + padding;
+	u8 *cgfx;
+	u32 size;
+	u32 i;
+
+	if (outMax < CBMD_HEADER_SIZE)
+		return 0;
+	cgfx = (u8 *)calloc(1, cgfxSize);
+	if (cgfx == NULL)
+		return 0;
+
+	memcpy(cgfx, "CGFX", 4);
+	cgfx[4] = 0xFF;
+	cgfx[5] = 0xFE;
+	cgfx[6] = 0x14;
+	memcpy(cgfx + CGFX_DATA, "DATA", 4);
+	put_le32(cgfx + CGFX_DATA + 0x10, 1);
+	put_le32(cgfx + CGFX_DATA + 0x14, CGFX_DICT - (CGFX_DATA + 0x14));
+	memcpy(cgfx + CGFX_DICT, "DICT", 4);
+	put_le32(cgfx + CGFX_DICT + 0x08, 1);
+	put_le32(cgfx + CGFX_DICT_NODE + 0x0C, CGFX_TXOB - (CGFX_DICT_NODE + 0x0C));
+	put_le32(cgfx + CGFX_TXOB, 0x20000011);
+	memcpy(cgfx + CGFX_TXOB + 4, "TXOB", 4);
+	put_le32(cgfx + CGFX_TXOB + 0x18, height);
+	put_le32(cgfx + CGFX_TXOB + 0x1C, width);
+	put_le32(cgfx + CGFX_TXOB + 0x34, format);
+	put_le32(cgfx + CGFX_TXOB + 0x38, CGFX_IMAGE - (CGFX_TXOB + 0x38));
+	put_le32(cgfx + CGFX_IMAGE, height);
+	put_le32(cgfx + CGFX_IMAGE + 0x04, width);
+	put_le32(cgfx + CGFX_IMAGE + 0x08, texSize);
+	put_le32(cgfx + CGFX_IMAGE + 0x0C, CGFX_TEXTURE - (CGFX_IMAGE + 0x0C));
+	memcpy(cgfx + CGFX_TEXTURE, tex, texSize);
+	for (i = 0; i < padding; i++)
+		cgfx[CGFX_TEXTURE + texSize + i] = (u8)(i / 64);
+
+	memset(out, 0, CBMD_HEADER_SIZE);
+	memcpy(out, "CBMD", 4);
+	put_le32(out + 0x08, CBMD_HEADER_SIZE);
+	if (compress) {
+		size = fixture_lz11_compress(cgfx, cgfxSize, out + CBMD_HEADER_SIZE, outMax - CBMD_HEADER_SIZE,
+			false);
+		size = size == 0 ? 0 : CBMD_HEADER_SIZE + size;
+	} else if (CBMD_HEADER_SIZE + cgfxSize <= outMax) {
+		memcpy(out + CBMD_HEADER_SIZE, cgfx, cgfxSize);
+		size = CBMD_HEADER_SIZE + cgfxSize;
+	} else {
+		size = 0;
+	}
+	free(cgfx);
+	return size;
+}
+
+static bool write_text(const char *path, const char *text)
+{
+	FILE *file = fopen(path, "wb");
+	bool ok;
+
+	if (file == NULL)
+		return false;
+	ok = fwrite(text, 1, strlen(text), file) == strlen(text);
+	return fclose(file) == 0 && ok;
+}
+
+bool fixture_golden(const char *name, const char *actual)
+{
+	char path[256];
+	char *expected;
+	const char *update = getenv("UPDATE_GOLDEN");
+	FILE *file;
+	long size;
+	bool match;
+
+	snprintf(path, sizeof(path), "golden/%s", name);
+	if (update != NULL && strcmp(update, "1") == 0) {
+		if (!write_text(path, actual)) {
+			fprintf(stderr, "%s: cannot write\n", path);
+			return false;
+		}
+		return true;
+	}
+
+	file = fopen(path, "rb");
+	if (file == NULL) {
+		fprintf(stderr, "%s: missing (run with UPDATE_GOLDEN=1 to create it)\n", path);
+		return false;
+	}
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	expected = (char *)calloc(1, (size_t)size + 1);
+	if (expected != NULL && fread(expected, 1, (size_t)size, file) != (size_t)size)
+		expected[0] = '\0';
+	fclose(file);
+
+	match = expected != NULL && strcmp(expected, actual) == 0;
+	free(expected);
+	if (!match) {
+		snprintf(path, sizeof(path), "build/%s", name);
+		write_text(path, actual);
+		fprintf(stderr, "golden/%s differs; actual output is in %s\n", name, path);
+	}
+	return match;
+}
+
+bool fixture_font_raster(u32 codepoint, u8 *coverage, u32 width, u32 height)
+{
+	u32 x;
+	u32 y;
+
+	if (codepoint == 0x25A0)
+		return false;
+
+	for (y = 0; y < height; y++) {
+		for (x = 0; x < width; x++) {
+			bool edge = x == 0 || y == 0 || x + 1 == width || y + 1 == height;
+			u32 bit = ((y - 1) * (width - 2) + (x - 1)) % 21;
+
+			coverage[y * width + x] = edge || ((codepoint >> bit) & 1) ? 255 : 0;
+		}
+	}
+	coverage[height * width - 1] = 128;
+	return true;
+}
+
+u64 fixture_now_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * 1000000ULL + (u64)ts.tv_nsec / 1000;
+}
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TESTS_FIXTURES_H
+#define TESTS_FIXTURES_H
+
+#include <3ds.h>
+#include <stdbool.h>
+
+/* Size of an ExeFS "icon" file: the SMDH with both icons. */
+#define FIXTURE_SMDH_SIZE 0x36C0
+
+/// Build an SMDH with shortName and publisher (UTF-8) in every language slot, the long name
+/// set to "<shortName> (long)", and a large icon whose pixel at tiled index i is (u16)(i + seed).
+void fixture_smdh(u8 *out, const char *shortName, const char *publisher, u16 seed);
+
+/// LZ11-compress size bytes of in (greedy, 4-byte header when size >= 1 << 24 or forced with
+/// extHeader). Returns the compressed size, 0 if out (outMax bytes) is too small.
+u32 fixture_lz11_compress(const u8 *in, u32 size, u8 *out, u32 outMax, bool extHeader);
+
+/// Build a CBMD whose common CGFX holds one width x height texture of PICA format with the
+/// given tiled data, laid out the way bannertool writes it (DATA -> textures DICT -> TXOB ->
+/// image), followed by padding bytes of other sections. The CGFX is LZ11-compressed unless
+/// compress is false. Returns the CBMD size, 0 if out (outMax bytes) is too small.
+u32 fixture_cbmd(u8 *out, u32 outMax, u32 format, u32 width, u32 height, const u8 *tex, u32 texSize,
+	u32 padding, bool compress);
+
+/// Test font for ui_font_set_raster: a box outline with the code point's low bits inside and
+/// half coverage on the bottom-right pixel. U+25A0 has no glyph.
+bool fixture_font_raster(u32 codepoint, u8 *coverage, u32 width, u32 height);
+
+/// Compare actual with tests/golden/<name>. On a mismatch the actual text is written to
+/// build/<name> for diffing; with UPDATE_GOLDEN=1 in the environment the golden file is
+/// rewritten instead. Returns true when they match (or were updated).
+bool fixture_golden(const char *name, const char *actual);
+
+/// Monotonic microseconds, for benchmarks.
+u64 fixture_now_us(void);
+
+#endif
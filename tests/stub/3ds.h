@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/*
+ * Host stand-in for the parts of libctru the launcher uses. Declarations only follow libctru's
+ * names and signatures; tests/stub/ctru.c implements them, with AM and FS backed by the fakes in
+ * tests/fake_ctru.h. u32 is 32 bits here as on the 3DS (newlib's %lu formats warn on the host,
+ * hence -Wno-format in tests/Makefile).
+ */
+
+#ifndef TESTS_STUB_3DS_H
+#define TESTS_STUB_3DS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+typedef volatile u32 vu32;
+
+typedef s32 Result;
+typedef u32 Handle;
+typedef u64 FS_Archive;
+
+#define R_FAILED(res) ((res) < 0)
+#define R_SUCCEEDED(res) ((res) >= 0)
+#define U64_MAX UINT64_MAX
+
+#define SYSCLOCK_ARM11 268111856
+#define CPU_TICKS_PER_MSEC (SYSCLOCK_ARM11 / 1000.0)
+#define CUR_THREAD_HANDLE 0xFFFF8000
+
+/* FS / AM */
+
+typedef enum {
+	MEDIATYPE_NAND = 0,
+	MEDIATYPE_SD = 1,
+	MEDIATYPE_GAME_CARD = 2,
+} FS_MediaType;
+
+typedef enum {
+	PATH_INVALID = 0,
+	PATH_EMPTY = 1,
+	PATH_BINARY = 2,
+	PATH_ASCII = 3,
+	PATH_UTF16 = 4,
+} FS_PathType;
+
+typedef struct {
+	FS_PathType type;
+	u32 size;
+	const void *data;
+} FS_Path;
+
+#define ARCHIVE_SAVEDATA_AND_CONTENT 0x2345678A
+#define FS_OPEN_READ 1
+
+typedef struct {
+	u64 titleID;
+	u64 size;
+	u16 version;
+	u8 unk[6];
+} AM_TitleEntry;
+
+Result amInit(void);
+void amExit(void);
+Result AM_GetTitleCount(FS_MediaType mediatype, u32 *count);
+Result AM_GetTitleList(u32 *titlesRead, FS_MediaType mediatype, u32 titleCount, u64 *titleIds);
+Result AM_GetTitleInfo(FS_MediaType mediatype, u32 titleCount, u64 *titleIds, AM_TitleEntry *titleInfo);
+Result AM_GetTitleProductCode(FS_MediaType mediatype, u64 titleId, char *productCode);
+Result AM_GetTitleExtDataId(u64 *extDataId, FS_MediaType mediatype, u64 titleId);
+
+Result fsInit(void);
+void fsExit(void);
+Result FSUSER_OpenFileDirectly(Handle *out, u32 archiveId, FS_Path archivePath, FS_Path filePath, u32 openFlags,
+	u32 attributes);
+Result FSUSER_OpenArchive(FS_Archive *archive, u32 id, FS_Path path);
+Result FSUSER_CloseArchive(FS_Archive archive);
+Result FSUSER_OpenFile(Handle *out, FS_Archive archive, FS_Path path, u32 openFlags, u32 attributes);
+Result FSFILE_Read(Handle handle, u32 *bytesRead, u64 offset, void *buffer, u32 size);
+Result FSFILE_GetSize(Handle handle, u64 *size);
+Result FSFILE_Close(Handle handle);
+
+Result cfguInit(void);
+void cfguExit(void);
+Result CFGU_GetSystemLanguage(u8 *language);
+
+/* Kernel and threads */
+
+u64 svcGetSystemTick(void);
+void svcSleepThread(s64 ns);
+Result svcGetThreadPriority(s32 *out, Handle handle);
+
+typedef struct Thread_tag *Thread;
+typedef void (*ThreadFunc)(void *);
+
+Thread threadCreate(ThreadFunc entrypoint, void *arg, size_t stackSize, int priority, int coreId, bool detached);
+Result threadJoin(Thread thread, u64 timeoutNs);
+void threadFree(Thread thread);
+
+/* Graphics, console, input, applets */
+
+typedef enum {
+	GFX_TOP = 0,
+	GFX_BOTTOM = 1,
+} gfxScreen_t;
+
+typedef enum {
+	GFX_LEFT = 0,
+	GFX_RIGHT = 1,
+} gfx3dSide_t;
+
+typedef enum {
+	GSP_RGBA8_OES = 0,
+	GSP_BGR8_OES = 1,
+	GSP_RGB565_OES = 2,
+} GSPGPU_FramebufferFormat;
+
+void gfxInitDefault(void);
+void gfxExit(void);
+void gfxSwapBuffers(void);
+void gfxFlushBuffers(void);
+u8 *gfxGetFramebuffer(gfxScreen_t screen, gfx3dSide_t side, u16 *width, u16 *height);
+void gfxSetScreenFormat(gfxScreen_t screen, GSPGPU_FramebufferFormat format);
+void gfxSetDoubleBuffering(gfxScreen_t screen, bool enable);
+void gspWaitForVBlank(void);
+
+typedef struct PrintConsole PrintConsole;
+PrintConsole *consoleInit(gfxScreen_t screen, PrintConsole *console);
+PrintConsole *consoleSelect(PrintConsole *console);
+void consoleClear(void);
+
+bool aptMainLoop(void);
+void aptSetChainloader(u64 programId, u8 mediatype);
+
+enum {
+	KEY_A = 1 << 0,
+	KEY_B = 1 << 1,
+	KEY_SELECT = 1 << 2,
+	KEY_START = 1 << 3,
+	KEY_DRIGHT = 1 << 4,
+	KEY_DLEFT = 1 << 5,
+	KEY_DUP = 1 << 6,
+	KEY_DDOWN = 1 << 7,
+	KEY_R = 1 << 8,
+	KEY_L = 1 << 9,
+	KEY_X = 1 << 10,
+	KEY_Y = 1 << 11,
+	KEY_ZL = 1 << 14,
+	KEY_ZR = 1 << 15,
+	KEY_TOUCH = 1 << 20,
+	KEY_UP = KEY_DUP,
+	KEY_DOWN = KEY_DDOWN,
+	KEY_LEFT = KEY_DLEFT,
+	KEY_RIGHT = KEY_DRIGHT,
+};
+
+typedef struct {
+	u16 px;
+	u16 py;
+} touchPosition;
+
+void hidScanInput(void);
+u32 hidKeysDown(void);
+u32 hidKeysDownRepeat(void);
+u32 hidKeysHeld(void);
+u32 hidKeysUp(void);
+void hidTouchRead(touchPosition *pos);
+void hidSetRepeatParameters(u32 delay, u32 interval);
+
+/* System font (no font on the host: fontEnsureMapped fails) */
+
+typedef struct {
+	u8 cellWidth;
+	u8 cellHeight;
+	u8 baselinePos;
+	u8 maxCharWidth;
+	u32 sheetSize;
+	u16 nSheets;
+	u16 sheetFmt;
+	u16 nRows;
+	u16 nLines;
+	u16 sheetWidth;
+	u16 sheetHeight;
+	u8 *sheetData;
+} TGLP_s;
+
+typedef struct {
+	s8 left;
+	u8 glyphWidth;
+	u8 charWidth;
+} charWidthInfo_s;
+
+typedef struct {
+	u32 signature;
+	u32 sectionSize;
+	u8 fontType;
+	u8 lineFeed;
+	u16 alterCharIndex;
+	charWidthInfo_s defaultWidth;
+	u8 encoding;
+	u32 tglp;
+	u32 cwdr;
+	u32 cmap;
+	u8 height;
+	u8 width;
+	u8 ascent;
+	u8 padding;
+} FINF_s;
+
+typedef struct {
+	u32 signature;
+	u16 endianness;
+	u16 headerSize;
+	u32 version;
+	u32 fileSize;
+	u32 nBlocks;
+	FINF_s finf;
+} CFNT_s;
+
+Result fontEnsureMapped(void);
+CFNT_s *fontGetSystemFont(void);
+int fontGlyphIndexFromCodePoint(CFNT_s *font, u32 codePoint);
+TGLP_s *fontGetGlyphInfo(CFNT_s *font);
+charWidthInfo_s *fontGetCharWidthInfo(CFNT_s *font, int glyphIndex);
+void *fontGetGlyphSheetTex(CFNT_s *font, int sheetId);
+
+#endif
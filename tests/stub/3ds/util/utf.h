@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TESTS_STUB_3DS_UTIL_UTF_H
+#define TESTS_STUB_3DS_UTIL_UTF_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+ssize_t decode_utf8(uint32_t *out, const uint8_t *in);
+ssize_t encode_utf8(uint8_t *out, uint32_t in);
+ssize_t utf16_to_utf8(uint8_t *out, const uint16_t *in, size_t len);
+
+#endif
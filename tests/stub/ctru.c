@@ -0,0 +1,652 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include <3ds.h>
+#include <3ds/util/utf.h>
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "fake_ctru.h"
+
+/* Any negative value; the launcher only tests R_FAILED. */
+#define FAKE_RESULT_NOT_FOUND ((Result)0xC8804478)
+#define FAKE_MEDIA_COUNT 3
+#define FAKE_HANDLES_MAX 16
+#define FAKE_TOP_WIDTH 400
+#define FAKE_BOTTOM_WIDTH 320
+#define FAKE_SCREEN_HEIGHT 240
+
+typedef struct {
+	u64 title_id;
+	char name[8];
+	const u8 *data;
+	u32 size;
+} fake_file_t;
+
+struct Thread_tag {
+	pthread_t thread;
+	ThreadFunc entry;
+	void *arg;
+};
+
+static fake_am_title_t g_titles[FAKE_MEDIA_COUNT][FAKE_AM_TITLES_MAX];
+static u32 g_titleCount[FAKE_MEDIA_COUNT];
+static Result g_amFailure[FAKE_MEDIA_COUNT];
+static fake_file_t g_files[FAKE_FS_FILES_MAX];
+static u32 g_fileCount = 0;
+/* Open handles: index into g_files plus one, 0 when free. */
+static u32 g_handles[FAKE_HANDLES_MAX];
+static u32 g_latencyUs = 0;
+static u32 g_readsInFlight = 0;
+static fake_ctru_counters_t g_counters;
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static u32 g_held = 0;
+static u32 g_heldPrevious = 0;
+static u16 g_topFb[FAKE_TOP_WIDTH * FAKE_SCREEN_HEIGHT];
+static u16 g_bottomFb[FAKE_BOTTOM_WIDTH * FAKE_SCREEN_HEIGHT];
+
+static void count_call(u32 *counter)
+{
+	__atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+}
+
+void fake_ctru_reset(void)
+{
+	pthread_mutex_lock(&g_lock);
+	memset(g_titleCount, 0, sizeof(g_titleCount));
+	memset(g_amFailure, 0, sizeof(g_amFailure));
+	memset(g_handles, 0, sizeof(g_handles));
+	g_fileCount = 0;
+	g_latencyUs = 0;
+	memset(&g_counters, 0, sizeof(g_counters));
+	pthread_mutex_unlock(&g_lock);
+	g_held = 0;
+	g_heldPrevious = 0;
+}
+
+void fake_am_set_titles(FS_MediaType media, const fake_am_title_t *titles, u32 count)
+{
+	if ((u32)media >= FAKE_MEDIA_COUNT)
+		return;
+	if (count > FAKE_AM_TITLES_MAX)
+		count = FAKE_AM_TITLES_MAX;
+	pthread_mutex_lock(&g_lock);
+	memcpy(g_titles[media], titles, count * sizeof(*titles));
+	g_titleCount[media] = count;
+	pthread_mutex_unlock(&g_lock);
+}
+
+void fake_am_fail(FS_MediaType media, Result result)
+{
+	if ((u32)media < FAKE_MEDIA_COUNT)
+		g_amFailure[media] = result;
+}
+
+void fake_fs_add_file(u64 titleId, const char *name, const void *data, u32 size)
+{
+	fake_file_t *file;
+
+	pthread_mutex_lock(&g_lock);
+	if (g_fileCount < FAKE_FS_FILES_MAX) {
+		file = &g_files[g_fileCount++];
+		file->title_id = titleId;
+		strncpy(file->name, name, sizeof(file->name));
+		file->data = (const u8 *)data;
+		file->size = size;
+	}
+	pthread_mutex_unlock(&g_lock);
+}
+
+void fake_fs_set_latency_us(u32 us)
+{
+	g_latencyUs = us;
+}
+
+u32 fake_fs_reads_in_flight(void)
+{
+	return __atomic_load_n(&g_readsInFlight, __ATOMIC_SEQ_CST);
+}
+
+const fake_ctru_counters_t *fake_ctru_counters(void)
+{
+	return &g_counters;
+}
+
+void fake_ctru_reset_counters(void)
+{
+	memset(&g_counters, 0, sizeof(g_counters));
+}
+
+static const fake_am_title_t *find_title(FS_MediaType media, u64 titleId)
+{
+	u32 i;
+
+	if ((u32)media >= FAKE_MEDIA_COUNT)
+		return NULL;
+	for (i = 0; i < g_titleCount[media]; i++) {
+		if (g_titles[media][i].title_id == titleId)
+			return &g_titles[media][i];
+	}
+	return NULL;
+}
+
+/* AM */
+
+Result amInit(void)
+{
+	return 0;
+}
+
+void amExit(void)
+{
+}
+
+Result AM_GetTitleCount(FS_MediaType mediatype, u32 *count)
+{
+	count_call(&g_counters.am_calls);
+	if ((u32)mediatype >= FAKE_MEDIA_COUNT)
+		return FAKE_RESULT_NOT_FOUND;
+	if (R_FAILED(g_amFailure[mediatype]))
+		return g_amFailure[mediatype];
+	*count = g_titleCount[mediatype];
+	return 0;
+}
+
+Result AM_GetTitleList(u32 *titlesRead, FS_MediaType mediatype, u32 titleCount, u64 *titleIds)
+{
+	u32 i;
+
+	count_call(&g_counters.am_calls);
+	count_call(&g_counters.am_list_calls);
+	if ((u32)mediatype >= FAKE_MEDIA_COUNT)
+		return FAKE_RESULT_NOT_FOUND;
+	if (R_FAILED(g_amFailure[mediatype]))
+		return g_amFailure[mediatype];
+
+	for (i = 0; i < titleCount && i < g_titleCount[mediatype]; i++)
+		titleIds[i] = g_titles[mediatype][i].title_id;
+	if (titlesRead != NULL)
+		*titlesRead = i;
+	return 0;
+}
+
+Result AM_GetTitleInfo(FS_MediaType mediatype, u32 titleCount, u64 *titleIds, AM_TitleEntry *titleInfo)
+{
+	u32 i;
+
+	count_call(&g_counters.am_calls);
+	count_call(&g_counters.am_info_calls);
+	for (i = 0; i < titleCount; i++) {
+		const fake_am_title_t *title = find_title(mediatype, titleIds[i]);
+
+		/* Like AM, one unknown ID fails the whole batch. */
+		if (title == NULL)
+			return FAKE_RESULT_NOT_FOUND;
+		memset(&titleInfo[i], 0, sizeof(titleInfo[i]));
+		titleInfo[i].titleID = title->title_id;
+		titleInfo[i].size = title->size;
+		titleInfo[i].version = title->version;
+	}
+	return 0;
+}
+
+Result AM_GetTitleProductCode(FS_MediaType mediatype, u64 titleId, char *productCode)
+{
+	const fake_am_title_t *title = find_title(mediatype, titleId);
+
+	count_call(&g_counters.am_calls);
+	if (title == NULL || title->product_code == NULL)
+		return FAKE_RESULT_NOT_FOUND;
+	strncpy(productCode, title->product_code, 16);
+	return 0;
+}
+
+Result AM_GetTitleExtDataId(u64 *extDataId, FS_MediaType mediatype, u64 titleId)
+{
+	count_call(&g_counters.am_calls);
+	if (find_title(mediatype, titleId) == NULL)
+		return FAKE_RESULT_NOT_FOUND;
+	*extDataId = (titleId >> 8) & 0xFFFFF;
+	return 0;
+}
+
+/* FS: only the ExeFS paths title_exefs_open() builds are understood. */
+
+Result fsInit(void)
+{
+	return 0;
+}
+
+void fsExit(void)
+{
+}
+
+Result FSUSER_OpenFileDirectly(Handle *out, u32 archiveId, FS_Path archivePath, FS_Path filePath, u32 openFlags,
+	u32 attributes)
+{
+	const u32 *arch = (const u32 *)archivePath.data;
+	const char *name = (const char *)filePath.data + 3 * sizeof(u32);
+	u64 titleId;
+	u32 i;
+	u32 h;
+
+	count_call(&g_counters.fs_opens);
+	*out = 0;
+	if (archivePath.size < 2 * sizeof(u32) || filePath.size < 3 * sizeof(u32) + 1)
+		return FAKE_RESULT_NOT_FOUND;
+	titleId = ((u64)arch[1] << 32) | arch[0];
+
+	pthread_mutex_lock(&g_lock);
+	for (i = 0; i < g_fileCount; i++) {
+		if (g_files[i].title_id == titleId && strncmp(g_files[i].name, name, sizeof(g_files[i].name)) == 0)
+			break;
+	}
+	for (h = 0; i < g_fileCount && h < FAKE_HANDLES_MAX; h++) {
+		if (g_handles[h] == 0) {
+			g_handles[h] = i + 1;
+			*out = h + 1;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&g_lock);
+
+	return *out != 0 ? 0 : FAKE_RESULT_NOT_FOUND;
+}
+
+Result FSUSER_OpenArchive(FS_Archive *archive, u32 id, FS_Path path)
+{
+	*archive = 0;
+	return FAKE_RESULT_NOT_FOUND;
+}
+
+Result FSUSER_CloseArchive(FS_Archive archive)
+{
+	return 0;
+}
+
+Result FSUSER_OpenFile(Handle *out, FS_Archive archive, FS_Path path, u32 openFlags, u32 attributes)
+{
+	*out = 0;
+	return FAKE_RESULT_NOT_FOUND;
+}
+
+static const fake_file_t *handle_file(Handle handle)
+{
+	if (handle == 0 || handle > FAKE_HANDLES_MAX || g_handles[handle - 1] == 0)
+		return NULL;
+	return &g_files[g_handles[handle - 1] - 1];
+}
+
+Result FSFILE_Read(Handle handle, u32 *bytesRead, u64 offset, void *buffer, u32 size)
+{
+	const fake_file_t *file = handle_file(handle);
+	u32 inFlight;
+	u32 peak;
+
+	*bytesRead = 0;
+	if (file == NULL)
+		return FAKE_RESULT_NOT_FOUND;
+
+	count_call(&g_counters.fs_reads);
+	inFlight = __atomic_add_fetch(&g_readsInFlight, 1, __ATOMIC_SEQ_CST);
+	peak = __atomic_load_n(&g_counters.fs_reads_peak, __ATOMIC_RELAXED);
+	while (inFlight > peak && !__atomic_compare_exchange_n(&g_counters.fs_reads_peak, &peak, inFlight, false,
+		__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		;
+	if (g_latencyUs > 0)
+		svcSleepThread((s64)g_latencyUs * 1000);
+
+	if (offset < file->size) {
+		*bytesRead = file->size - (u32)offset < size ? file->size - (u32)offset : size;
+		memcpy(buffer, file->data + offset, *bytesRead);
+	}
+	__atomic_sub_fetch(&g_readsInFlight, 1, __ATOMIC_SEQ_CST);
+	return 0;
+}
+
+Result FSFILE_GetSize(Handle handle, u64 *size)
+{
+	const fake_file_t *file = handle_file(handle);
+
+	if (file == NULL)
+		return FAKE_RESULT_NOT_FOUND;
+	*size = file->size;
+	return 0;
+}
+
+Result FSFILE_Close(Handle handle)
+{
+	if (handle == 0 || handle > FAKE_HANDLES_MAX)
+		return FAKE_RESULT_NOT_FOUND;
+	pthread_mutex_lock(&g_lock);
+	g_handles[handle - 1] = 0;
+	pthread_mutex_unlock(&g_lock);
+	return 0;
+}
+
+/* CFG: English */
+
+Result cfguInit(void)
+{
+	return 0;
+}
+
+void cfguExit(void)
+{
+}
+
+Result CFGU_GetSystemLanguage(u8 *language)
+{
+	*language = 1;
+	return 0;
+}
+
+/* Kernel and threads */
+
+u64 svcGetSystemTick(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (u64)ts.tv_sec * SYSCLOCK_ARM11 + (u64)ts.tv_nsec * SYSCLOCK_ARM11 / 1000000000ULL;
+}
+
+void svcSleepThread(s64 ns)
+{
+	struct timespec ts;
+
+	ts.tv_sec = (time_t)(ns / 1000000000LL);
+	ts.tv_nsec = (long)(ns % 1000000000LL);
+	nanosleep(&ts, NULL);
+}
+
+Result svcGetThreadPriority(s32 *out, Handle handle)
+{
+	*out = 0x30;
+	return 0;
+}
+
+static void *thread_entry(void *arg)
+{
+	Thread thread = (Thread)arg;
+
+	thread->entry(thread->arg);
+	return NULL;
+}
+
+Thread threadCreate(ThreadFunc entrypoint, void *arg, size_t stackSize, int priority, int coreId, bool detached)
+{
+	Thread thread = (Thread)calloc(1, sizeof(*thread));
+
+	if (thread == NULL)
+		return NULL;
+	thread->entry = entrypoint;
+	thread->arg = arg;
+	if (pthread_create(&thread->thread, NULL, thread_entry, thread) != 0) {
+		free(thread);
+		return NULL;
+	}
+	return thread;
+}
+
+Result threadJoin(Thread thread, u64 timeoutNs)
+{
+	if (thread == NULL)
+		return FAKE_RESULT_NOT_FOUND;
+	pthread_join(thread->thread, NULL);
+	return 0;
+}
+
+void threadFree(Thread thread)
+{
+	free(thread);
+}
+
+/* Graphics and console: framebuffers are plain arrays; nothing is shown. */
+
+void gfxInitDefault(void)
+{
+}
+
+void gfxExit(void)
+{
+}
+
+void gfxSwapBuffers(void)
+{
+}
+
+void gfxFlushBuffers(void)
+{
+}
+
+u16 *fake_gfx_framebuffer(gfxScreen_t screen)
+{
+	return screen == GFX_TOP ? g_topFb : g_bottomFb;
+}
+
+u8 *gfxGetFramebuffer(gfxScreen_t screen, gfx3dSide_t side, u16 *width, u16 *height)
+{
+	if (width != NULL)
+		*width = FAKE_SCREEN_HEIGHT;
+	if (height != NULL)
+		*height = screen == GFX_TOP ? FAKE_TOP_WIDTH : FAKE_BOTTOM_WIDTH;
+	return (u8 *)fake_gfx_framebuffer(screen);
+}
+
+void gfxSetScreenFormat(gfxScreen_t screen, GSPGPU_FramebufferFormat format)
+{
+}
+
+void gfxSetDoubleBuffering(gfxScreen_t screen, bool enable)
+{
+}
+
+void gspWaitForVBlank(void)
+{
+}
+
+PrintConsole *consoleInit(gfxScreen_t screen, PrintConsole *console)
+{
+	return console;
+}
+
+PrintConsole *consoleSelect(PrintConsole *console)
+{
+	return console;
+}
+
+void consoleClear(void)
+{
+}
+
+bool aptMainLoop(void)
+{
+	return true;
+}
+
+void aptSetChainloader(u64 programId, u8 mediatype)
+{
+}
+
+/* Input */
+
+void fake_hid_set_held(u32 keys)
+{
+	g_held = keys;
+}
+
+void hidScanInput(void)
+{
+}
+
+u32 hidKeysDown(void)
+{
+	u32 down = g_held & ~g_heldPrevious;
+
+	g_heldPrevious = g_held;
+	return down;
+}
+
+u32 hidKeysDownRepeat(void)
+{
+	return hidKeysDown();
+}
+
+u32 hidKeysHeld(void)
+{
+	return g_held;
+}
+
+u32 hidKeysUp(void)
+{
+	return 0;
+}
+
+void hidTouchRead(touchPosition *pos)
+{
+	pos->px = 0;
+	pos->py = 0;
+}
+
+void hidSetRepeatParameters(u32 delay, u32 interval)
+{
+}
+
+/* System font: not available, so ui_font falls back to the raster the test sets. */
+
+Result fontEnsureMapped(void)
+{
+	return FAKE_RESULT_NOT_FOUND;
+}
+
+CFNT_s *fontGetSystemFont(void)
+{
+	return NULL;
+}
+
+int fontGlyphIndexFromCodePoint(CFNT_s *font, u32 codePoint)
+{
+	return -1;
+}
+
+TGLP_s *fontGetGlyphInfo(CFNT_s *font)
+{
+	return NULL;
+}
+
+charWidthInfo_s *fontGetCharWidthInfo(CFNT_s *font, int glyphIndex)
+{
+	return NULL;
+}
+
+void *fontGetGlyphSheetTex(CFNT_s *font, int sheetId)
+{
+	return NULL;
+}
+
+/* UTF-8/16 helpers, same contracts as libctru's util/utf. */
+
+ssize_t decode_utf8(uint32_t *out, const uint8_t *in)
+{
+	uint32_t code;
+
+	if (in[0] < 0x80) {
+		*out = in[0];
+		return 1;
+	}
+	if ((in[0] & 0xE0) == 0xC0) {
+		if ((in[1] & 0xC0) != 0x80)
+			return -1;
+		code = ((uint32_t)(in[0] & 0x1F) << 6) | (in[1] & 0x3F);
+		if (code < 0x80)
+			return -1;
+		*out = code;
+		return 2;
+	}
+	if ((in[0] & 0xF0) == 0xE0) {
+		if ((in[1] & 0xC0) != 0x80 || (in[2] & 0xC0) != 0x80)
+			return -1;
+		code = ((uint32_t)(in[0] & 0x0F) << 12) | ((uint32_t)(in[1] & 0x3F) << 6) | (in[2] & 0x3F);
+		if (code < 0x800 || (code >= 0xD800 && code < 0xE000))
+			return -1;
+		*out = code;
+		return 3;
+	}
+	if ((in[0] & 0xF8) == 0xF0) {
+		if ((in[1] & 0xC0) != 0x80 || (in[2] & 0xC0) != 0x80 || (in[3] & 0xC0) != 0x80)
+			return -1;
+		code = ((uint32_t)(in[0] & 0x07) << 18) | ((uint32_t)(in[1] & 0x3F) << 12) |
+			((uint32_t)(in[2] & 0x3F) << 6) | (in[3] & 0x3F);
+		if (code < 0x10000 || code > 0x10FFFF)
+			return -1;
+		*out = code;
+		return 4;
+	}
+	return -1;
+}
+
+ssize_t encode_utf8(uint8_t *out, uint32_t in)
+{
+	if (in < 0x80) {
+		if (out != NULL)
+			out[0] = (uint8_t)in;
+		return 1;
+	}
+	if (in < 0x800) {
+		if (out != NULL) {
+			out[0] = (uint8_t)(0xC0 | (in >> 6));
+			out[1] = (uint8_t)(0x80 | (in & 0x3F));
+		}
+		return 2;
+	}
+	if (in < 0x10000) {
+		if (out != NULL) {
+			out[0] = (uint8_t)(0xE0 | (in >> 12));
+			out[1] = (uint8_t)(0x80 | ((in >> 6) & 0x3F));
+			out[2] = (uint8_t)(0x80 | (in & 0x3F));
+		}
+		return 3;
+	}
+	if (in < 0x110000) {
+		if (out != NULL) {
+			out[0] = (uint8_t)(0xF0 | (in >> 18));
+			out[1] = (uint8_t)(0x80 | ((in >> 12) & 0x3F));
+			out[2] = (uint8_t)(0x80 | ((in >> 6) & 0x3F));
+			out[3] = (uint8_t)(0x80 | (in & 0x3F));
+		}
+		return 4;
+	}
+	return -1;
+}
+
+/* Writes whole characters while they fit in len bytes; returns the length of the full text. */
+ssize_t utf16_to_utf8(uint8_t *out, const uint16_t *in, size_t len)
+{
+	ssize_t total = 0;
+
+	while (*in != 0) {
+		uint32_t code = *in++;
+		uint8_t encoded[4];
+		ssize_t units;
+
+		if (code >= 0xD800 && code < 0xDC00) {
+			if (*in < 0xDC00 || *in >= 0xE000)
+				return -1;
+			code = 0x10000 + ((code - 0xD800) << 10) + (*in++ - 0xDC00);
+		}
+		units = encode_utf8(encoded, code);
+		if (units < 0)
+			return -1;
+		if (out != NULL && (size_t)(total + units) <= len) {
+			memcpy(out, encoded, (size_t)units);
+			out += units;
+		}
+		total += units;
+	}
+	return total;
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TESTS_TEST_H
+#define TESTS_TEST_H
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Each tests/test_*.c is one program: CHECK records failures and keeps going, TEST_RESULT()
+ * reports them and is main()'s return value.
+ */
+
+static int g_testFailures = 0;
+static int g_testChecks = 0;
+
+#define CHECK(cond) \
+	do { \
+		g_testChecks++; \
+		if (!(cond)) { \
+			g_testFailures++; \
+			fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+		} \
+	} while (0)
+
+#define CHECK_EQ(a, b) \
+	do { \
+		unsigned long long check_a_ = (unsigned long long)(a); \
+		unsigned long long check_b_ = (unsigned long long)(b); \
+		g_testChecks++; \
+		if (check_a_ != check_b_) { \
+			g_testFailures++; \
+			fprintf(stderr, "%s:%d: %s == %s failed (%llu vs %llu)\n", __FILE__, __LINE__, #a, #b, \
+				check_a_, check_b_); \
+		} \
+	} while (0)
+
+#define CHECK_STR(a, b) \
+	do { \
+		const char *check_a_ = (a); \
+		const char *check_b_ = (b); \
+		g_testChecks++; \
+		if (strcmp(check_a_, check_b_) != 0) { \
+			g_testFailures++; \
+			fprintf(stderr, "%s:%d: %s == %s failed (\"%s\" vs \"%s\")\n", __FILE__, __LINE__, #a, #b, \
+				check_a_, check_b_); \
+		} \
+	} while (0)
+
+#define TEST_RESULT() \
+	(fprintf(stderr, "%s: %d checks, %d failed\n", __FILE__, g_testChecks, g_testFailures), \
+		g_testFailures == 0 ? 0 : 1)
+
+#endif
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Streaming LZ11 decoder and CBMD banner extraction against generated banner fixtures. */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "fake_ctru.h"
+#include "fixtures.h"
+#include "test.h"
+#include "title_banner.h"
+#include "title_lz11.h"
+
+#define RAW_SIZE 40000
+#define TEX_W 16
+#define TEX_H 8
+#define CBMD_MAX (64 * 1024)
+
+typedef struct {
+	u8 *data;
+	u32 size;
+	u32 largest_chunk;
+	u32 abort_after;
+} collect_t;
+
+static u8 g_raw[RAW_SIZE];
+static u8 g_packed[RAW_SIZE * 2];
+static u8 g_out[RAW_SIZE];
+static u8 g_cbmd[CBMD_MAX];
+
+static bool collect(void *ctx, const u8 *data, size_t size)
+{
+	collect_t *c = (collect_t *)ctx;
+
+	if (size > c->largest_chunk)
+		c->largest_chunk = (u32)size;
+	if (c->size + size <= RAW_SIZE)
+		memcpy(c->data + c->size, data, size);
+	c->size += (u32)size;
+	return c->abort_after == 0 || c->size < c->abort_after;
+}
+
+/* Literal runs and copies of earlier data, like the sections of a CGFX. */
+static void make_raw(void)
+{
+	u32 seed = 1;
+	u32 n = 0;
+
+	while (n < RAW_SIZE) {
+		u32 run;
+
+		seed = seed * 1103515245 + 12345;
+		run = 3 + (seed >> 16) % 300;
+		if (n > 16 && (seed & 0x100)) {
+			u32 from = (seed >> 8) % n;
+
+			while (run-- > 0 && n < RAW_SIZE)
+				g_raw[n++] = g_raw[from++];
+		} else {
+			while (run-- > 0 && n < RAW_SIZE) {
+				seed = seed * 1103515245 + 12345;
+				g_raw[n++] = (u8)('A' + (seed >> 24) % 6);
+			}
+		}
+	}
+}
+
+static title_lz11_status_t decode_in_chunks(const u8 *in, u32 size, u32 chunk, collect_t *c)
+{
+	title_lz11_stream_t *stream = (title_lz11_stream_t *)malloc(sizeof(*stream));
+	title_lz11_status_t status = TITLE_LZ11_NEED_INPUT;
+	u32 pos = 0;
+
+	memset(c, 0, sizeof(*c));
+	c->data = g_out;
+	title_lz11_init(stream, collect, c);
+	while (pos < size && status == TITLE_LZ11_NEED_INPUT) {
+		u32 n = size - pos < chunk ? size - pos : chunk;
+
+		status = title_lz11_feed(stream, in + pos, n);
+		pos += n;
+	}
+	free(stream);
+	return status;
+}
+
+static void test_lz11(void)
+{
+	static const u32 chunks[] = { 1, 7, 4096, RAW_SIZE * 2 };
+	static const u8 badHeader[] = { 0x10, 4, 0, 0, 0, 'a', 'b', 'c', 'd' };
+	/* One 3-byte copy reaching 16 bytes back before anything was produced. */
+	static const u8 badDistance[] = { 0x11, 4, 0, 0, 0x80, 0x20, 0x0F };
+	collect_t c;
+	u32 packed;
+	u32 i;
+
+	make_raw();
+	packed = fixture_lz11_compress(g_raw, RAW_SIZE, g_packed, sizeof(g_packed), false);
+	CHECK(packed > 0 && packed < RAW_SIZE / 2);
+
+	for (i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+		CHECK_EQ(decode_in_chunks(g_packed, packed, chunks[i], &c), TITLE_LZ11_DONE);
+		CHECK_EQ(c.size, RAW_SIZE);
+		CHECK(memcmp(g_out, g_raw, RAW_SIZE) == 0);
+		CHECK(c.largest_chunk <= TITLE_LZ11_FLUSH_SIZE);
+	}
+
+	/* 4-byte size header. */
+	packed = fixture_lz11_compress(g_raw, 5000, g_packed, sizeof(g_packed), true);
+	CHECK_EQ(decode_in_chunks(g_packed, packed, 3, &c), TITLE_LZ11_DONE);
+	CHECK_EQ(c.size, 5000);
+	CHECK(memcmp(g_out, g_raw, 5000) == 0);
+
+	/* Truncated input waits for more; a sink that says stop aborts. */
+	packed = fixture_lz11_compress(g_raw, RAW_SIZE, g_packed, sizeof(g_packed), false);
+	CHECK_EQ(decode_in_chunks(g_packed, packed / 2, 64, &c), TITLE_LZ11_NEED_INPUT);
+	memset(&c, 0, sizeof(c));
+	{
+		title_lz11_stream_t *stream = (title_lz11_stream_t *)malloc(sizeof(*stream));
+
+		c.data = g_out;
+		c.abort_after = 10000;
+		title_lz11_init(stream, collect, &c);
+		CHECK_EQ(title_lz11_feed(stream, g_packed, packed), TITLE_LZ11_ABORTED);
+		CHECK(c.size < RAW_SIZE);
+		free(stream);
+	}
+
+	CHECK_EQ(decode_in_chunks(badHeader, sizeof(badHeader), 64, &c), TITLE_LZ11_ERR_HEADER);
+	CHECK_EQ(decode_in_chunks(badDistance, sizeof(badDistance), 64, &c), TITLE_LZ11_ERR_DATA);
+}
+
+/* RGB565 texel at storage (x, y), y counted from the bottom row, is y * 16 + x. */
+static u32 rgb565_texture(u8 *tex)
+{
+	u32 tx;
+	u32 i;
+	u32 n = 0;
+
+	for (tx = 0; tx < TEX_W; tx += 8) {
+		for (i = 0; i < 64; i++) {
+			u32 x = (i & 1) | ((i >> 1) & 2) | ((i >> 2) & 4);
+			u32 y = ((i >> 1) & 1) | ((i >> 2) & 2) | ((i >> 3) & 4);
+			u16 texel = (u16)(y * TEX_W + tx + x);
+
+			memcpy(tex + n, &texel, 2);
+			n += 2;
+		}
+	}
+	return n;
+}
+
+static bool rgb565_pixels_match(const title_banner_t *banner)
+{
+	u32 x;
+	u32 y;
+
+	for (y = 0; y < TEX_H; y++)
+		for (x = 0; x < TEX_W; x++)
+			if (banner->pixels[y * TEX_W + x] != (TEX_H - 1 - y) * TEX_W + x)
+				return false;
+	return true;
+}
+
+static void test_banner(void)
+{
+	u8 tex[TEX_W * TEX_H * 2];
+	u8 etc1[8 * (TEX_W * TEX_H / 16)];
+	/* Individual mode, both halves R = G = B = 8 (136), table 0, every modifier +2. */
+	const u64 block = (8ULL << 60) | (8ULL << 56) | (8ULL << 52) | (8ULL << 48) | (8ULL << 44) | (8ULL << 40);
+	const u16 grey = (u16)(((138 >> 3) << 11) | ((138 >> 2) << 5) | (138 >> 3));
+	title_banner_t banner;
+	u32 texSize = rgb565_texture(tex);
+	u32 size;
+	u32 i;
+
+	size = fixture_cbmd(g_cbmd, CBMD_MAX, 3, TEX_W, TEX_H, tex, texSize, 20000, true);
+	CHECK_EQ(title_banner_parse(g_cbmd, size, &banner), TITLE_BANNER_OK);
+	CHECK_EQ(banner.width, TEX_W);
+	CHECK_EQ(banner.height, TEX_H);
+	CHECK_STR(title_banner_format_name(banner.texture_format), "RGB565");
+	CHECK(rgb565_pixels_match(&banner));
+	/* Decoding stops once the texture is complete; the trailing sections are never produced. */
+	CHECK_EQ(banner.decompressed_size, 0x200 + texSize + 20000);
+	CHECK(banner.decoded_size < banner.decompressed_size);
+
+	size = fixture_cbmd(g_cbmd, CBMD_MAX, 3, TEX_W, TEX_H, tex, texSize, 0, false);
+	CHECK_EQ(title_banner_parse(g_cbmd, size, &banner), TITLE_BANNER_OK);
+	CHECK(rgb565_pixels_match(&banner));
+
+	for (i = 0; i < sizeof(etc1); i += 8)
+		memcpy(etc1 + i, &block, 8);
+	size = fixture_cbmd(g_cbmd, CBMD_MAX, 12, TEX_W, TEX_H, etc1, sizeof(etc1), 0, true);
+	CHECK_EQ(title_banner_parse(g_cbmd, size, &banner), TITLE_BANNER_OK);
+	CHECK_STR(title_banner_format_name(banner.texture_format), "ETC1");
+	for (i = 0; i < TEX_W * TEX_H; i++)
+		if (banner.pixels[i] != grey)
+			break;
+	CHECK_EQ(i, TEX_W * TEX_H);
+
+	/* Texture cut short, wrong magic. */
+	size = fixture_cbmd(g_cbmd, CBMD_MAX, 3, TEX_W, TEX_H, tex, texSize, 0, false);
+	CHECK_EQ(title_banner_parse(g_cbmd, size - 16, &banner), TITLE_BANNER_ERR_FORMAT);
+	memcpy(g_cbmd, "XXXX", 4);
+	CHECK_EQ(title_banner_parse(g_cbmd, size, &banner), TITLE_BANNER_ERR_FORMAT);
+
+	/* Through the fake ExeFS: the second load of the same title is served from the cache. */
+	size = fixture_cbmd(g_cbmd, CBMD_MAX, 3, TEX_W, TEX_H, tex, texSize, 3000, true);
+	fake_ctru_reset();
+	fake_fs_add_file(0x0004000000123400ULL, "banner", g_cbmd, size);
+	CHECK_EQ(title_banner_load(0x0004000000123400ULL, MEDIATYPE_SD, &banner), TITLE_BANNER_OK);
+	CHECK(rgb565_pixels_match(&banner));
+	CHECK_EQ(fake_ctru_counters()->fs_opens, 1);
+	CHECK_EQ(title_banner_load(0x0004000000123400ULL, MEDIATYPE_SD, &banner), TITLE_BANNER_OK);
+	CHECK_EQ(fake_ctru_counters()->fs_opens, 1);
+	CHECK_EQ(title_banner_load(0x0004000000999900ULL, MEDIATYPE_SD, &banner), TITLE_BANNER_ERR_OPEN);
+}
+
+int main(void)
+{
+	test_lz11();
+	test_banner();
+	return TEST_RESULT();
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Pool browser: sort order (case-insensitive name, then title ID, unnamed last), names read on
+ * demand through the 64-entry ring, and resolve_count. */
+
+#include <stdio.h>
+
+#include "test.h"
+#include "title_browser.h"
+
+#define UNNAMED_COUNT (TITLE_BROWSER_NAME_CACHE + 6)
+#define NO_NAME_ID 0x0004000000FFFF00ULL
+
+static title_browser_t g_browser;
+static title_picker_pool_t g_pool;
+static title_source_t g_titles[UNNAMED_COUNT];
+static const char *g_keys[UNNAMED_COUNT];
+static u32 g_resolveCalls;
+
+static const char *key_name(u32 activeIndex, u64 titleId)
+{
+	return g_keys[activeIndex];
+}
+
+static bool resolve_name(u64 titleId, FS_MediaType media, char *out, size_t outSize)
+{
+	g_resolveCalls++;
+	if (titleId == NO_NAME_ID)
+		return false;
+	snprintf(out, outSize, "SMDH %llx", titleId & 0xFFFF);
+	return true;
+}
+
+static void set_titles(u32 count)
+{
+	u32 i;
+
+	memset(g_keys, 0, sizeof(g_keys));
+	for (i = 0; i < count; i++) {
+		g_titles[i].titleId = 0x0004000000100000ULL + i;
+		g_titles[i].media = MEDIATYPE_SD;
+		g_pool.indices[i] = i;
+	}
+	g_pool.count = count;
+}
+
+static void test_sort_order(void)
+{
+	set_titles(6);
+	g_titles[0].titleId = 0x0004000000100300ULL;
+	g_keys[0] = "beta";
+	g_titles[1].titleId = 0x0004000000100200ULL;
+	g_keys[1] = "alpha";
+	g_titles[2].titleId = 0x0004000000100100ULL;
+	g_keys[2] = "Alpha";
+	g_titles[3].titleId = 0x0004000000100020ULL;
+	g_keys[3] = NULL;
+	g_titles[4].titleId = 0x0004000000100010ULL;
+	g_keys[4] = "";
+	g_titles[5].titleId = 0x0004000000100400ULL;
+	g_keys[5] = "Gamma";
+	/* Pool indices past the title list are skipped. */
+	g_pool.indices[g_pool.count++] = 40;
+
+	title_browser_open(&g_browser, &g_pool, g_titles, 6, key_name);
+	CHECK_EQ(g_browser.count, 6);
+	/* Equal names (ignoring case) fall back to the title ID. */
+	CHECK_EQ(g_browser.entries[0].titleId, 0x0004000000100100ULL);
+	CHECK_EQ(g_browser.entries[1].titleId, 0x0004000000100200ULL);
+	CHECK_EQ(g_browser.entries[2].active, 0);
+	CHECK_EQ(g_browser.entries[3].active, 5);
+	/* Unnamed (NULL or empty key) come last, by title ID. */
+	CHECK_EQ(g_browser.entries[4].titleId, 0x0004000000100010ULL);
+	CHECK_EQ(g_browser.entries[5].titleId, 0x0004000000100020ULL);
+	CHECK(g_browser.entries[4].name == NULL);
+	CHECK(g_browser.entries[5].name == NULL);
+
+	CHECK_STR(title_browser_known_name(&g_browser, 3), "Gamma");
+	CHECK(title_browser_known_name(&g_browser, 4) == NULL);
+	CHECK(title_browser_known_name(&g_browser, 6) == NULL);
+	CHECK_STR(title_browser_name(&g_browser, 6, g_titles, resolve_name), "");
+
+	/* No key: everything is unnamed, so the list is in title ID order. */
+	title_browser_open(&g_browser, &g_pool, g_titles, 6, NULL);
+	CHECK_EQ(g_browser.count, 6);
+	CHECK_EQ(g_browser.entries[0].titleId, 0x0004000000100010ULL);
+	CHECK_EQ(g_browser.entries[5].titleId, 0x0004000000100400ULL);
+}
+
+static void test_name_ring(void)
+{
+	u32 i;
+
+	memset(&g_browser, 0, sizeof(g_browser));
+	set_titles(UNNAMED_COUNT);
+	g_keys[0] = "Named";
+	g_titles[1].titleId = NO_NAME_ID;
+	title_browser_open(&g_browser, &g_pool, g_titles, UNNAMED_COUNT, key_name);
+	CHECK_EQ(g_browser.count, UNNAMED_COUNT);
+
+	/* A sort name is never read. */
+	g_resolveCalls = 0;
+	CHECK_STR(title_browser_name(&g_browser, 0, g_titles, resolve_name), "Named");
+	CHECK_EQ(g_resolveCalls, 0);
+	CHECK_EQ(g_browser.resolve_count, 0);
+
+	/* Each unnamed title is read once, then served from the ring. */
+	CHECK(title_browser_known_name(&g_browser, 1) == NULL);
+	CHECK_STR(title_browser_name(&g_browser, 1, g_titles, resolve_name), "SMDH 2");
+	CHECK_STR(title_browser_known_name(&g_browser, 1), "SMDH 2");
+	CHECK_STR(title_browser_name(&g_browser, 1, g_titles, resolve_name), "SMDH 2");
+	CHECK_EQ(g_resolveCalls, 1);
+	CHECK_EQ(g_browser.resolve_count, 1);
+
+	/* No name at all: the title ID, cached like any other. */
+	CHECK_EQ(g_browser.entries[UNNAMED_COUNT - 1].titleId, NO_NAME_ID);
+	CHECK_STR(title_browser_name(&g_browser, UNNAMED_COUNT - 1, g_titles, resolve_name), "0004000000ffff00");
+	CHECK_EQ(g_browser.resolve_count, 2);
+
+	/* Fill the ring past capacity: the oldest names are dropped first. */
+	for (i = 2; i < UNNAMED_COUNT - 1; i++)
+		title_browser_name(&g_browser, i, g_titles, resolve_name);
+	CHECK_EQ(g_browser.resolve_count, UNNAMED_COUNT - 1);
+	CHECK_EQ(g_browser.name_count, TITLE_BROWSER_NAME_CACHE);
+	CHECK(title_browser_known_name(&g_browser, 1) == NULL);
+	CHECK(title_browser_known_name(&g_browser, UNNAMED_COUNT - 1) == NULL);
+	CHECK(title_browser_known_name(&g_browser, 4) == NULL);
+	CHECK_STR(title_browser_known_name(&g_browser, 5), "SMDH 6");
+	CHECK_STR(title_browser_known_name(&g_browser, UNNAMED_COUNT - 2), "SMDH 45");
+
+	/* An evicted name is read again, replacing the next oldest. */
+	g_resolveCalls = 0;
+	CHECK_STR(title_browser_name(&g_browser, 1, g_titles, resolve_name), "SMDH 2");
+	CHECK_EQ(g_resolveCalls, 1);
+	CHECK_EQ(g_browser.resolve_count, UNNAMED_COUNT);
+	CHECK(title_browser_known_name(&g_browser, 5) == NULL);
+	CHECK_STR(title_browser_known_name(&g_browser, 6), "SMDH 7");
+
+	/* The ring outlives a reopen. */
+	title_browser_open(&g_browser, &g_pool, g_titles, UNNAMED_COUNT, key_name);
+	CHECK_STR(title_browser_known_name(&g_browser, 1), "SMDH 2");
+	CHECK_STR(title_browser_name(&g_browser, 6, g_titles, resolve_name), "SMDH 7");
+	CHECK_EQ(g_browser.resolve_count, UNNAMED_COUNT);
+
+	/* Without a resolve function the title ID is shown, and it still counts as a read. */
+	CHECK_STR(title_browser_name(&g_browser, 5, g_titles, NULL), "0004000000100006");
+	CHECK_EQ(g_browser.resolve_count, UNNAMED_COUNT + 1);
+}
+
+int main(void)
+{
+	test_sort_order();
+	test_name_ring();
+	return TEST_RESULT();
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* The table-driven category classes and names against the compare chains they replaced, over
+ * every 16-bit content category and every combination of category filters. */
+
+#include <stdio.h>
+
+#include "test.h"
+#include "title_meta.h"
+
+#define CATEGORY_FILTERS 6
+
+/* Previous title_meta.c predicates and filter chain, verbatim apart from names. */
+
+static bool old_is_patch(u16 category)
+{
+	return category == 0x000E || category == 0x000B;
+}
+
+static bool old_is_dlc(u16 category)
+{
+	return category == 0x008C;
+}
+
+static bool old_is_system(u16 category)
+{
+	return category >= 0x0005 && category <= 0x0009;
+}
+
+static bool old_is_demo(u16 category)
+{
+	return category == 0x0002 || category == 0x000C;
+}
+
+static bool old_is_dsiware(u16 category)
+{
+	return category == 0x0004 || category == 0x000D;
+}
+
+static bool old_is_content_pack(u16 category)
+{
+	return category == 0x0003;
+}
+
+static bool old_passes_filters(u16 category, const title_filter_options_t *filters)
+{
+	if (filters == NULL)
+		return false;
+
+	if (old_is_patch(category))
+		return filters->include_patches;
+
+	if (old_is_dlc(category))
+		return filters->include_dlc;
+
+	if (old_is_system(category))
+		return filters->include_system;
+
+	if (category == 0x0001 || category == 0x000A)
+		return false;
+
+	if (category == 0x000F)
+		return false;
+
+	if (old_is_demo(category))
+		return filters->include_demos;
+
+	if (old_is_dsiware(category))
+		return filters->include_dsiware;
+
+	if (old_is_content_pack(category))
+		return filters->include_content_packs;
+
+	return true;
+}
+
+static const char *old_category_name(u16 contentCategory)
+{
+	switch (contentCategory) {
+	case 0x0000: return "Application";
+	case 0x0001: return "Download Play child";
+	case 0x0002: return "Demo";
+	case 0x0003: return "Content pack";
+	case 0x0004: return "DSiWare app";
+	case 0x0005: return "System application";
+	case 0x0006: return "System applet";
+	case 0x0007: return "Instruction manual";
+	case 0x0008: return "System data";
+	case 0x0009: return "System tool";
+	case 0x000A: return "Download Play parent";
+	case 0x000B: return "DSiWare patch";
+	case 0x000C: return "DSiWare demo";
+	case 0x000D: return "DSiWare content";
+	case 0x000E: return "Patch / update";
+	case 0x000F: return "Certificate store";
+	case 0x008C: return "DLC";
+	default: return "Unknown";
+	}
+}
+
+static void filters_from_bits(u32 bits, title_filter_options_t *filters)
+{
+	filters->include_patches = (bits & 1) != 0;
+	filters->include_dlc = (bits & 2) != 0;
+	filters->include_system = (bits & 4) != 0;
+	filters->include_demos = (bits & 8) != 0;
+	filters->include_dsiware = (bits & 16) != 0;
+	filters->include_content_packs = (bits & 32) != 0;
+	/* Not category filters: the picker applies them from the title ID. */
+	filters->include_native_apps = (bits & 1) == 0;
+	filters->include_virtual_console = (bits & 2) == 0;
+}
+
+int main(void)
+{
+	u32 filterMismatches = 0;
+	u32 nameMismatches = 0;
+	u32 classMismatches = 0;
+	u32 bits;
+	u32 c;
+
+	for (c = 0; c <= 0xFFFF; c++) {
+		u16 category = (u16)c;
+		u32 cls = title_meta_category_class(category);
+
+		if (strcmp(title_meta_category_name(category), old_category_name(category)) != 0) {
+			if (nameMismatches++ == 0)
+				fprintf(stderr, "first name mismatch: 0x%04X\n", (unsigned)c);
+		}
+		/* Exactly one class bit, and its index maps back to it. */
+		if (cls == 0 || (cls & (cls - 1)) != 0 || (1u << title_meta_class_index(cls)) != cls)
+			classMismatches++;
+
+		for (bits = 0; bits < (1u << CATEGORY_FILTERS); bits++) {
+			title_filter_options_t filters;
+
+			filters_from_bits(bits, &filters);
+			if (title_meta_passes_filters(category, &filters) != old_passes_filters(category, &filters)) {
+				if (filterMismatches++ == 0)
+					fprintf(stderr, "first filter mismatch: 0x%04X with filters 0x%02X\n", (unsigned)c,
+						(unsigned)bits);
+			}
+		}
+	}
+
+	CHECK_EQ(nameMismatches, 0);
+	CHECK_EQ(classMismatches, 0);
+	CHECK_EQ(filterMismatches, 0);
+	CHECK(!title_meta_passes_filters(0x0000, NULL));
+	CHECK_EQ(title_meta_category_class(0x008C), TITLE_CLASS_DLC);
+	CHECK_EQ(title_meta_category_class(0x018C), TITLE_CLASS_OTHER);
+	CHECK_EQ(title_meta_category_class(0x0001), TITLE_CLASS_HIDDEN);
+
+	return TEST_RESULT();
+}
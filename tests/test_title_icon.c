@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Tiled RGB565 icon de-swizzle against known tile patterns, and the bottom-screen blit. */
+
+#include <string.h>
+
+#include "fake_ctru.h"
+#include "test.h"
+#include "title_icon.h"
+
+#define DIM TITLE_ICON_LARGE_DIM
+#define BOTTOM_HEIGHT 240
+
+static u16 g_tiled[DIM * DIM];
+static u16 g_out[DIM * DIM];
+
+/* Reference: Morton index i inside a tile holds x from the even bits and y from the odd bits. */
+static void reference_decode(const u16 *tiled, u32 dim, u16 *out)
+{
+	u32 i;
+
+	for (i = 0; i < dim * dim; i++) {
+		u32 tile = i / 64;
+		u32 m = i % 64;
+		u32 x = (m & 1) | ((m >> 1) & 2) | ((m >> 2) & 4);
+		u32 y = ((m >> 1) & 1) | ((m >> 2) & 2) | ((m >> 3) & 4);
+
+		x += (tile % (dim / 8)) * 8;
+		y += (tile / (dim / 8)) * 8;
+		out[y * dim + x] = tiled[i];
+	}
+}
+
+static void check_dim(u32 dim)
+{
+	u16 expect[DIM * DIM];
+	u32 i;
+
+	for (i = 0; i < dim * dim; i++)
+		g_tiled[i] = (u16)(i * 7 + 3);
+	reference_decode(g_tiled, dim, expect);
+	memset(g_out, 0, sizeof(g_out));
+	title_icon_decode_rgb565(g_tiled, dim, g_out);
+	CHECK(memcmp(g_out, expect, dim * dim * sizeof(u16)) == 0);
+}
+
+int main(void)
+{
+	u16 *fb;
+	u32 i;
+	u32 x;
+	u32 y;
+
+	/* Index pattern: the first tile's Z walk, then the next tile to the right and below. */
+	for (i = 0; i < DIM * DIM; i++)
+		g_tiled[i] = (u16)i;
+	title_icon_decode_rgb565(g_tiled, DIM, g_out);
+	CHECK_EQ(g_out[0], 0);
+	CHECK_EQ(g_out[1], 1);
+	CHECK_EQ(g_out[DIM], 2);
+	CHECK_EQ(g_out[DIM + 1], 3);
+	CHECK_EQ(g_out[2], 4);
+	CHECK_EQ(g_out[4], 16);
+	CHECK_EQ(g_out[7 * DIM + 7], 63);
+	CHECK_EQ(g_out[8], 64);
+	CHECK_EQ(g_out[8 * DIM], 64 * (DIM / 8));
+	CHECK_EQ(g_out[DIM * DIM - 1], DIM * DIM - 1);
+
+	/* Solid tiles: tile t filled with color t decodes to uniform 8x8 blocks. */
+	for (i = 0; i < DIM * DIM; i++)
+		g_tiled[i] = (u16)(i / 64);
+	title_icon_decode_rgb565(g_tiled, DIM, g_out);
+	for (y = 0; y < DIM; y += 7)
+		for (x = 0; x < DIM; x += 5)
+			CHECK_EQ(g_out[y * DIM + x], (y / 8) * (DIM / 8) + x / 8);
+
+	check_dim(8);
+	check_dim(TITLE_ICON_SMALL_DIM);
+	check_dim(DIM);
+
+	/* Sizes that are not whole tiles are rejected without touching the output. */
+	memset(g_out, 0xAB, sizeof(g_out));
+	title_icon_decode_rgb565(g_tiled, 12, g_out);
+	CHECK_EQ(g_out[0], 0xABAB);
+
+	/* Blit at 2x: framebuffer columns run bottom to top, 240 pixels each. */
+	for (i = 0; i < DIM * DIM; i++)
+		g_out[i] = (u16)(i + 1);
+	title_icon_clear_bottom(0);
+	title_icon_draw_bottom(g_out, DIM, DIM, 10, 20, 2);
+	fb = fake_gfx_framebuffer(GFX_BOTTOM);
+	CHECK_EQ(fb[10 * BOTTOM_HEIGHT + (BOTTOM_HEIGHT - 1 - 20)], g_out[0]);
+	CHECK_EQ(fb[11 * BOTTOM_HEIGHT + (BOTTOM_HEIGHT - 1 - 21)], g_out[0]);
+	CHECK_EQ(fb[12 * BOTTOM_HEIGHT + (BOTTOM_HEIGHT - 1 - 20)], g_out[1]);
+	CHECK_EQ(fb[10 * BOTTOM_HEIGHT + (BOTTOM_HEIGHT - 1 - 22)], g_out[DIM]);
+	CHECK_EQ(fb[9 * BOTTOM_HEIGHT + (BOTTOM_HEIGHT - 1 - 20)], 0);
+	CHECK_EQ(fb[(10 + 2 * DIM) * BOTTOM_HEIGHT + (BOTTOM_HEIGHT - 1 - 20)], 0);
+
+	/* An image that would run off the screen is skipped. */
+	title_icon_clear_bottom(0);
+	title_icon_draw_bottom(g_out, DIM, DIM, 300, 0, 1);
+	CHECK_EQ(fb[300 * BOTTOM_HEIGHT + BOTTOM_HEIGHT - 1], 0);
+
+	return TEST_RESULT();
+}
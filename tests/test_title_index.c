@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Background SMDH indexer against a slow fake SD card: names land in order, and a pause only
+ * returns once no read is in flight. */
+
+#include "fake_ctru.h"
+#include "fixtures.h"
+#include "test.h"
+#include "title_index.h"
+
+#define TITLE_COUNT 8
+#define READ_LATENCY_US 20000
+
+static u8 g_smdh[TITLE_COUNT][FIXTURE_SMDH_SIZE];
+
+static void wait_until(bool (*done)(void))
+{
+	u32 waited = 0;
+
+	while (!done() && waited < 5000) {
+		svcSleepThread(1000 * 1000);
+		waited++;
+	}
+}
+
+static bool read_started(void)
+{
+	return fake_fs_reads_in_flight() > 0;
+}
+
+static bool all_indexed(void)
+{
+	return title_index_done_count() == TITLE_COUNT;
+}
+
+int main(void)
+{
+	title_source_t titles[TITLE_COUNT];
+	char name[32];
+	u32 done;
+	u32 i;
+
+	fake_ctru_reset();
+	for (i = 0; i < TITLE_COUNT; i++) {
+		titles[i].titleId = 0x0004000000100000ULL + ((u64)i << 8);
+		titles[i].media = MEDIATYPE_SD;
+		snprintf(name, sizeof(name), "Title %u", (unsigned)i);
+		fixture_smdh(g_smdh[i], name, "Publisher", (u16)i);
+		fake_fs_add_file(titles[i].titleId, "icon", g_smdh[i], FIXTURE_SMDH_SIZE);
+	}
+	fake_fs_set_latency_us(READ_LATENCY_US);
+
+	title_index_sync(titles, TITLE_COUNT);
+	CHECK_EQ(title_index_total_count(), TITLE_COUNT);
+
+	/* Pause while the worker is inside a read: the call waits that read out. */
+	wait_until(read_started);
+	CHECK(read_started());
+	title_index_pause();
+	CHECK_EQ(fake_fs_reads_in_flight(), 0);
+	done = title_index_done_count();
+	svcSleepThread(3LL * READ_LATENCY_US * 1000);
+	CHECK_EQ(fake_fs_reads_in_flight(), 0);
+	CHECK_EQ(title_index_done_count(), done);
+
+	/* Nested pauses need as many resumes. */
+	title_index_pause();
+	title_index_resume();
+	svcSleepThread(2LL * READ_LATENCY_US * 1000);
+	CHECK_EQ(title_index_done_count(), done);
+	title_index_resume();
+
+	wait_until(all_indexed);
+	CHECK_EQ(title_index_done_count(), TITLE_COUNT);
+	for (i = 0; i < TITLE_COUNT; i++) {
+		const title_index_entry_t *entry = title_index_lookup(i, titles[i].titleId);
+
+		snprintf(name, sizeof(name), "Title %u", (unsigned)i);
+		CHECK(entry != NULL);
+		if (entry != NULL) {
+			CHECK_EQ(entry->smdh_result, TITLE_SMDH_OK);
+			CHECK_STR(entry->name, name);
+			CHECK_STR(entry->publisher, "Publisher");
+		}
+	}
+	CHECK(title_index_lookup(0, titles[1].titleId) == NULL);
+	CHECK_EQ(fake_ctru_counters()->fs_reads_peak, 1);
+
+	/* Same list again: nothing to do, no new reads. */
+	fake_ctru_reset_counters();
+	title_index_sync(titles, TITLE_COUNT);
+	CHECK_EQ(fake_ctru_counters()->fs_reads, 0);
+
+	title_index_stop();
+	return TEST_RESULT();
+}
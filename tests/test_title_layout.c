@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Line layout by display columns: mixed ASCII, kana and kanji names break at spaces and ';',
+ * split over-wide words between code points, and every line fits its width. */
+
+#include <stdio.h>
+
+#include "test.h"
+#include "title_layout.h"
+
+typedef struct {
+	const char *text;
+	u32 width;
+	/* Expected lines joined with '|'. */
+	const char *lines;
+} layout_case_t;
+
+static const layout_case_t s_cases[] = {
+	{ "Mario Kart 7", 20, "Mario Kart 7" },
+	{ "The Legend of Zelda: Ocarina of Time 3D", 20, "The Legend of Zelda:|Ocarina of Time 3D" },
+	/* ゼルダの伝説 時のオカリナ 3D: six wide characters fill 12 columns exactly. */
+	{ "\xE3\x82\xBC\xE3\x83\xAB\xE3\x83\x80\xE3\x81\xAE\xE4\xBC\x9D\xE8\xAA\xAC \xE6\x99\x82\xE3\x81\xAE\xE3\x82\xAA\xE3\x82\xAB\xE3\x83\xAA\xE3\x83\x8A 3D", 12,
+	  "\xE3\x82\xBC\xE3\x83\xAB\xE3\x83\x80\xE3\x81\xAE\xE4\xBC\x9D\xE8\xAA\xAC|\xE6\x99\x82\xE3\x81\xAE\xE3\x82\xAA\xE3\x82\xAB\xE3\x83\xAA\xE3\x83\x8A|3D" },
+	/* どうぶつの森 at an odd width: a wide character never straddles the edge. */
+	{ "\xE3\x81\xA9\xE3\x81\x86\xE3\x81\xB6\xE3\x81\xA4\xE3\x81\xAE\xE6\xA3\xAE", 5,
+	  "\xE3\x81\xA9\xE3\x81\x86|\xE3\x81\xB6\xE3\x81\xA4|\xE3\x81\xAE\xE6\xA3\xAE" },
+	/* ファイアーエムブレム Fates */
+	{ "\xE3\x83\x95\xE3\x82\xA1\xE3\x82\xA4\xE3\x82\xA2\xE3\x83\xBC\xE3\x82\xA8\xE3\x83\xA0\xE3\x83\x96\xE3\x83\xAC\xE3\x83\xA0 Fates", 20,
+	  "\xE3\x83\x95\xE3\x82\xA1\xE3\x82\xA4\xE3\x82\xA2\xE3\x83\xBC\xE3\x82\xA8\xE3\x83\xA0\xE3\x83\x96\xE3\x83\xAC\xE3\x83\xA0|Fates" },
+	/* é is two bytes but one column; the ';' stays on the first line. */
+	{ "Pok\xC3\xA9mon X;Pok\xC3\xA9mon Y", 12, "Pok\xC3\xA9mon X;|Pok\xC3\xA9mon Y" },
+	/* ポケモン超不思議のダンジョン has no spaces at all. */
+	{ "\xE3\x83\x9D\xE3\x82\xB1\xE3\x83\xA2\xE3\x83\xB3\xE8\xB6\x85\xE4\xB8\x8D\xE6\x80\x9D\xE8\xAD\xB0\xE3\x81\xAE\xE3\x83\x80\xE3\x83\xB3\xE3\x82\xB8\xE3\x83\xA7\xE3\x83\xB3", 10,
+	  "\xE3\x83\x9D\xE3\x82\xB1\xE3\x83\xA2\xE3\x83\xB3\xE8\xB6\x85|\xE4\xB8\x8D\xE6\x80\x9D\xE8\xAD\xB0\xE3\x81\xAE\xE3\x83\x80|\xE3\x83\xB3\xE3\x82\xB8\xE3\x83\xA7\xE3\x83\xB3" },
+	{ "Supercalifragilistic", 8, "Supercal|ifragili|stic" },
+	/* SMDH newlines are break candidates that render as spaces, not forced breaks. */
+	{ "Nintendo\neShop", 20, "Nintendo\neShop" },
+	{ "Nintendo\neShop", 10, "Nintendo|eShop" },
+	/* A 漢字 at width 3: the space breaks first, then the word splits. */
+	{ "A \xE6\xBC\xA2\xE5\xAD\x97", 3, "A|\xE6\xBC\xA2|\xE5\xAD\x97" },
+};
+
+static const char *joined_lines(const title_layout_t *layout, const char *text)
+{
+	static char out[512];
+	size_t n = 0;
+	u32 i;
+
+	out[0] = '\0';
+	for (i = 0; i < layout->line_count; i++) {
+		const title_layout_line_t *line = &layout->lines[i];
+
+		n += (size_t)snprintf(out + n, sizeof(out) - n, "%s%.*s", i == 0 ? "" : "|", (int)line->length,
+			text + line->offset);
+	}
+	return out;
+}
+
+/* Lines are in order, fit the width (a lone wide character at width 1 aside), report their real
+ * columns, and only drop spaces between them. */
+static void check_invariants(const char *text, u32 width)
+{
+	title_layout_t layout = { 0 };
+	u32 end = 0;
+	u32 i;
+
+	title_layout_wrap(&layout, text, width);
+	CHECK(layout.line_count > 0 || text[0] == '\0');
+	for (i = 0; i < layout.line_count; i++) {
+		const title_layout_line_t *line = &layout.lines[i];
+		u32 gap;
+
+		CHECK(line->offset >= end);
+		for (gap = end; gap < line->offset; gap++)
+			CHECK(text[gap] == ' ' || text[gap] == '\n');
+		CHECK(line->length > 0);
+		CHECK(line->columns <= width || (width == 1 && line->columns == 2));
+		CHECK_EQ(line->columns, title_layout_columns(text + line->offset, line->length));
+		end = line->offset + line->length;
+	}
+	if (layout.line_count < TITLE_LAYOUT_LINES_MAX)
+		CHECK_EQ(end, strlen(text));
+}
+
+int main(void)
+{
+	title_layout_t layout = { 0 };
+	const title_layout_t *result;
+	u32 width;
+	u32 i;
+
+	CHECK_EQ(title_layout_columns("Pok\xC3\xA9mon", 8), 7);
+	CHECK_EQ(title_layout_columns(s_cases[2].text, strlen(s_cases[2].text)), 12 + 1 + 12 + 1 + 2);
+	CHECK_EQ(title_layout_columns("ab\xE6\xBC\xA2", 2), 2);
+	CHECK_EQ(title_layout_codepoint_columns(0xFF21), 2);
+	CHECK_EQ(title_layout_codepoint_columns(0x00E9), 1);
+
+	for (i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+		memset(&layout, 0, sizeof(layout));
+		title_layout_wrap(&layout, s_cases[i].text, s_cases[i].width);
+		CHECK_STR(joined_lines(&layout, s_cases[i].text), s_cases[i].lines);
+		for (width = 1; width <= 50; width++)
+			check_invariants(s_cases[i].text, width);
+	}
+
+	/* Memoized by width: the same width returns the stored breaks, a new one recomputes. */
+	memset(&layout, 0, sizeof(layout));
+	title_layout_wrap(&layout, s_cases[1].text, 20);
+	result = title_layout_wrap(&layout, "ignored", 20);
+	CHECK(result == &layout);
+	CHECK_EQ(layout.line_count, 2);
+	title_layout_wrap(&layout, s_cases[1].text, 50);
+	CHECK_EQ(layout.line_count, 1);
+	CHECK_EQ(layout.lines[0].columns, 39);
+
+	/* Lines past the cap are dropped rather than overflowing the struct. */
+	memset(&layout, 0, sizeof(layout));
+	title_layout_wrap(&layout, "a b c d e f g h i j k", 1);
+	CHECK_EQ(layout.line_count, TITLE_LAYOUT_LINES_MAX);
+	CHECK_STR(joined_lines(&layout, "a b c d e f g h i j k"), "a|b|c|d|e|f|g|h");
+
+	return TEST_RESULT();
+}
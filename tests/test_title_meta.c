@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* AM IPC per scan and per reroll against the fake AM: title info comes from batched scan-time
+ * calls, so a reroll costs nothing; the call counter stays exact across threads. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fake_ctru.h"
+#include "test.h"
+#include "title_meta.h"
+#include "title_scan.h"
+
+#define TITLE_COUNT 800
+#define REROLLS 200
+#define COUNT_THREADS 4
+#define COUNT_CALLS 50000
+
+static fake_am_title_t g_titles[TITLE_COUNT];
+static title_scan_t g_scan;
+
+static u64 title_id(u32 i)
+{
+	return 0x0004000000000000ULL | ((u64)(i + 1) << 8);
+}
+
+static u32 am_calls(void)
+{
+	return fake_ctru_counters()->am_calls;
+}
+
+/* What a reroll does now: decode the ID and copy the scan-table row. */
+static void reroll_from_scan(u32 row, title_meta_t *meta)
+{
+	title_meta_load(g_scan.titles[row], MEDIATYPE_SD, meta);
+	title_meta_set_title_info(meta, g_scan.info_results[row], g_scan.sizes[row], g_scan.versions[row]);
+}
+
+/* The previous per-pick path: one AM_GetTitleInfo per reroll. */
+static void reroll_per_pick(u32 row, title_meta_t *meta)
+{
+	u64 size = 0;
+	u16 version = 0;
+	Result res = 0;
+
+	title_meta_load(g_scan.titles[row], MEDIATYPE_SD, meta);
+	title_meta_fetch_info(MEDIATYPE_SD, &g_scan.titles[row], 1, &size, &version, &res);
+	title_meta_set_title_info(meta, res, size, version);
+}
+
+static void count_thread_main(void *arg)
+{
+	u32 i;
+
+	(void)arg;
+	for (i = 0; i < COUNT_CALLS; i++) {
+		title_meta_t meta = { 0 };
+
+		title_meta_load_lazy(g_titles[0].title_id, MEDIATYPE_SD, &meta);
+	}
+}
+
+int main(void)
+{
+	u64 ids[10];
+	u64 sizes[10];
+	u16 versions[10];
+	Result results[10];
+	Thread threads[COUNT_THREADS];
+	title_meta_t meta;
+	u32 before;
+	u32 perPick;
+	u32 fromScan;
+	u32 i;
+
+	fake_ctru_reset();
+	for (i = 0; i < TITLE_COUNT; i++) {
+		g_titles[i].title_id = title_id(i);
+		g_titles[i].size = (u64)(i + 1) * 1024 * 1024;
+		g_titles[i].version = (u16)(i * 16);
+		g_titles[i].product_code = "CTR-P-TEST";
+	}
+	fake_am_set_titles(MEDIATYPE_SD, g_titles, TITLE_COUNT);
+
+	/* Scan: one list call, then title info in batches of TITLE_META_INFO_BATCH. */
+	CHECK_EQ(title_scan_media(&g_scan, MEDIATYPE_SD), 0);
+	CHECK_EQ(g_scan.count, TITLE_COUNT);
+	CHECK_EQ(fake_ctru_counters()->am_list_calls, 1);
+	CHECK_EQ(fake_ctru_counters()->am_info_calls,
+		(TITLE_COUNT + TITLE_META_INFO_BATCH - 1) / TITLE_META_INFO_BATCH);
+	CHECK_EQ(g_scan.sizes[799], 800ULL * 1024 * 1024);
+	CHECK_EQ(g_scan.versions[10], 160);
+	CHECK_EQ(title_meta_am_call_count(), fake_ctru_counters()->am_info_calls);
+
+	before = am_calls();
+	for (i = 0; i < REROLLS; i++)
+		reroll_per_pick((i * 7919) % TITLE_COUNT, &meta);
+	perPick = am_calls() - before;
+
+	before = am_calls();
+	for (i = 0; i < REROLLS; i++)
+		reroll_from_scan((i * 7919) % TITLE_COUNT, &meta);
+	fromScan = am_calls() - before;
+	printf("AM calls per reroll: %.2f per-pick lookup, %.2f from the scan table\n",
+		(double)perPick / REROLLS, (double)fromScan / REROLLS);
+	CHECK_EQ(perPick, REROLLS);
+	CHECK_EQ(fromScan, 0);
+	CHECK_EQ(meta.installed_size, g_scan.sizes[((REROLLS - 1) * 7919) % TITLE_COUNT]);
+
+	/* TECHNICAL page fields: two calls the first time, none after. */
+	before = am_calls();
+	title_meta_load_lazy(g_scan.titles[3], MEDIATYPE_SD, &meta);
+	title_meta_load_lazy(g_scan.titles[3], MEDIATYPE_SD, &meta);
+	CHECK_EQ(am_calls() - before, 2);
+	CHECK_STR(meta.lazy.product_code, "CTR-P-TEST");
+
+	/* One unknown ID fails its batch; the retry isolates it. */
+	for (i = 0; i < 10; i++)
+		ids[i] = title_id(i);
+	ids[4] = 0x0004000000FFFF00ULL;
+	before = am_calls();
+	CHECK_EQ(title_meta_fetch_info(MEDIATYPE_SD, ids, 10, sizes, versions, results), 9);
+	CHECK_EQ(am_calls() - before, 1 + 10);
+	CHECK(R_FAILED(results[4]));
+	CHECK(R_SUCCEEDED(results[5]));
+	CHECK_EQ(sizes[5], 6ULL * 1024 * 1024);
+
+	/* Concurrent callers: no increment is lost. A one-title list keeps the fake calls short so
+	 * the increments collide. */
+	fake_am_set_titles(MEDIATYPE_SD, g_titles, 1);
+	fake_ctru_reset_counters();
+	before = title_meta_am_call_count();
+	for (i = 0; i < COUNT_THREADS; i++)
+		threads[i] = threadCreate(count_thread_main, NULL, 16 * 1024, 0x30, -2, false);
+	for (i = 0; i < COUNT_THREADS; i++) {
+		threadJoin(threads[i], U64_MAX);
+		threadFree(threads[i]);
+	}
+	CHECK_EQ(title_meta_am_call_count() - before, COUNT_THREADS * COUNT_CALLS * 2);
+	CHECK_EQ(am_calls(), COUNT_THREADS * COUNT_CALLS * 2);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Background library refresh against the fake AM: unchanged, changed and failed rescans. */
+
+#include "fake_ctru.h"
+#include "test.h"
+#include "title_scan.h"
+
+#define TITLE_COUNT 40
+#define FAKE_AM_ERROR ((Result)0xD8E08001)
+
+static fake_am_title_t g_sdTitles[TITLE_COUNT + 1];
+static fake_am_title_t g_nandTitles[4];
+static title_scan_t g_sd;
+static title_scan_t g_nand;
+
+static title_scan_refresh_t run_refresh(void)
+{
+	title_scan_refresh_t state;
+	u32 waited = 0;
+
+	title_scan_refresh_start(&g_sd, &g_nand);
+	while ((state = title_scan_refresh_poll()) == TITLE_SCAN_REFRESH_RUNNING && waited++ < 5000)
+		svcSleepThread(1000 * 1000);
+	return state;
+}
+
+int main(void)
+{
+	u32 i;
+
+	fake_ctru_reset();
+	for (i = 0; i < TITLE_COUNT + 1; i++) {
+		g_sdTitles[i].title_id = 0x0004000000100000ULL + ((u64)i << 8);
+		g_sdTitles[i].size = 1024;
+	}
+	for (i = 0; i < 4; i++)
+		g_nandTitles[i].title_id = 0x0004001000020000ULL + ((u64)i << 8);
+	fake_am_set_titles(MEDIATYPE_SD, g_sdTitles, TITLE_COUNT);
+	fake_am_set_titles(MEDIATYPE_NAND, g_nandTitles, 4);
+
+	CHECK_EQ(title_scan_media(&g_sd, MEDIATYPE_SD), 0);
+	CHECK_EQ(title_scan_media(&g_nand, MEDIATYPE_NAND), 0);
+	CHECK_EQ(g_sd.count, TITLE_COUNT);
+
+	CHECK_EQ(run_refresh(), TITLE_SCAN_REFRESH_UNCHANGED);
+	title_scan_refresh_take(&g_sd, &g_nand);
+	CHECK_EQ(g_sd.count, TITLE_COUNT);
+
+	/* A failing SD list must not read as "every title was uninstalled". */
+	fake_am_fail(MEDIATYPE_SD, FAKE_AM_ERROR);
+	CHECK_EQ(run_refresh(), TITLE_SCAN_REFRESH_FAILED);
+	title_scan_refresh_take(&g_sd, &g_nand);
+	CHECK_EQ(g_sd.count, TITLE_COUNT);
+	CHECK_EQ(g_nand.count, 4);
+	fake_am_fail(MEDIATYPE_SD, 0);
+
+	fake_am_fail(MEDIATYPE_NAND, FAKE_AM_ERROR);
+	CHECK_EQ(run_refresh(), TITLE_SCAN_REFRESH_FAILED);
+	title_scan_refresh_take(&g_sd, &g_nand);
+	CHECK_EQ(g_nand.count, 4);
+	fake_am_fail(MEDIATYPE_NAND, 0);
+
+	/* One title installed: the new list replaces the old one. */
+	fake_am_set_titles(MEDIATYPE_SD, g_sdTitles, TITLE_COUNT + 1);
+	CHECK_EQ(run_refresh(), TITLE_SCAN_REFRESH_CHANGED);
+	title_scan_refresh_take(&g_sd, &g_nand);
+	CHECK_EQ(g_sd.count, TITLE_COUNT + 1);
+	CHECK_EQ(g_sd.titles[TITLE_COUNT], g_sdTitles[TITLE_COUNT].title_id);
+	CHECK_EQ(title_scan_refresh_poll(), TITLE_SCAN_REFRESH_IDLE);
+
+	title_scan_refresh_stop();
+	return TEST_RESULT();
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Incremental name search against a brute-force scan: after every keystroke, delete and name
+ * update the results are exactly the catalog names containing the query, in entry order. */
+
+#include <ctype.h>
+
+#include "catalog_names.h"
+#include "test.h"
+#include "title_search.h"
+
+static title_search_t g_search;
+static const char *g_names[TITLE_SEARCH_MAX];
+
+static bool name_contains(const char *name, const char *query)
+{
+	size_t n = strlen(query);
+	size_t i;
+	size_t j;
+
+	if (name == NULL)
+		return n == 0;
+	for (i = 0; name[i] != '\0' || n == 0; i++) {
+		for (j = 0; j < n && name[i + j] != '\0'; j++) {
+			if (tolower((unsigned char)name[i + j]) != query[j])
+				break;
+		}
+		if (j == n)
+			return true;
+	}
+	return false;
+}
+
+/* Results must equal the brute-force scan, entry for entry. */
+static bool results_match(void)
+{
+	u32 pos = 0;
+	u32 i;
+
+	for (i = 0; i < g_search.count; i++) {
+		if (!name_contains(g_names[i], g_search.query))
+			continue;
+		if (pos >= g_search.result_count || g_search.results[pos] != i)
+			return false;
+		pos++;
+	}
+	return pos == g_search.result_count;
+}
+
+static void type_query(const char *query)
+{
+	u32 i;
+
+	title_search_set_query(&g_search, "");
+	CHECK(results_match());
+	for (i = 0; query[i] != '\0'; i++) {
+		title_search_push(&g_search, query[i]);
+		CHECK(results_match());
+	}
+	for (i = 0; query[i] != '\0'; i++) {
+		title_search_pop(&g_search);
+		CHECK(results_match());
+	}
+	CHECK_EQ(g_search.result_count, g_search.count);
+}
+
+int main(void)
+{
+	static const char *const queries[] = { "Mario Kart", "zelda", "POKEMON", "3d", "the ", "(tm)", "xyzzy" };
+	u32 compares;
+	u32 i;
+
+	title_search_reset(&g_search);
+	for (i = 0; i < TITLE_SEARCH_MAX; i++) {
+		/* Every seventh name is not known yet, like titles the browser reads on demand. */
+		g_names[i] = i % 7 == 3 ? NULL : catalog_name(i * 5);
+		CHECK_EQ(title_search_add(&g_search, g_names[i]), i);
+	}
+	CHECK_EQ(title_search_add(&g_search, "full"), -1);
+	CHECK_EQ(g_search.result_count, TITLE_SEARCH_MAX);
+
+	for (i = 0; i < sizeof(queries) / sizeof(queries[0]); i++)
+		type_query(queries[i]);
+
+	/* set_query only edits past the common prefix, case-insensitively; deleting compares nothing. */
+	title_search_set_query(&g_search, "mario");
+	title_search_set_query(&g_search, "MARIO PARTY");
+	CHECK_STR(g_search.query, "mario party");
+	CHECK(results_match());
+	compares = g_search.compare_count;
+	title_search_set_query(&g_search, "mario");
+	CHECK_EQ(g_search.compare_count, compares);
+	CHECK(results_match());
+
+	/* Names resolved later join (or leave) the current results in place. */
+	for (i = 3; i < TITLE_SEARCH_MAX; i += 7) {
+		g_names[i] = i % 2 == 0 ? "Mario Party: The Top 100" : "Kirby: Planet Robobot";
+		title_search_set_name(&g_search, i, g_names[i]);
+	}
+	CHECK(results_match());
+	g_names[0] = "Zelda";
+	title_search_set_name(&g_search, 0, g_names[0]);
+	CHECK(results_match());
+	title_search_push(&g_search, ' ');
+	CHECK(results_match());
+
+	/* One-letter queries are decided by the character mask alone. */
+	title_search_set_query(&g_search, "");
+	compares = g_search.compare_count;
+	title_search_push(&g_search, 'k');
+	CHECK_EQ(g_search.compare_count, compares);
+	CHECK(results_match());
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Library snapshot round trip in a scratch directory standing in for the SD card, and the
+ * cases that must make it unusable. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "title_snapshot.h"
+
+/* snapshot_header_t: magic, version, header_size, then the APP_VERSION hash. */
+#define HEADER_APP_HASH_OFFSET 8
+
+static title_scan_t g_sd;
+static title_scan_t g_nand;
+static title_source_t g_active[8];
+static u32 g_activeCount;
+static title_stats_t g_stats;
+static title_picker_pool_t g_pool;
+
+static title_snapshot_t make_snapshot(void)
+{
+	title_snapshot_t snapshot;
+
+	memset(&snapshot, 0, sizeof(snapshot));
+	snapshot.sd = &g_sd;
+	snapshot.nand = &g_nand;
+	snapshot.active = g_active;
+	snapshot.active_count = &g_activeCount;
+	snapshot.stats = &g_stats;
+	snapshot.pool = &g_pool;
+	snapshot.media_mask = TITLE_SNAPSHOT_MEDIA_BIT(MEDIATYPE_SD) | TITLE_SNAPSHOT_MEDIA_BIT(MEDIATYPE_NAND);
+	snapshot.settings_hash = 0x1234;
+	return snapshot;
+}
+
+static void fill_library(void)
+{
+	u32 i;
+
+	memset(&g_sd, 0, sizeof(g_sd));
+	memset(&g_nand, 0, sizeof(g_nand));
+	g_sd.count = 5;
+	for (i = 0; i < g_sd.count; i++) {
+		g_sd.titles[i] = 0x0004000000100000ULL + ((u64)i << 8);
+		g_sd.sizes[i] = 1000 + i;
+		g_active[i].titleId = g_sd.titles[i];
+		g_active[i].media = MEDIATYPE_SD;
+	}
+	g_nand.count = 1;
+	g_nand.titles[0] = 0x0004001000020000ULL;
+	g_activeCount = g_sd.count;
+	memset(&g_stats, 0, sizeof(g_stats));
+	g_stats.total = g_sd.count;
+	g_pool.count = 3;
+	g_pool.indices[0] = 0;
+	g_pool.indices[1] = 2;
+	g_pool.indices[2] = 4;
+}
+
+static void clear_library(void)
+{
+	memset(&g_sd, 0, sizeof(g_sd));
+	memset(&g_nand, 0, sizeof(g_nand));
+	memset(g_active, 0, sizeof(g_active));
+	g_activeCount = 0;
+	memset(&g_stats, 0, sizeof(g_stats));
+	memset(&g_pool, 0, sizeof(g_pool));
+}
+
+static void poke_header(long offset, u32 value)
+{
+	FILE *file = fopen(TITLE_SNAPSHOT_PATH, "r+b");
+
+	CHECK(file != NULL);
+	if (file == NULL)
+		return;
+	fseek(file, offset, SEEK_SET);
+	fwrite(&value, sizeof(value), 1, file);
+	fclose(file);
+}
+
+int main(void)
+{
+	char dir[] = "/tmp/rgl-snapshot-XXXXXX";
+	title_snapshot_t snapshot;
+	title_index_entry_t entries[2];
+	u32 appHash;
+	FILE *file;
+
+	/* "sdmc:/..." resolves relative to the working directory on the host. */
+	CHECK(mkdtemp(dir) != NULL);
+	CHECK(chdir(dir) == 0);
+	CHECK(mkdir("sdmc:", 0777) == 0);
+
+	snapshot = make_snapshot();
+	CHECK_EQ(title_snapshot_load(&snapshot, 5, 1), TITLE_SNAPSHOT_MISSING);
+
+	fill_library();
+	memset(entries, 0, sizeof(entries));
+	entries[0].titleId = g_sd.titles[0];
+	strcpy(entries[0].name, "First");
+	snapshot = make_snapshot();
+	snapshot.entries = entries;
+	snapshot.entry_count = 1;
+	CHECK(title_snapshot_save(&snapshot));
+
+	clear_library();
+	snapshot = make_snapshot();
+	CHECK_EQ(title_snapshot_load(&snapshot, 5, 1), TITLE_SNAPSHOT_OK);
+	CHECK_EQ(g_sd.count, 5);
+	CHECK_EQ(g_sd.sizes[4], 1004);
+	CHECK_EQ(g_nand.titles[0], 0x0004001000020000ULL);
+	CHECK_EQ(g_activeCount, 5);
+	CHECK_EQ(g_pool.count, 3);
+	CHECK_EQ(g_pool.indices[2], 4);
+	CHECK_EQ(snapshot.entry_count, 1);
+	if (snapshot.entries != NULL)
+		CHECK_STR(snapshot.entries[0].name, "First");
+	free(snapshot.entries);
+
+	/* Different settings: only the lists come back. Different counts: stale. */
+	snapshot = make_snapshot();
+	snapshot.settings_hash = 0x9999;
+	CHECK_EQ(title_snapshot_load(&snapshot, 5, 1), TITLE_SNAPSHOT_LISTS_ONLY);
+	free(snapshot.entries);
+	snapshot = make_snapshot();
+	CHECK_EQ(title_snapshot_load(&snapshot, 6, 1), TITLE_SNAPSHOT_STALE);
+
+	/* Written by another app version (another title database): ignored. */
+	file = fopen(TITLE_SNAPSHOT_PATH, "rb");
+	CHECK(file != NULL);
+	fseek(file, HEADER_APP_HASH_OFFSET, SEEK_SET);
+	CHECK(fread(&appHash, sizeof(appHash), 1, file) == 1);
+	fclose(file);
+	poke_header(HEADER_APP_HASH_OFFSET, appHash ^ 1);
+	snapshot = make_snapshot();
+	CHECK_EQ(title_snapshot_load(&snapshot, 5, 1), TITLE_SNAPSHOT_MISSING);
+	poke_header(HEADER_APP_HASH_OFFSET, appHash);
+	snapshot = make_snapshot();
+	CHECK_EQ(title_snapshot_load(&snapshot, 5, 1), TITLE_SNAPSHOT_OK);
+	free(snapshot.entries);
+
+	remove(TITLE_SNAPSHOT_PATH);
+	rmdir("sdmc:/3ds/3DS-Random-Game-Launcher");
+	rmdir("sdmc:/3ds");
+	rmdir("sdmc:");
+	rmdir(dir);
+	return TEST_RESULT();
+}
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* The compiled console codepoint table against the Python table clean_title_name() uses, for
+ * every BMP code point: codepoint_classes.h is dumped from the Python table by
+ * scripts/build_codepoint_table.py. */
+
+#include "codepoint_classes.h"
+#include "test.h"
+#include "title_text_table.h"
+
+#define RUN_COUNT (sizeof(codepoint_class_runs) / sizeof(codepoint_class_runs[0]))
+#define REPLACEMENT_COUNT (sizeof(codepoint_replacements) / sizeof(codepoint_replacements[0]))
+
+int main(void)
+{
+	u32 mismatches = 0;
+	u32 first = 0x10000;
+	u32 run = 0;
+	u32 cp;
+	u32 i;
+
+	CHECK_EQ(codepoint_class_runs[0].first, 0);
+	for (cp = 0; cp <= 0xFFFF; cp++) {
+		u8 expected;
+
+		while (run + 1 < RUN_COUNT && codepoint_class_runs[run + 1].first <= cp)
+			run++;
+		expected = codepoint_class_runs[run].value;
+		if (title_text_codepoint_class(cp) != expected) {
+			if (mismatches++ == 0)
+				first = cp;
+		}
+	}
+	if (mismatches > 0)
+		fprintf(stderr, "%u code points disagree, first U+%04X\n", (unsigned)mismatches, (unsigned)first);
+	CHECK_EQ(mismatches, 0);
+
+	CHECK_EQ(title_text_codepoint_class(0x10000), TITLE_TEXT_CLASS_DROP);
+	CHECK_EQ(title_text_codepoint_class(0x1F600), TITLE_TEXT_CLASS_DROP);
+
+	/* Replacement classes index the same strings in both tables. */
+	for (i = 0; i < REPLACEMENT_COUNT; i++)
+		CHECK_STR(title_text_replacements[i], codepoint_replacements[i]);
+	for (i = 0; i < RUN_COUNT; i++)
+		CHECK(codepoint_class_runs[i].value < TITLE_TEXT_CLASS_REPLACE + REPLACEMENT_COUNT);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Framebuffer text renderer with a test raster: mixed Latin/kana/kanji lines against golden
+ * images, clipping, and what the glyph cache reuses. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "fixtures.h"
+#include "test.h"
+#include "ui_font.h"
+
+#define FB_WIDTH 400
+#define FB_HEIGHT UI_FONT_FB_HEIGHT
+#define LEGEND_MAX 16
+
+static u16 g_fb[FB_WIDTH * FB_HEIGHT];
+static char g_image[32768];
+
+static u16 pixel(u32 x, u32 y)
+{
+	return g_fb[x * FB_HEIGHT + (FB_HEIGHT - 1 - y)];
+}
+
+/* Cells [col, col + cols) of one text row as ASCII art: one symbol per distinct color, in order of
+ * first appearance, with the RGB565 legend first. */
+static const char *image_of_row(u32 row, u32 col, u32 cols)
+{
+	static const char symbols[LEGEND_MAX + 1] = ".#+*abcdefghijkl";
+	u16 legend[LEGEND_MAX];
+	u32 legendCount = 0;
+	size_t n = 0;
+	u32 x;
+	u32 y;
+	u32 i;
+
+	for (y = row * UI_FONT_CELL_PX; y < (row + 1) * UI_FONT_CELL_PX; y++) {
+		for (x = col * UI_FONT_CELL_PX; x < (col + cols) * UI_FONT_CELL_PX; x++) {
+			for (i = 0; i < legendCount && legend[i] != pixel(x, y); i++)
+				;
+			if (i == legendCount && legendCount < LEGEND_MAX)
+				legend[legendCount++] = pixel(x, y);
+		}
+	}
+
+	for (i = 0; i < legendCount; i++)
+		n += (size_t)snprintf(g_image + n, sizeof(g_image) - n, "%c %04X\n", symbols[i], legend[i]);
+	for (y = row * UI_FONT_CELL_PX; y < (row + 1) * UI_FONT_CELL_PX; y++) {
+		for (x = col * UI_FONT_CELL_PX; x < (col + cols) * UI_FONT_CELL_PX && n + 2 < sizeof(g_image); x++) {
+			for (i = 0; i < legendCount && legend[i] != pixel(x, y); i++)
+				;
+			g_image[n++] = i < legendCount ? symbols[i] : '?';
+		}
+		g_image[n++] = '\n';
+	}
+	g_image[n] = '\0';
+	return g_image;
+}
+
+int main(void)
+{
+	ui_font_stats_t before;
+
+	ui_font_set_raster(fixture_font_raster);
+	memset(g_fb, 0xAA, sizeof(g_fb));
+
+	/* Latin, kana and kanji in one line; the missing glyph falls back to background. */
+	CHECK_EQ(ui_font_draw_text(g_fb, FB_WIDTH, 2, 1, 16, "Az \xE3\x82\xBC\xE3\x83\xAB\xE3\x83\x80 \xE6\xBC\xA2\xE2\x96\xA0!",
+		15, 4), 14);
+	CHECK(fixture_golden("ui_font_mixed.txt", image_of_row(2, 1, 16)));
+
+	/* Clipped at a whole character: the wide glyph that would straddle the edge is left out. */
+	CHECK_EQ(ui_font_draw_text(g_fb, FB_WIDTH, 4, 0, 4, "ab\xE6\xBC\xA2\xE5\xAD\x97", 0, 7), 4);
+	CHECK_EQ(ui_font_draw_text(g_fb, FB_WIDTH, 5, 0, 3, "ab\xE6\xBC\xA2", 0, 7), 2);
+	CHECK(fixture_golden("ui_font_clip.txt", image_of_row(5, 0, 3)));
+
+	/* A wide glyph in the last column does not fit; nothing past the framebuffer is touched. */
+	CHECK(!ui_font_draw(g_fb, FB_WIDTH, 0, FB_WIDTH / UI_FONT_CELL_PX - 1, 0x6F22, 15, 0));
+	CHECK(ui_font_draw(g_fb, FB_WIDTH, 0, FB_WIDTH / UI_FONT_CELL_PX - 2, 0x6F22, 15, 0));
+	CHECK(!ui_font_draw(g_fb, FB_WIDTH, FB_HEIGHT / UI_FONT_CELL_PX, 0, 'A', 15, 0));
+
+	/* Redrawing the same line is all hits; a new color pair is a new glyph. */
+	before = *ui_font_stats();
+	ui_font_draw_text(g_fb, FB_WIDTH, 2, 1, 16, "Az \xE3\x82\xBC\xE3\x83\xAB\xE3\x83\x80 \xE6\xBC\xA2\xE2\x96\xA0!", 15, 4);
+	CHECK_EQ(ui_font_stats()->misses, before.misses);
+	CHECK_EQ(ui_font_stats()->hits - before.hits, 8);
+	ui_font_draw(g_fb, FB_WIDTH, 3, 1, 'A', 14, 4);
+	CHECK_EQ(ui_font_stats()->misses, before.misses + 1);
+
+	/* A cached glyph is the same image as a freshly rasterized one. */
+	memset(g_fb, 0, sizeof(g_fb));
+	ui_font_draw_text(g_fb, FB_WIDTH, 6, 0, 16, "Az \xE3\x82\xBC\xE3\x83\xAB\xE3\x83\x80 \xE6\xBC\xA2\xE2\x96\xA0!", 15, 4);
+	CHECK(fixture_golden("ui_font_mixed.txt", image_of_row(6, 0, 16)));
+
+	/* Changing the raster empties the cache. */
+	before = *ui_font_stats();
+	ui_font_set_raster(fixture_font_raster);
+	ui_font_draw(g_fb, FB_WIDTH, 3, 1, 'A', 14, 4);
+	CHECK_EQ(ui_font_stats()->misses, before.misses + 1);
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Row budget: with every optional row shown, each page must leave the header bar on row 1 and
+ * end above the footer on row 30. A page one row too long scrolls the console instead. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+#include "ui_capture.h"
+#include "ui_fixture.h"
+
+#define FOOTER_ROW UI_GRID_ROWS
+
+static ui_grid_t g_grid;
+static char g_dump[16384];
+
+static void check_page(ui_fixture_t *fixture, u32 page)
+{
+	char row[256];
+
+	fixture->view.page = page;
+	ui_layout_main_screen(&fixture->view, &g_grid);
+	ui_grid_show(&g_grid);
+	ui_capture_flush();
+	ui_capture_dump(g_dump, sizeof(g_dump), false);
+
+	if (strstr(ui_fixture_row(g_dump, 1, row, sizeof(row)), "RANDOM GAME LAUNCHER") == NULL)
+		fprintf(stderr, "page %u: row 1 is \"%s\"\n", (unsigned)page, row);
+	CHECK(strstr(row, "RANDOM GAME LAUNCHER") != NULL);
+	CHECK(strstr(ui_fixture_row(g_dump, FOOTER_ROW, row, sizeof(row)), "v" APP_VERSION) != NULL);
+}
+
+int main(void)
+{
+	static ui_fixture_t fixture;
+	u32 page;
+
+	ui_capture_begin();
+	ui_fixture_init(&fixture);
+	for (page = 0; page < 4; page++)
+		check_page(&fixture, page);
+
+	ui_fixture_worst_case(&fixture);
+	for (page = 0; page < 4; page++)
+		check_page(&fixture, page);
+	ui_capture_end();
+
+	return TEST_RESULT();
+}
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+/* Every screen the top console shows, captured with colors against golden dumps: the four pick
+ * pages, the options menu, cold-start scan progress and the empty-pool message. Then what an
+ * interaction costs: a cursor step redraws its two rows with one cursor move each, a repeated
+ * frame sends nothing. */
+
+#include <string.h>
+
+#include "fixtures.h"
+#include "test.h"
+#include "title_scan.h"
+#include "ui_capture.h"
+#include "ui_fixture.h"
+
+static ui_grid_t g_grid;
+static char g_dump[16384];
+
+static bool screen_matches(const char *golden)
+{
+	ui_capture_flush();
+	ui_capture_dump(g_dump, sizeof(g_dump), true);
+	return fixture_golden(golden, g_dump);
+}
+
+static void show_page(ui_fixture_t *fixture, u32 page)
+{
+	fixture->view.page = page;
+	ui_layout_main_screen(&fixture->view, &g_grid);
+	ui_grid_show(&g_grid);
+}
+
+static void check_pages(ui_fixture_t *fixture)
+{
+	static const char *const goldens[UI_PAGE_COUNT] = { "ui_page_game.txt", "ui_page_details.txt",
+		"ui_page_technical.txt", "ui_page_library.txt" };
+	u32 page;
+
+	for (page = 0; page < UI_PAGE_COUNT; page++) {
+		show_page(fixture, page);
+		CHECK(screen_matches(goldens[page]));
+	}
+
+	/* Showing the same page again: nothing changed, nothing sent. */
+	ui_capture_reset_counters();
+	show_page(fixture, UI_PAGE_COUNT - 1);
+	ui_capture_flush();
+	CHECK_EQ(ui_capture_counters()->redraws, 0);
+	CHECK_EQ(ui_capture_counters()->bytes, 0);
+	CHECK_EQ(ui_capture_counters()->moves, 0);
+}
+
+static void check_options_menu(void)
+{
+	const ui_capture_counters_t *counters = ui_capture_counters();
+
+	ui_fixture_draw_filter_menu(0);
+	CHECK(screen_matches("ui_options.txt"));
+
+	/* Down: the old and the new cursor row change, one run (one cursor move) each. */
+	ui_capture_reset_counters();
+	ui_fixture_draw_filter_menu(1);
+	ui_capture_flush();
+	CHECK_EQ(counters->redraws, 1);
+	CHECK_EQ(counters->moves, 2);
+	CHECK(counters->cells > 0 && counters->cells <= 2 * UI_GRID_COLS);
+	CHECK_EQ(counters->writes, 1);
+
+	/* Across a section heading: still two rows. */
+	ui_capture_reset_counters();
+	ui_fixture_draw_filter_menu(8);
+	ui_capture_flush();
+	CHECK_EQ(counters->moves, 2);
+
+	/* The same frame again (no key pressed). */
+	ui_capture_reset_counters();
+	ui_fixture_draw_filter_menu(8);
+	ui_capture_flush();
+	CHECK_EQ(counters->cells, 0);
+	CHECK_EQ(counters->moves, 0);
+	CHECK_EQ(counters->bytes, 0);
+	CHECK_EQ(counters->flushes, 1);
+}
+
+static void check_scan_progress(void)
+{
+	static title_scan_t scans[3];
+	title_scan_job_t jobs[3];
+	const ui_capture_counters_t *counters = ui_capture_counters();
+
+	memset(jobs, 0, sizeof(jobs));
+	jobs[0].scan = &scans[0];
+	jobs[0].media = MEDIATYPE_SD;
+	jobs[0].stage = TITLE_SCAN_JOB_INFO;
+	scans[0].count = 700;
+	jobs[0].info_done = 98;
+	jobs[1].scan = &scans[1];
+	jobs[1].media = MEDIATYPE_NAND;
+	jobs[1].stage = TITLE_SCAN_JOB_DONE;
+	scans[1].count = 112;
+	jobs[2].scan = &scans[2];
+	jobs[2].media = MEDIATYPE_GAME_CARD;
+	jobs[2].stage = TITLE_SCAN_JOB_LISTING;
+
+	ui_draw_scan_progress(jobs, 3);
+	CHECK(screen_matches("ui_scan_progress.txt"));
+
+	/* One more title's info: only the counter digits change. */
+	ui_capture_reset_counters();
+	jobs[0].info_done = 99;
+	ui_draw_scan_progress(jobs, 3);
+	ui_capture_flush();
+	CHECK_EQ(counters->moves, 1);
+	CHECK_EQ(counters->cells, 1);
+
+	/* 99 -> 100 shifts the rest of the line right by one. */
+	ui_capture_reset_counters();
+	jobs[0].info_done = 100;
+	ui_draw_scan_progress(jobs, 3);
+	ui_capture_flush();
+	CHECK_EQ(counters->moves, 1);
+	CHECK(counters->cells <= UI_GRID_COLS);
+}
+
+static void check_empty_pool(void)
+{
+	ui_source_t sources[UI_SOURCE_COUNT];
+
+	memset(sources, 0, sizeof(sources));
+	sources[MEDIATYPE_SD].included = true;
+	sources[MEDIATYPE_SD].scanned = true;
+	sources[MEDIATYPE_NAND].title_count = 112;
+	sources[MEDIATYPE_NAND].scanned = true;
+
+	ui_draw_empty_pool_message(sources, true);
+	CHECK(screen_matches("ui_empty_pool.txt"));
+
+	ui_draw_empty_pool_message(sources, false);
+	ui_capture_flush();
+	ui_capture_dump(g_dump, sizeof(g_dump), false);
+	CHECK(strstr(g_dump, "No titles match these filters.") != NULL);
+	CHECK(strstr(g_dump, "enable SD or NAND") == NULL);
+}
+
+int main(void)
+{
+	static ui_fixture_t fixture;
+
+	ui_capture_begin();
+	ui_fixture_init(&fixture);
+	check_pages(&fixture);
+	check_options_menu();
+	check_scan_progress();
+	check_empty_pool();
+	ui_capture_end();
+
+	return TEST_RESULT();
+}
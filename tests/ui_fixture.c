@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#include "ui_fixture.h"
+
+#include <string.h>
+
+#include "perf.h"
+#include "title_histogram.h"
+
+static void put_utf16(u16 *out, u32 maxUnits, const char *text)
+{
+	u32 i;
+
+	for (i = 0; text[i] != '\0' && i + 1 < maxUnits; i++)
+		out[i] = (u8)text[i];
+	out[i] = 0;
+}
+
+void ui_fixture_init(ui_fixture_t *fixture)
+{
+	title_pick_t *pick = &fixture->pick;
+	title_stats_t *stats = &fixture->stats;
+	u32 i;
+
+	memset(fixture, 0, sizeof(*fixture));
+	pick->titleId = 0x0004000000030800ULL;
+	pick->media = MEDIATYPE_SD;
+	strcpy(pick->display_name, "The Legend of Zelda: Ocarina of Time 3D");
+	pick->name_source = TITLE_NAME_SOURCE_SMDH;
+	pick->smdh.result = TITLE_SMDH_OK;
+	put_utf16(pick->smdh.raw_short_name, 0x40, "Zelda: Ocarina of Time 3D");
+	put_utf16(pick->smdh.raw_long_name, 0x80, "The Legend of Zelda: Ocarina of Time 3D");
+	put_utf16(pick->smdh.raw_publisher, 0x40, "Nintendo");
+	pick->smdh.region_lock = 0x7FFFFFFF;
+	pick->smdh.cec_id = 0x00033500;
+	pick->meta.platform = 0x0004;
+	pick->meta.unique_id = 0x00308;
+	pick->meta.version_major = 1;
+	pick->meta.version_minor = 2;
+	pick->meta.installed_size = 612ULL * 1024 * 1024;
+	pick->meta.lazy.loaded = true;
+
+	fixture->filters.include_native_apps = true;
+	fixture->filters.include_virtual_console = true;
+
+	stats->total = 812;
+	stats->sd_count = 700;
+	stats->nand_count = 112;
+	stats->catalog_count = 640;
+	stats->native_count = 500;
+	stats->vc_count = 40;
+	stats->total_size = 123456789012ULL;
+	for (i = 0; i < TITLE_CLASS_COUNT; i++) {
+		stats->class_counts[i] = i * 13;
+		stats->class_sizes[i] = (u64)i * 100000000ULL;
+	}
+	stats->platform_counts[4] = 812;
+
+	fixture->banner.result = TITLE_BANNER_ERR_OPEN;
+
+	fixture->view.pick = pick;
+	fixture->view.filters = &fixture->filters;
+	fixture->view.stats = stats;
+	fixture->view.banner = &fixture->banner;
+	fixture->view.active_title_count = 812;
+	fixture->view.eligible_title_count = 640;
+	fixture->view.index_done_count = 640;
+	fixture->view.index_total_count = 812;
+	fixture->view.am_call_count = 9;
+	fixture->view.sources[MEDIATYPE_SD].title_count = 700;
+	fixture->view.sources[MEDIATYPE_SD].included = true;
+	fixture->view.sources[MEDIATYPE_SD].scanned = true;
+	fixture->view.sources[MEDIATYPE_NAND].title_count = 112;
+	fixture->view.sources[MEDIATYPE_NAND].scanned = true;
+}
+
+void ui_fixture_worst_case(ui_fixture_t *fixture)
+{
+	/* The spans main() records, in order. */
+	static const char *const spans[] = { "gfx", "am", "fs", "cfg", "console", "snapshot", "scan", "pool",
+		"pick" };
+	title_pick_t *pick = &fixture->pick;
+	u32 i;
+
+	perf_init();
+	perf_mark("chainload");
+	for (i = 0; i < sizeof(spans) / sizeof(spans[0]); i++)
+		perf_end(perf_begin(spans[i]));
+	perf_mark("first pick");
+
+	strcpy(pick->meta.lazy.product_code, "CTR-P-AQEE");
+	pick->meta.lazy.has_extdata = true;
+	pick->meta.lazy.extdata_id = 0x00000033500ULL;
+	fixture->banner.result = TITLE_BANNER_OK;
+	fixture->banner.width = 256;
+	fixture->banner.height = 128;
+	fixture->banner.texture_format = 12;
+	fixture->banner.decoded_size = 20480;
+	fixture->banner.decode_us = 1000;
+	fixture->view.sources[MEDIATYPE_GAME_CARD].title_count = 1;
+	fixture->view.sources[MEDIATYPE_GAME_CARD].included = true;
+	fixture->view.sources[MEDIATYPE_GAME_CARD].scanned = true;
+}
+
+/* The options menu's pool settings, as main.c keeps them. */
+typedef struct {
+	title_filter_options_t filters;
+	bool include_homebrew;
+	u32 media_mask;
+} menu_settings_t;
+
+static const menu_settings_t g_menuSettings = {
+	.filters = { .include_native_apps = true, .include_virtual_console = true, .include_dsiware = true },
+	.media_mask = TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_SD),
+};
+
+/* The library the menu previews against: SD and NAND listed, the game card not yet. */
+static title_histogram_t g_menuHistogram;
+
+static void add_titles(u32 cls, bool isVc, bool inCatalog, u32 mediaSet, u16 count)
+{
+	g_menuHistogram.cells[title_meta_class_index(cls)][isVc][inCatalog][mediaSet] += count;
+	g_menuHistogram.title_count += count;
+}
+
+static void build_menu_histogram(void)
+{
+	u32 sd = TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_SD);
+	u32 nand = TITLE_HISTOGRAM_MEDIA_BIT(MEDIATYPE_NAND);
+
+	if (g_menuHistogram.media_mask != 0)
+		return;
+
+	g_menuHistogram.media_mask = sd | nand;
+	add_titles(TITLE_CLASS_APPLICATION, false, true, sd, 537);
+	add_titles(TITLE_CLASS_APPLICATION, false, true, sd | nand, 3);
+	add_titles(TITLE_CLASS_APPLICATION, true, true, sd, 70);
+	add_titles(TITLE_CLASS_APPLICATION, false, false, sd, 15);
+	add_titles(TITLE_CLASS_DSIWARE, false, true, sd, 30);
+	add_titles(TITLE_CLASS_DSIWARE, false, true, nand, 12);
+	add_titles(TITLE_CLASS_DEMO, false, true, sd, 18);
+	add_titles(TITLE_CLASS_CONTENT_PACK, false, true, sd, 9);
+	add_titles(TITLE_CLASS_DLC, false, true, sd, 25);
+	add_titles(TITLE_CLASS_DLC, false, false, sd, 40);
+	add_titles(TITLE_CLASS_PATCH, false, false, sd, 60);
+	add_titles(TITLE_CLASS_SYSTEM, false, true, nand, 6);
+	add_titles(TITLE_CLASS_SYSTEM, false, false, nand, 100);
+}
+
+/* Content type rows 0-7; NULL for the other rows. */
+static bool *filter_row_flag(title_filter_options_t *filters, u32 row)
+{
+	bool *const flags[] = { &filters->include_native_apps, &filters->include_virtual_console,
+		&filters->include_dsiware, &filters->include_demos, &filters->include_content_packs,
+		&filters->include_dlc, &filters->include_patches, &filters->include_system };
+
+	return row < sizeof(flags) / sizeof(flags[0]) ? flags[row] : NULL;
+}
+
+/* Source rows 8-10, in FS_MediaType terms. */
+static bool filter_row_media(u32 row, u32 *mediaBit)
+{
+	static const FS_MediaType media[] = { MEDIATYPE_SD, MEDIATYPE_NAND, MEDIATYPE_GAME_CARD };
+
+	if (row < 8 || row > 10)
+		return false;
+	*mediaBit = TITLE_HISTOGRAM_MEDIA_BIT(media[row - 8]);
+	return true;
+}
+
+/* Flip a row's setting like main.c's toggle_pool_setting; false for rows outside the pool. */
+static bool toggle_menu_setting(menu_settings_t *settings, u32 row)
+{
+	bool *flag = filter_row_flag(&settings->filters, row);
+	u32 mediaBit;
+
+	if (flag != NULL) {
+		*flag = !*flag;
+		return true;
+	}
+	if (filter_row_media(row, &mediaBit)) {
+		settings->media_mask ^= mediaBit;
+		return true;
+	}
+	if (row == 12) {
+		settings->include_homebrew = !settings->include_homebrew;
+		return true;
+	}
+	return false;
+}
+
+static bool preview_menu_count(const menu_settings_t *settings, u32 *outCount)
+{
+	u32 count = title_histogram_count(&g_menuHistogram, &settings->filters, settings->include_homebrew,
+		settings->media_mask);
+
+	*outCount = count < TITLE_PICKER_POOL_MAX ? count : TITLE_PICKER_POOL_MAX;
+	return (settings->media_mask & ~g_menuHistogram.media_mask) == 0;
+}
+
+static bool filter_row_enabled(u32 row)
+{
+	menu_settings_t settings = g_menuSettings;
+	bool *flag = filter_row_flag(&settings.filters, row);
+	u32 mediaBit;
+
+	if (flag != NULL)
+		return *flag;
+	if (filter_row_media(row, &mediaBit))
+		return (settings.media_mask & mediaBit) != 0;
+	return row == 12 && settings.include_homebrew;
+}
+
+static const char *filter_row_label(u32 row)
+{
+	static const char *const labels[UI_FIXTURE_FILTER_ROWS] = { "Native apps", "Virtual Console", "DSiWare",
+		"Demos", "Content", "DLC", "Patches", "System", "SD titles", "NAND titles", "Game card",
+		"Long game name", "Unlisted only", "Log startup times", "Instant launch", "Restore defaults" };
+
+	return row < UI_FIXTURE_FILTER_ROWS ? labels[row] : "";
+}
+
+static bool filter_row_is_action(u32 row)
+{
+	return row == UI_FIXTURE_FILTER_ROWS - 1;
+}
+
+static bool filter_row_delta(u32 row, s32 *delta)
+{
+	menu_settings_t toggled = g_menuSettings;
+	u32 currentCount;
+	u32 toggledCount;
+
+	if (!toggle_menu_setting(&toggled, row))
+		return false;
+
+	if (preview_menu_count(&g_menuSettings, &currentCount) && preview_menu_count(&toggled, &toggledCount))
+		*delta = (s32)toggledCount - (s32)currentCount;
+	else
+		*delta = UI_FILTER_DELTA_UNKNOWN;
+	return true;
+}
+
+void ui_fixture_draw_filter_menu(u32 cursor)
+{
+	u32 eligible;
+	bool known;
+
+	build_menu_histogram();
+	known = preview_menu_count(&g_menuSettings, &eligible);
+	ui_draw_filter_menu(cursor, UI_FIXTURE_FILTER_ROWS, eligible, known, filter_row_enabled, filter_row_label,
+		filter_row_is_action, filter_row_delta);
+}
+
+const char *ui_fixture_row(const char *dump, u32 row, char *out, size_t outSize)
+{
+	const char *line = dump;
+	size_t len;
+
+	while (row-- > 1 && line != NULL) {
+		line = strchr(line, '\n');
+		if (line != NULL)
+			line++;
+	}
+	if (line == NULL) {
+		out[0] = '\0';
+		return out;
+	}
+
+	len = strcspn(line, "\n");
+	if (len >= outSize)
+		len = outSize - 1;
+	memcpy(out, line, len);
+	out[len] = '\0';
+	return out;
+}
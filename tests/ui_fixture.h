@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 selloa
+
+#ifndef TESTS_UI_FIXTURE_H
+#define TESTS_UI_FIXTURE_H
+
+#include <stdbool.h>
+
+#include "title_banner.h"
+#include "ui.h"
+
+/* Rows of the options menu as main.c lays them out. */
+#define UI_FIXTURE_FILTER_ROWS 16
+
+/*
+ * A fixed view for drawing pages headless. The worst case fills every optional row the pages
+ * have: product code, extdata, banner, game card counts, and startup timings long enough to wrap.
+ */
+typedef struct {
+	ui_view_t view;
+	title_pick_t pick;
+	title_filter_options_t filters;
+	title_stats_t stats;
+	title_banner_t banner;
+} ui_fixture_t;
+
+/// Fill fixture with an ordinary pick (SD title with SMDH names, nothing optional shown).
+void ui_fixture_init(ui_fixture_t *fixture);
+
+/// Everything optional shown, including startup spans recorded through perf (call once).
+void ui_fixture_worst_case(ui_fixture_t *fixture);
+
+/// The options menu with the first three content types and SD on, previewing each toggle against a
+/// small histogram (SD and NAND listed, the game card not, so its delta is unknown).
+void ui_fixture_draw_filter_menu(u32 cursor);
+
+/// Row (1-based) and text of a capture dump line; copies at most outSize - 1 bytes.
+const char *ui_fixture_row(const char *dump, u32 row, char *out, size_t outSize);
+
+#endif